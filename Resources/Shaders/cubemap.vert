@@ -11,9 +11,7 @@ void main()
 
     DrawData dd = DrawDataBuffer.Data[gl_BaseInstance];
 
-    uint refIdx = dd.IndexOffset + gl_VertexIndex;
-    uint verIdx = IndexBuffer.Data[refIdx] + dd.VertexOffset;
-    DrawVertex v = VertexBuffer.Data[verIdx];
+    DrawVertex v = FetchVertex(dd, FetchIndex(dd, gl_VertexIndex));
 
     vec3 vertexPosition = vec3(v.x, v.y, v.z);
     gl_Position = Camera.Projection * Camera.View * vec4(cubeScale * vertexPosition, 1.0f);
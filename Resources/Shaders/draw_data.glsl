@@ -0,0 +1,17 @@
+/*
+ * Mirrors Renderers::DrawData, shared by the vertex pulling shaders and the culling compute pass
+ */
+struct DrawData
+{
+    uint Index;
+    uint TransformIndex;
+    uint MaterialIndex;
+    uint VertexOffset;
+    uint IndexOffset;
+    uint VertexCount;
+    uint IndexCount;
+    uint VertexFormat;
+    uint IndexFormat;
+    float PositionOffsetX, PositionOffsetY, PositionOffsetZ;
+    float PositionScaleX, PositionScaleY, PositionScaleZ;
+};
\ No newline at end of file
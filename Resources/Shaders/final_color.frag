@@ -1,6 +1,5 @@
 #version 460
 #extension GL_EXT_nonuniform_qualifier : require
-#extension GL_EXT_shader_explicit_arithmetic_types_int64: enable
 
 layout(location = 0) in vec3 uvw;
 layout(location = 1) in vec3 worldNormal;
@@ -22,10 +21,11 @@ struct MaterialData
     float MetallicFactor;
     float AlphaTest;
 
-    uint64_t EmissiveTextureMap;
-    uint64_t AlbedoTextureMap;
-    uint64_t NormalTextureMap;
-    uint64_t OpacityTextureMap;
+    uint EmissiveTextureMap;
+    uint AlbedoTextureMap;
+    uint NormalTextureMap;
+    uint OpacityTextureMap;
+    uint Padding;
 };
 
 layout(set = 0, binding = 5) readonly buffer MatSB { MaterialData Data[]; } MaterialDataBuffer;
@@ -95,22 +95,19 @@ void main()
     vec4 albedo = material.AlbedoColor;
     vec3 normalSample = vec3(0, 0, 0);
 
-    const int INVALID_HANDLE = 2000; //0xFFFFFFFF
+    const uint INVALID_HANDLE = 0xFFFFFFFFu;
 
-    if (material.AlbedoTextureMap < INVALID_HANDLE)
+    if (material.AlbedoTextureMap != INVALID_HANDLE)
     {
-        uint albedoTextureId    = uint(material.AlbedoTextureMap);
-        albedo     = texture( TextureArray[nonuniformEXT(albedoTextureId)], uvw.xy);
+        albedo     = texture( TextureArray[nonuniformEXT(material.AlbedoTextureMap)], uvw.xy);
     }
-    if (material.EmissiveTextureMap < INVALID_HANDLE)
+    if (material.EmissiveTextureMap != INVALID_HANDLE)
     {
-        uint emissiveTextureId  = uint(material.EmissiveTextureMap);
-        emissive   = texture( TextureArray[nonuniformEXT(emissiveTextureId)], uvw.xy);
+        emissive   = texture( TextureArray[nonuniformEXT(material.EmissiveTextureMap)], uvw.xy);
     }
-    if (material.NormalTextureMap < INVALID_HANDLE)
+    if (material.NormalTextureMap != INVALID_HANDLE)
     {
-        uint normalTextureId    = uint(material.NormalTextureMap);
-        normalSample     = texture( TextureArray[nonuniformEXT(normalTextureId)], uvw.xy).xyz;
+        normalSample     = texture( TextureArray[nonuniformEXT(material.NormalTextureMap)], uvw.xy).xyz;
     }
 
     runAlphaTest(albedo.a, material.AlphaTest);
@@ -12,11 +12,9 @@ void main()
 {
 	DrawData dd = DrawDataBuffer.Data[gl_BaseInstance];
 
-    uint refIdx = dd.IndexOffset + gl_VertexIndex;
-    uint verIdx = IndexBuffer.Data[refIdx] + dd.VertexOffset;
-    DrawVertex v = VertexBuffer.Data[verIdx];
+    DrawVertex v = FetchVertex(dd, FetchIndex(dd, gl_VertexIndex));
 
-	mat4 model = TransformBuffer.Data[gl_BaseInstance];
+	mat4 model = TransformBuffer.Data[dd.TransformIndex];
 	worldPos   = model * vec4(v.x, v.y, v.z, 1.0);
 	worldNormal = transpose(inverse(mat3(model))) * vec3(v.nx, v.ny, v.nz);
 
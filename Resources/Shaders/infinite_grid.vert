@@ -10,9 +10,7 @@ void main()
 {
     DrawData dd = DrawDataBuffer.Data[gl_BaseInstance];
 
-    uint refIdx = dd.IndexOffset + gl_VertexIndex;
-    uint verIdx = IndexBuffer.Data[refIdx] + dd.VertexOffset;
-    DrawVertex v = VertexBuffer.Data[verIdx];
+    DrawVertex v = FetchVertex(dd, FetchIndex(dd, gl_VertexIndex));
 
     vec3 vpos = vec3(v.x, v.y, v.z) * gridSize;
     gl_Position = Camera.Projection * Camera.View * vec4(vpos, 1.0);
@@ -5,19 +5,79 @@ struct DrawVertex
     float u, v;
 };
 
-struct DrawData
-{
-	uint Index;
-    uint TransformIndex;
-    uint MaterialIndex;
-    uint VertexOffset;
-    uint IndexOffset;
-    uint VertexCount;
-    uint IndexCount;
-};
+#include "draw_data.glsl"
 
 layout(set = 0, binding = 0) uniform UBCamera { mat4 View; mat4 Projection; vec4 Position; } Camera;
-layout(set = 0, binding = 1) readonly buffer VertexSB { DrawVertex Data[]; } VertexBuffer;
+layout(set = 0, binding = 1) readonly buffer VertexSB { uint Data[]; } VertexBuffer;
 layout(set = 0, binding = 2) readonly buffer IndexSB { uint Data[]; } IndexBuffer;
 layout(set = 0, binding = 3) readonly buffer DrawDataSB { DrawData Data[]; } DrawDataBuffer;
-layout(set = 0, binding = 4) readonly buffer TransformSB { mat4 Data[]; } TransformBuffer;
\ No newline at end of file
+layout(set = 0, binding = 4) readonly buffer TransformSB { mat4 Data[]; } TransformBuffer;
+
+/*
+ * Mirrors Meshes::VertexFormat, quantized vertices are laid out as Meshes::QuantizedVertex
+ */
+#define VERTEX_FORMAT_FLOAT     0
+#define VERTEX_FORMAT_QUANTIZED 1
+/*
+ * Mirrors Meshes::IndexFormat, 16 bits indices are packed two per word as Meshes::PackIndices() writes them
+ */
+#define INDEX_FORMAT_UINT32 0
+#define INDEX_FORMAT_UINT16 1
+
+vec2 SignNotZero(vec2 value)
+{
+    return vec2((value.x >= 0.0) ? 1.0 : -1.0, (value.y >= 0.0) ? 1.0 : -1.0);
+}
+
+/*
+ * Index at `position` of the draw index range, relative to its first vertex
+ */
+uint FetchIndex(DrawData dd, uint position)
+{
+    if (dd.IndexFormat == INDEX_FORMAT_UINT16)
+    {
+        uint word = IndexBuffer.Data[dd.IndexOffset + (position >> 1)];
+        return (word >> ((position & 1) * 16)) & 0xFFFF;
+    }
+    return IndexBuffer.Data[dd.IndexOffset + position];
+}
+
+/*
+ * Vertex `vertexIndex` of the draw, relative to its first vertex
+ */
+DrawVertex FetchVertex(DrawData dd, uint vertexIndex)
+{
+    DrawVertex v;
+    if (dd.VertexFormat == VERTEX_FORMAT_QUANTIZED)
+    {
+        uint base = dd.VertexOffset + vertexIndex * 4;
+        vec2 positionXY = unpackUnorm2x16(VertexBuffer.Data[base]);
+        vec2 positionZ = unpackUnorm2x16(VertexBuffer.Data[base + 1]);
+        vec3 position = vec3(dd.PositionOffsetX, dd.PositionOffsetY, dd.PositionOffsetZ) + vec3(positionXY, positionZ.x) * vec3(dd.PositionScaleX, dd.PositionScaleY, dd.PositionScaleZ);
+
+        vec2 octahedral = unpackSnorm2x16(VertexBuffer.Data[base + 2]);
+        vec3 normal = vec3(octahedral, 1.0 - abs(octahedral.x) - abs(octahedral.y));
+        if (normal.z < 0.0)
+        {
+            normal.xy = (1.0 - abs(normal.yx)) * SignNotZero(normal.xy);
+        }
+        normal = normalize(normal);
+
+        vec2 uv = unpackHalf2x16(VertexBuffer.Data[base + 3]);
+        v.x = position.x; v.y = position.y; v.z = position.z;
+        v.nx = normal.x; v.ny = normal.y; v.nz = normal.z;
+        v.u = uv.x; v.v = uv.y;
+        return v;
+    }
+
+    uint base = dd.VertexOffset + vertexIndex * 8;
+    v.x = uintBitsToFloat(VertexBuffer.Data[base]);
+    v.y = uintBitsToFloat(VertexBuffer.Data[base + 1]);
+    v.z = uintBitsToFloat(VertexBuffer.Data[base + 2]);
+    v.nx = uintBitsToFloat(VertexBuffer.Data[base + 3]);
+    v.ny = uintBitsToFloat(VertexBuffer.Data[base + 4]);
+    v.nz = uintBitsToFloat(VertexBuffer.Data[base + 5]);
+    v.u = uintBitsToFloat(VertexBuffer.Data[base + 6]);
+    v.v = uintBitsToFloat(VertexBuffer.Data[base + 7]);
+    return v;
+}
\ No newline at end of file
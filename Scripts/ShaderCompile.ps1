@@ -46,7 +46,7 @@ if(-not (Test-Path $shaderCacheDirectory)) {
     $Null = New-Item -ItemType Directory -Path $shaderCacheDirectory -ErrorAction SilentlyContinue
 }
 
-$shaderSourceFiles = Get-ChildItem $shaderDirectory -Recurse -File | Where-Object {$_.Name -like "*.vert" -or $_.Name -like "*.frag"}
+$shaderSourceFiles = Get-ChildItem $shaderDirectory -Recurse -File | Where-Object {$_.Name -like "*.vert" -or $_.Name -like "*.frag" -or $_.Name -like "*.comp"}
 $cacheFilesCount = (Get-ChildItem $shaderCacheDirectory -Recurse | Measure-Object).Count;
 
 if (($cacheFilesCount -gt 0) -and (-not $ForceRebuild)) {
@@ -82,7 +82,11 @@ else {
 
 foreach ($shaderFile in $shaderSourceFiles) {
     $fileName = $shaderFile.BaseName
-    $suffixName = If($shaderFile.Extension -eq ".vert") { "_vertex" } Else { "_fragment" }
+    $suffixName = switch ($shaderFile.Extension) {
+        ".vert" { "_vertex" }
+        ".comp" { "_compute" }
+        Default { "_fragment" }
+    }
     $outputFileFullName = Join-Path $shaderCacheDirectory -ChildPath "$fileName$suffixName.spv"
 
     $fileFullName = $shaderFile.FullName;
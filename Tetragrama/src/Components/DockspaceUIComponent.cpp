@@ -8,6 +8,7 @@
 #include <Helpers/WindowsHelper.h>
 
 using namespace ZEngine::Components::UI::Event;
+using namespace ZEngine::Rendering::Renderers;
 
 namespace Tetragrama::Components
 {
@@ -139,6 +140,20 @@ namespace Tetragrama::Components
 
                 ImGui::EndMenu();
             }
+
+            if (ImGui::BeginMenu("Renderer"))
+            {
+                /*
+                 * The renderer keeps CPU culling when the device can't draw with vkCmdDrawIndirectCount, the check mark reflects the actual mode
+                 */
+                bool gpu_culling = (GraphicRenderer::GetSceneCullingMode() == SceneCullingMode::GPU);
+                if (ImGui::MenuItem("GPU Culling", nullptr, gpu_culling))
+                {
+                    GraphicRenderer::SetSceneCullingMode(gpu_culling ? SceneCullingMode::CPU : SceneCullingMode::GPU);
+                }
+
+                ImGui::EndMenu();
+            }
             ImGui::EndMenuBar();
         }
 
@@ -48,6 +48,20 @@ namespace Tetragrama::Components
         co_return;
     }
 
+    std::future<void> HierarchyViewUIComponent::SceneNodePickedMessageHandlerAsync(Messengers::GenericMessage<int32_t>& message)
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_selected_node_identifier = message.GetValue();
+        }
+
+        if (message.GetValue() < 0)
+        {
+            co_await Messengers::IMessenger::SendAsync<ZEngine::Components::UI::UIComponent, Messengers::EmptyMessage>(
+                EDITOR_COMPONENT_HIERARCHYVIEW_NODE_UNSELECTED, Messengers::EmptyMessage{});
+        }
+    }
+
     bool HierarchyViewUIComponent::OnUIComponentRaised(ZEngine::Components::UI::Event::UIComponentEvent&)
     {
         return false;
@@ -65,9 +79,31 @@ namespace Tetragrama::Components
             ImGui::EndPopup();
         }
 
-        if (GraphicScene::HasSceneNodes())
+        /*
+         * The tree is drawn from the published snapshot, so an import running in the background doesn't block the UI
+         */
+        auto active_scene = GraphicScene::GetActiveScene();
+        if (m_active_scene.lock().get() != active_scene.get())
         {
-            RenderSceneNodeTrees(GraphicScene::GetRootSceneNodes());
+            /*
+             * Node identifiers are meaningless across scenes
+             */
+            m_active_scene             = active_scene;
+            m_selected_node_identifier = -1;
+        }
+
+        m_scene_snapshot = active_scene->GetSnapshot();
+        if (m_scene_snapshot)
+        {
+            /*
+             * Identifiers of another hierarchy revision may have been released or renumbered (e.g by CompactScene())
+             */
+            if (m_hierarchy_revision != m_scene_snapshot->Hierarchy->Revision)
+            {
+                m_hierarchy_revision       = m_scene_snapshot->Hierarchy->Revision;
+                m_selected_node_identifier = -1;
+            }
+            RenderSceneNodeTrees(m_scene_snapshot->Hierarchy->RootSceneNodeCollection);
         }
 
         // 0 means left buttom
@@ -78,6 +114,14 @@ namespace Tetragrama::Components
                 EDITOR_COMPONENT_HIERARCHYVIEW_NODE_UNSELECTED, Messengers::EmptyMessage{});
         }
 
+        /*
+         * The snapshot may be older than the live scene, the selection must still be alive in the latter
+         */
+        if ((m_selected_node_identifier != -1) && !GraphicScene::IsSceneNodeAlive(m_selected_node_identifier))
+        {
+            m_selected_node_identifier = -1;
+        }
+
         /*
          *  Guizmo operations
          */
@@ -90,9 +134,9 @@ namespace Tetragrama::Components
                 const auto camera_projection  = camera->GetPerspectiveMatrix();
                 const auto camera_view_matrix = camera->GetViewMatrix();
 
-                auto& global_transform  = GraphicScene::GetSceneNodeGlobalTransform(m_selected_node_identifier);
-                auto  initial_transform = global_transform;
-                auto& local_transform   = GraphicScene::GetSceneNodeLocalTransform(m_selected_node_identifier);
+                auto global_transform  = GraphicScene::GetSceneNodeGlobalTransform(m_selected_node_identifier);
+                auto initial_transform = global_transform;
+                auto local_transform   = GraphicScene::GetSceneNodeLocalTransform(m_selected_node_identifier);
 
                 if (camera && ZEngine::Inputs::IDevice::As<ZEngine::Inputs::Keyboard>()->IsKeyPressed(ZENGINE_KEY_F, Engine::GetWindow()))
                 {
@@ -108,9 +152,10 @@ namespace Tetragrama::Components
                 }
                 float snap_array[3] = {snap_value, snap_value, snap_value};
 
+                bool is_manipulated = false;
                 if (m_gizmo_operation > 0)
                 {
-                    ImGuizmo::Manipulate(
+                    is_manipulated = ImGuizmo::Manipulate(
                         glm::value_ptr(camera_view_matrix),
                         glm::value_ptr(camera_projection),
                         (ImGuizmo::OPERATION) m_gizmo_operation,
@@ -119,10 +164,14 @@ namespace Tetragrama::Components
                         nullptr,
                         is_snap_operation ? snap_array : nullptr);
                 }
-
-                auto delta_transform = glm::inverse(initial_transform) * global_transform;
-                local_transform      = local_transform * delta_transform;
-                GraphicScene::MarkSceneNodeAsChanged(m_selected_node_identifier);
+                /*
+                 * An idle selection must not mark its subtree dirty every frame, only a gizmo moving the node does
+                 */
+                if (is_manipulated || ImGuizmo::IsUsing())
+                {
+                    auto delta_transform = glm::inverse(initial_transform) * global_transform;
+                    GraphicScene::SetSceneNodeLocalTransform(m_selected_node_identifier, local_transform * delta_transform);
+                }
 
                 if (ImGuizmo::IsUsing())
                 {
@@ -141,15 +190,16 @@ namespace Tetragrama::Components
 
     void HierarchyViewUIComponent::RenderSceneNodeTree(int32_t node_identifier)
     {
-        if (node_identifier < 0)
+        const auto& scene_hierarchy = *(m_scene_snapshot->Hierarchy);
+        if ((node_identifier < 0) || (node_identifier >= scene_hierarchy.NodeHierarchyCollection.size()))
         {
             return;
         }
 
-        const auto& node_hierarchy         = GraphicScene::GetSceneNodeHierarchy(node_identifier);
-        auto        node_name              = GraphicScene::GetSceneNodeName(node_identifier);
-        auto        node_identifier_string = fmt::format("SceneNode_{0}", node_identifier);
-        auto        flags                  = (node_hierarchy.FirstChild < 0) ? (ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_Bullet | m_node_flag) : m_node_flag;
+        const auto&      node_hierarchy         = scene_hierarchy.NodeHierarchyCollection[node_identifier];
+        std::string_view node_name              = scene_hierarchy.SceneNodeNameCollection[node_identifier];
+        auto             node_identifier_string = fmt::format("SceneNode_{0}", node_identifier);
+        auto             flags                  = (node_hierarchy.FirstChild < 0) ? (ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_Bullet | m_node_flag) : m_node_flag;
         flags |= (m_selected_node_identifier == node_identifier) ? ImGuiTreeNodeFlags_Selected : 0;
         auto label          = (!node_name.empty()) ? std::string(node_name) : fmt::format("Node_{0}", node_identifier);
         bool is_node_opened = ImGui::TreeNodeEx(node_identifier_string.c_str(), flags, "%s", label.c_str());
@@ -188,17 +238,18 @@ namespace Tetragrama::Components
             if (request_entity_removal)
             {
                 GraphicScene::RemoveNodeAsync(node_identifier);
+                /*
+                 * The selection may belong to the removed subtree, whose slots are now free
+                 */
+                if ((m_selected_node_identifier != -1) && !GraphicScene::IsSceneNodeAlive(m_selected_node_identifier))
+                {
+                    m_selected_node_identifier = -1;
+                }
             }
 
-            if (node_hierarchy.FirstChild > -1)
+            for (int32_t child = node_hierarchy.FirstChild; child > -1; child = scene_hierarchy.NodeHierarchyCollection[child].RightSibling)
             {
-                auto sibling_scene_node_collection = GraphicScene::GetSceneNodeSiblingCollection(node_hierarchy.FirstChild);
-                // We consider first child as sibling node
-                sibling_scene_node_collection.emplace(std::begin(sibling_scene_node_collection), node_hierarchy.FirstChild);
-                for (auto sibling_identifier : sibling_scene_node_collection)
-                {
-                    RenderSceneNodeTree(sibling_identifier);
-                }
+                RenderSceneNodeTree(child);
             }
 
             ImGui::TreePop();
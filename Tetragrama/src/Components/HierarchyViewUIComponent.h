@@ -17,6 +17,7 @@ namespace Tetragrama::Components {
 
     public:
         std::future<void> EditorCameraAvailableMessageHandlerAsync(Messengers::GenericMessage<ZEngine::Ref<EditorCameraController>>&);
+        std::future<void> SceneNodePickedMessageHandlerAsync(Messengers::GenericMessage<int32_t>&);
 
     protected:
         void         RenderSceneNodeTree(int32_t node_identifier);
@@ -24,11 +25,14 @@ namespace Tetragrama::Components {
         virtual bool OnUIComponentRaised(ZEngine::Components::UI::Event::UIComponentEvent&) override;
 
     private:
-        ImGuiTreeNodeFlags                       m_node_flag;
-        bool                                     m_is_node_opened{false};
-        int                                      m_selected_node_identifier{-1};
-        int                                      m_gizmo_operation{-1};
-        std::mutex                               m_mutex;
-        ZEngine::WeakRef<EditorCameraController> m_active_editor_camera;
+        ImGuiTreeNodeFlags                                      m_node_flag;
+        bool                                                    m_is_node_opened{false};
+        int                                                     m_selected_node_identifier{-1};
+        int                                                     m_gizmo_operation{-1};
+        uint32_t                                                m_hierarchy_revision{0};
+        std::mutex                                              m_mutex;
+        ZEngine::WeakRef<EditorCameraController>                m_active_editor_camera;
+        ZEngine::WeakRef<ZEngine::Rendering::Scenes::Scene>     m_active_scene;
+        ZEngine::Ref<ZEngine::Rendering::Scenes::SceneSnapshot> m_scene_snapshot;
     };
 } // namespace Tetragrama::Components
@@ -93,10 +93,14 @@ namespace Tetragrama::Components
             }
 
             Helpers::DrawEntityComponentControl<NameComponent>("Name", *m_scene_entity, m_node_flag, false,
-                [](NameComponent& component)
+                [this](NameComponent& component)
                 {
                     ImGui::Dummy(ImVec2(0, 3));
-                    Helpers::DrawInputTextControl("Entity name", component.Name, [&component](std::string_view value) { component.Name = value; });
+                    /*
+                     * Renaming goes through the scene, so that its entity name index stays up to date
+                     */
+                    Helpers::DrawInputTextControl("Entity name", component.Name,
+                        [this](std::string_view value) { ZEngine::Rendering::Scenes::GraphicScene::RenameEntityAsync(*m_scene_entity, value); });
                 });
 
             Helpers::DrawEntityComponentControl<TransformComponent>("Transform", *m_scene_entity, m_node_flag, false,
@@ -110,4 +110,9 @@ namespace Tetragrama
     {
         return m_engine_configuration;
     }
+
+    void Editor::SetSceneCullingMode(ZEngine::Rendering::Renderers::SceneCullingMode mode)
+    {
+        m_engine_configuration.RendererConfiguration.CullingMode = mode;
+    }
 } // namespace Tetragrama
@@ -17,6 +17,10 @@ namespace Tetragrama
         void Run();
 
         const ZEngine::EngineConfiguration& GetCurrentEngineConfiguration() const;
+        /*
+         * Must be called before Initialize(), the mode can then be changed from the editor menu
+         */
+        void SetSceneCullingMode(ZEngine::Rendering::Renderers::SceneCullingMode mode);
 
     private:
         ZEngine::EngineConfiguration              m_engine_configuration;
@@ -6,6 +6,16 @@
 int applicationEntryPoint(int argc, char* argv[])
 {
     auto editor = ZEngine::CreateRef<Tetragrama::Editor>();
+    /*
+     * --gpu-culling starts the editor with the scene culled by Resources/Shaders/scene_culling.comp
+     */
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string_view(argv[i]) == "--gpu-culling")
+        {
+            editor->SetSceneCullingMode(ZEngine::Rendering::Renderers::SceneCullingMode::GPU);
+        }
+    }
     editor->Initialize();
     editor->Run();
     return 0;
@@ -35,7 +35,14 @@ namespace Tetragrama::Layers
     void RenderLayer::Update(TimeStep dt)
     {
         m_editor_camera_controller->Update(dt);
-        GraphicScene::ComputeAllTransforms();
+        /*
+         * Frame boundary : a scene loaded in the background replaces the active one before anything reads it
+         */
+        GraphicScene::ActivatePendingScene();
+        /*
+         * Skipped while an import holds the scene, the previous snapshot keeps being drawn
+         */
+        GraphicScene::TryPublishSnapshot();
     }
 
     bool RenderLayer::OnEvent(CoreEvent& e)
@@ -47,7 +54,7 @@ namespace Tetragrama::Layers
     void RenderLayer::Render()
     {
         auto camera = m_editor_camera_controller->GetCamera();
-        GraphicRenderer::DrawScene(camera, GraphicScene::GetRawData());
+        GraphicRenderer::DrawScene(camera, GraphicScene::AcquireSnapshot());
     }
 
     std::future<void> RenderLayer::SceneRequestResizeMessageHandlerAsync(Messengers::GenericMessage<std::pair<float, float>>& message)
@@ -56,6 +63,7 @@ namespace Tetragrama::Layers
 
         const auto& value = message.GetValue();
         m_editor_camera_controller->SetViewport(value.first, value.second);
+        m_viewport_size = glm::vec2(value.first, value.second);
         co_return;
     }
 
@@ -159,10 +167,26 @@ namespace Tetragrama::Layers
 
     std::future<void> RenderLayer::SceneRequestSelectEntityFromPixelMessageHandlerAsync(Messengers::GenericMessage<std::pair<int, int>>& mouse_position)
     {
-        // const auto& value  = mouse_position.GetValue();
-        // auto        entity = m_scene->GetEntity(value.first, value.second);
-        // ZENGINE_EDITOR_INFO("Mouse Pos: X={} -- Y={}", value.first, value.second)
-        co_return;
+        glm::vec2 viewport_size;
+        {
+            std::unique_lock lock(m_message_handler_mutex);
+            viewport_size = m_viewport_size;
+        }
+
+        if ((viewport_size.x <= 0.0f) || (viewport_size.y <= 0.0f))
+        {
+            co_return;
+        }
+        /*
+         * Picking is a CPU ray cast against the scene bounding volume hierarchies, nothing is rendered nor read back from the GPU
+         */
+        const auto& value  = mouse_position.GetValue();
+        auto        camera = m_editor_camera_controller->GetCamera();
+        auto        ray    = Helpers::UnprojectViewportPosition(glm::vec2(value.first, value.second), viewport_size, camera->GetViewMatrix(), camera->GetPerspectiveMatrix());
+        auto        hit    = GraphicScene::RaycastSceneNodes(ray);
+
+        co_await Messengers::IMessenger::SendAsync<ZEngine::Components::UI::UIComponent, Messengers::GenericMessage<int32_t>>(
+            EDITOR_RENDER_LAYER_SCENE_NODE_PICKED, Messengers::GenericMessage<int32_t>{hit.SceneNode});
     }
 
     void RenderLayer::HandleNewSceneMessage(const Messengers::EmptyMessage&)
@@ -47,6 +47,7 @@ namespace Tetragrama::Layers
         std::mutex                                                 m_message_handler_mutex;
         std::mutex                                                 m_mutex;
         std::queue<std::pair<float, float>>                        m_viewport_requested_size_collection;
+        glm::vec2                                                  m_viewport_size{0.0f, 0.0f};
 
     private:
         void HandleNewSceneMessage(const Messengers::EmptyMessage&);
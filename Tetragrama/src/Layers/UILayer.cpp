@@ -69,6 +69,13 @@ namespace Tetragrama::Layers
             EDITOR_RENDER_LAYER_CAMERA_CONTROLLER_AVAILABLE,
             m_hierarchy_view_component.get(),
             return m_hierarchy_view_component->EditorCameraAvailableMessageHandlerAsync(*message_ptr))
+
+        MESSENGER_REGISTER(
+            ZEngine::Components::UI::UIComponent,
+            GenericMessage<int32_t>,
+            EDITOR_RENDER_LAYER_SCENE_NODE_PICKED,
+            m_hierarchy_view_component.get(),
+            return m_hierarchy_view_component->SceneNodePickedMessageHandlerAsync(*message_ptr))
         /*
          *  Register Inspector Component
          */
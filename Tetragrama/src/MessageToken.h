@@ -15,6 +15,7 @@ namespace Tetragrama
     static const std::string_view EDITOR_RENDER_LAYER_SCENE_REQUEST_RESIZE                      = "editor::render_layer::scene::request::resize";
     static const std::string_view EDITOR_RENDER_LAYER_SCENE_REQUEST_FOCUS                       = "editor::render_layer::scene::request::focus";
     static const std::string_view EDITOR_RENDER_LAYER_SCENE_REQUEST_SELECT_ENTITY_FROM_PIXEL    = "editor::render_layer::scene::request::select_entity_from_pixel";
+    static const std::string_view EDITOR_RENDER_LAYER_SCENE_NODE_PICKED                         = "editor::render_layer::scene::node_picked";
     static const std::string_view EDITOR_RENDER_LAYER_SCENE_REQUEST_UNFOCUS                     = "editor::render_layer::scene::request::unfocus";
     static const std::string_view EDITOR_RENDER_LAYER_SCENE_AVAILABLE                           = "editor::render_layer::scene::available";
     static const std::string_view EDITOR_RENDER_LAYER_SCENE_REQUEST_SERIALIZATION               = "editor::render_layer::scene::request::serialization";
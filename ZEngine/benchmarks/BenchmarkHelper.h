@@ -0,0 +1,45 @@
+#pragma once
+#include <chrono>
+#include <iostream>
+#include <string_view>
+
+namespace ZEngine::Benchmarks
+{
+    /*
+     * Runs the callable `iterations` times and returns the mean duration in milliseconds
+     */
+    template <typename F>
+    double MeasureMilliseconds(F&& f, uint32_t iterations = 1)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            f();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count() / static_cast<double>(iterations);
+    }
+
+    inline void Report(std::string_view name, double milliseconds)
+    {
+        std::cout << "[ BENCHMARK ] " << name << " : " << milliseconds << " ms" << std::endl;
+    }
+
+    /*
+     * Reports a measured quantity other than a duration (cache miss ratio, culled count...)
+     */
+    inline void Report(std::string_view name, std::string_view statistic)
+    {
+        std::cout << "[ BENCHMARK ] " << name << " : " << statistic << std::endl;
+    }
+
+    /*
+     * Prevents the compiler from discarding a computed value
+     */
+    template <typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+        static const void* volatile sink;
+        sink = &value;
+    }
+} // namespace ZEngine::Benchmarks
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <fmt/format.h>
+#include <Helpers/BoundingVolumeHierarchy.h>
+#include "BenchmarkHelper.h"
+
+using namespace ZEngine::Benchmarks;
+using namespace ZEngine::Helpers;
+
+/*
+ * Node bounds spread over a cube whose volume grows with the node count, so that the density (and the query selectivity) stays the same
+ */
+static std::vector<AABB> GenerateNodeBounds(uint32_t count)
+{
+    const float                           half_size = 5.0f * std::cbrt((float) count);
+    std::mt19937                          generator(7);
+    std::uniform_real_distribution<float> position(-half_size, half_size);
+
+    std::vector<AABB> bounds(count);
+    for (auto& box : bounds)
+    {
+        glm::vec3 center(position(generator), position(generator), position(generator));
+        box.Min = center - glm::vec3(1.0f);
+        box.Max = center + glm::vec3(1.0f);
+    }
+    return bounds;
+}
+
+TEST(BoundingVolumeHierarchyBenchmark, BuildRefitQuery)
+{
+    for (uint32_t node_count : {10'000u, 100'000u, 1'000'000u})
+    {
+        auto bounds = GenerateNodeBounds(node_count);
+
+        BoundingVolumeHierarchy bvh;
+        double                  build_time = MeasureMilliseconds([&] { bvh.Build(bounds.data(), node_count); });
+        /*
+         * 5% of the nodes move every frame
+         */
+        std::vector<uint32_t> moved_nodes;
+        for (uint32_t i = 0; i < node_count; i += 20)
+        {
+            moved_nodes.push_back(i);
+        }
+        for (uint32_t node : moved_nodes)
+        {
+            bounds[node].Min += glm::vec3(0.5f);
+            bounds[node].Max += glm::vec3(0.5f);
+        }
+
+        double partial_refit_time = MeasureMilliseconds([&] { bvh.Refit(bounds.data(), moved_nodes.data(), moved_nodes.size()); });
+        double full_refit_time    = MeasureMilliseconds([&] { bvh.Refit(bounds.data()); }, 10);
+
+        const AABB            query = {.Min = glm::vec3(-20.0f), .Max = glm::vec3(20.0f)};
+        std::vector<uint32_t> primitives;
+        double                query_time = MeasureMilliseconds(
+            [&] {
+                primitives.clear();
+                bvh.QueryOverlap(query, bounds.data(), primitives);
+            },
+            100);
+
+        double linear_query_time = MeasureMilliseconds(
+            [&] {
+                primitives.clear();
+                for (uint32_t i = 0; i < node_count; ++i)
+                {
+                    if (bounds[i].Overlaps(query))
+                    {
+                        primitives.push_back(i);
+                    }
+                }
+            },
+            10);
+        DoNotOptimize(primitives);
+
+        Report(fmt::format("build ({} nodes)", node_count), build_time);
+        Report(fmt::format("refit, 5% moved nodes ({} nodes)", node_count), partial_refit_time);
+        Report(fmt::format("refit, all nodes ({} nodes)", node_count), full_refit_time);
+        Report(fmt::format("overlap query, {} hits ({} nodes)", primitives.size(), node_count), query_time);
+        Report(fmt::format("overlap query, linear scan ({} nodes)", node_count), linear_query_time);
+    }
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <Rendering/Scenes/GraphicScene.h>
+#include <Rendering/Components/NameComponent.h>
+#include <Rendering/Components/UUIComponent.h>
+#include <fmt/format.h>
+#include "BenchmarkHelper.h"
+
+using namespace ZEngine::Benchmarks;
+using namespace ZEngine::Rendering::Scenes;
+using namespace ZEngine::Rendering::Components;
+
+constexpr uint32_t EntityCount = 200'000;
+constexpr uint32_t LookupCount = 1'000;
+
+TEST(EntityLookupBenchmark, NameAndUUIDLookup)
+{
+    auto scene = ZEngine::CreateRef<Scene>();
+    scene->Initialize();
+
+    std::vector<uuids::uuid> uuid_collection;
+    uuid_collection.reserve(EntityCount);
+    for (uint32_t i = 0; i < EntityCount; ++i)
+    {
+        auto entity = scene->CreateEntityAsync(fmt::format("Entity_{0}", i)).get();
+        uuid_collection.push_back(entity.GetComponent<UUIComponent>().Identifier);
+    }
+
+    /*
+     * Lookups are spread over the whole entity range, so that the linear scan is measured on its average case
+     */
+    auto                     registry = scene->GetRegistry();
+    std::vector<std::string> names;
+    names.reserve(LookupCount);
+    for (uint32_t i = 0; i < LookupCount; ++i)
+    {
+        names.push_back(fmt::format("Entity_{0}", (i * 7919) % EntityCount));
+    }
+
+    double name_scan_time = MeasureMilliseconds([&] {
+        for (const auto& name : names)
+        {
+            entt::entity entity_handle{entt::null};
+            auto         views = registry->view<NameComponent>();
+            for (auto entity : views)
+            {
+                if (views.get<NameComponent>(entity).Name == name)
+                {
+                    entity_handle = entity;
+                    break;
+                }
+            }
+            DoNotOptimize(entity_handle);
+        }
+    });
+
+    double uuid_scan_time = MeasureMilliseconds([&] {
+        for (uint32_t i = 0; i < LookupCount; ++i)
+        {
+            const auto&  uuid = uuid_collection[(i * 7919) % EntityCount];
+            entt::entity entity_handle{entt::null};
+            auto         views = registry->view<UUIComponent>();
+            for (auto entity : views)
+            {
+                if (views.get<UUIComponent>(entity).Identifier == uuid)
+                {
+                    entity_handle = entity;
+                    break;
+                }
+            }
+            DoNotOptimize(entity_handle);
+        }
+    });
+
+    double name_index_time = MeasureMilliseconds([&] {
+        for (const auto& name : names)
+        {
+            auto entity = scene->GetEntityAsync(name).get();
+            DoNotOptimize(entity);
+        }
+    });
+
+    double uuid_index_time = MeasureMilliseconds([&] {
+        for (uint32_t i = 0; i < LookupCount; ++i)
+        {
+            auto entity = scene->GetEntityAsync(uuid_collection[(i * 7919) % EntityCount]).get();
+            DoNotOptimize(entity);
+        }
+    });
+
+    for (uint32_t i = 0; i < LookupCount; ++i)
+    {
+        auto entity = scene->GetEntityAsync(uuid_collection[i]).get();
+        ASSERT_EQ(entity.GetComponent<UUIComponent>().Identifier, uuid_collection[i]);
+    }
+
+    Report("1k name lookups, registry scan (200k entities)", name_scan_time);
+    Report("1k name lookups, name index (200k entities)", name_index_time);
+    Report("1k UUID lookups, registry scan (200k entities)", uuid_scan_time);
+    Report("1k UUID lookups, UUID index (200k entities)", uuid_index_time);
+
+    scene->Deinitialize();
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <fmt/format.h>
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/gtc/matrix_transform.hpp>
+#include <Helpers/FrustumCulling.h>
+#include <Helpers/ThreadPool.h>
+#include "BenchmarkHelper.h"
+
+using namespace ZEngine::Benchmarks;
+using namespace ZEngine::Helpers;
+
+TEST(FrustumCullingBenchmark, Throughput)
+{
+    const uint32_t mesh_count = 1'000'000;
+    const uint32_t chunk_size = 1024;
+    const uint32_t iterations = 10;
+
+    /*
+     * Meshes spread all around the camera, roughly 1 in 6 ends up visible as in large interiors
+     */
+    std::mt19937                          generator(42);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::vector<AABB>                     bounds(mesh_count);
+    for (auto& box : bounds)
+    {
+        glm::vec3 center(position(generator), position(generator), position(generator));
+        box = {.Min = center - glm::vec3(1.0f), .Max = center + glm::vec3(1.0f)};
+    }
+
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+    const Frustum   frustum    = ExtractFrustum(projection * view);
+
+    std::vector<uint8_t> visibility(mesh_count);
+    uint32_t             visible_count = 0;
+
+    const std::pair<SimdBackend, const char*> backends[] = {
+        {SimdBackend::SCALAR, "scalar"},
+        {SimdBackend::SSE4, "sse4"},
+        {SimdBackend::AVX2, "avx2"},
+    };
+    for (const auto& [backend, name] : backends)
+    {
+        if (!IsSimdBackendSupported(backend))
+        {
+            continue;
+        }
+
+        double time = MeasureMilliseconds([&] { visible_count = CullAABBBatch(backend, frustum, bounds.data(), mesh_count, visibility.data()); }, iterations);
+        Report(fmt::format("{} culling, {} of {} visible", name, visible_count, mesh_count), time);
+    }
+
+    const uint32_t chunk_count   = (mesh_count + chunk_size - 1) / chunk_size;
+    double         parallel_time = MeasureMilliseconds(
+        [&] {
+            ThreadPoolHelper::ParallelFor(chunk_count, [&](uint32_t begin, uint32_t end) {
+                for (uint32_t chunk = begin; chunk < end; ++chunk)
+                {
+                    const uint32_t first_mesh = chunk * chunk_size;
+                    CullAABBBatch(frustum, bounds.data() + first_mesh, std::min(chunk_size, mesh_count - first_mesh), visibility.data() + first_mesh);
+                }
+            });
+        },
+        iterations);
+    Report(fmt::format("multithreaded culling ({} chunks of {})", chunk_count, chunk_size), parallel_time);
+    DoNotOptimize(visibility);
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include <fmt/format.h>
+#include <Helpers/MatrixBatch.h>
+#include "BenchmarkHelper.h"
+
+using namespace ZEngine::Benchmarks;
+using namespace ZEngine::Helpers;
+
+TEST(MatrixBatchBenchmark, Throughput)
+{
+    const uint32_t parent_count = 1024;
+    const uint32_t child_count  = 1'000'000;
+    const uint32_t iterations   = 10;
+
+    std::vector<glm::mat4> local(parent_count + child_count, glm::mat4(1.0f));
+    std::vector<glm::mat4> global(parent_count + child_count, glm::mat4(2.0f));
+    std::vector<int32_t>   parent_indices(child_count);
+    std::vector<uint32_t>  node_indices(child_count);
+    for (uint32_t i = 0; i < child_count; ++i)
+    {
+        parent_indices[i] = i % parent_count;
+        node_indices[i]   = parent_count + i;
+    }
+
+    /*
+     * glm operator* one node at a time : the previous ComputeAllTransforms inner loop
+     */
+    double glm_time = MeasureMilliseconds(
+        [&] {
+            for (uint32_t i = 0; i < child_count; ++i)
+            {
+                global[node_indices[i]] = global[parent_indices[i]] * local[node_indices[i]];
+            }
+        },
+        iterations);
+    Report(fmt::format("glm operator* ({:.1f} M matrices/s)", (child_count / (glm_time * 1e3))), glm_time);
+
+    const std::pair<SimdBackend, const char*> backends[] = {
+        {SimdBackend::SCALAR, "scalar"},
+        {SimdBackend::SSE4, "sse4"},
+        {SimdBackend::AVX2, "avx2"},
+    };
+    for (const auto& [backend, name] : backends)
+    {
+        if (!IsSimdBackendSupported(backend))
+        {
+            continue;
+        }
+
+        double time = MeasureMilliseconds(
+            [&] {
+                MultiplyHierarchyTransformBatch(backend, parent_indices.data(), node_indices.data(), local.data(), global.data(), child_count);
+            },
+            iterations);
+        Report(fmt::format("MultiplyHierarchyTransformBatch {} ({:.1f} M matrices/s)", name, (child_count / (time * 1e3))), time);
+    }
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <fmt/format.h>
+#include <Rendering/Meshes/MeshOptimizer.h>
+#include "BenchmarkHelper.h"
+
+using namespace ZEngine::Benchmarks;
+using namespace ZEngine::Rendering::Meshes;
+
+/*
+ * Height field of grid_size x grid_size quads with the 8 floats stride of the scene vertices. Triangles and vertices are shuffled,
+ * as a mesh written without any care for the caches
+ */
+static void GenerateShuffledTerrain(uint32_t grid_size, std::vector<float>& vertices, std::vector<uint32_t>& indices)
+{
+    const uint32_t row_size     = grid_size + 1;
+    const uint32_t vertex_count = row_size * row_size;
+    std::mt19937   generator(17);
+
+    std::vector<uint32_t> permutation(vertex_count);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), generator);
+
+    vertices.resize((size_t) vertex_count * 8);
+    for (uint32_t z = 0; z < row_size; ++z)
+    {
+        for (uint32_t x = 0; x < row_size; ++x)
+        {
+            const float height = 4.0f * std::sin(x * 0.05f) * std::cos(z * 0.03f);
+            float*      vertex = vertices.data() + (size_t) permutation[(z * row_size) + x] * 8;
+            std::copy_n(std::array<float, 8>{(float) x, height, (float) z, 0.0f, 1.0f, 0.0f, (float) x, (float) z}.begin(), 8, vertex);
+        }
+    }
+
+    std::vector<std::array<uint32_t, 3>> triangles;
+    triangles.reserve((size_t) grid_size * grid_size * 2);
+    for (uint32_t z = 0; z < grid_size; ++z)
+    {
+        for (uint32_t x = 0; x < grid_size; ++x)
+        {
+            const uint32_t corner = (z * row_size) + x;
+            triangles.push_back({permutation[corner], permutation[corner + row_size], permutation[corner + 1]});
+            triangles.push_back({permutation[corner + 1], permutation[corner + row_size], permutation[corner + row_size + 1]});
+        }
+    }
+    std::shuffle(triangles.begin(), triangles.end(), generator);
+
+    indices.reserve(triangles.size() * 3);
+    for (const auto& triangle : triangles)
+    {
+        indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+}
+
+static void ReportStatistics(std::string_view name, const std::vector<uint32_t>& indices, uint32_t vertex_count)
+{
+    for (uint32_t cache_size : {8u, 16u, 32u})
+    {
+        const VertexCacheStatistics statistics = AnalyzeVertexCache(indices, vertex_count, cache_size);
+        Report(name, fmt::format("FIFO cache of {} vertices, ACMR {:.3f}, ATVR {:.3f}", cache_size, statistics.GetACMR(), statistics.GetATVR()));
+    }
+    Report(name, fmt::format("vertex overfetch {:.3f}", AnalyzeVertexFetch(indices, vertex_count, 8 * sizeof(float)).GetOverfetch()));
+}
+
+/*
+ * Reads every vertex through the index buffer as final_color.vert does, on the CPU caches
+ */
+static float PullVertices(const std::vector<uint32_t>& indices, const std::vector<float>& vertices)
+{
+    float sum = 0.0f;
+    for (uint32_t index : indices)
+    {
+        const float* vertex = vertices.data() + (size_t) index * 8;
+        sum += vertex[0] + vertex[1] + vertex[2] + vertex[6];
+    }
+    return sum;
+}
+
+TEST(MeshOptimizerBenchmark, ImportOptimizationPasses)
+{
+    const uint32_t grid_size = 1024;
+
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateShuffledTerrain(grid_size, vertices, indices);
+    const auto vertex_count = (uint32_t) (vertices.size() / 8);
+    ReportStatistics(fmt::format("shuffled terrain ({} triangles)", indices.size() / 3), indices, vertex_count);
+
+    float pulled_sum = 0.0f;
+    Report("vertex pulling, shuffled", MeasureMilliseconds([&] { pulled_sum += PullVertices(indices, vertices); }, 10));
+
+    Report("vertex cache optimization", MeasureMilliseconds([&] { OptimizeVertexCache(indices, vertex_count); }));
+    ReportStatistics("vertex cache optimized", indices, vertex_count);
+
+    Report("overdraw optimization", MeasureMilliseconds([&] { OptimizeOverdraw(indices, vertices.data(), vertex_count, 8, 1.05f); }));
+    ReportStatistics("overdraw optimized", indices, vertex_count);
+
+    Report("vertex fetch optimization", MeasureMilliseconds([&] { OptimizeVertexFetch(indices, vertices, 8); }));
+    ReportStatistics("vertex fetch optimized", indices, vertex_count);
+
+    Report("vertex pulling, optimized", MeasureMilliseconds([&] { pulled_sum += PullVertices(indices, vertices); }, 10));
+    DoNotOptimize(pulled_sum);
+}
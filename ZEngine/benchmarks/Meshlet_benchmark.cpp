@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <fmt/format.h>
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/gtc/matrix_transform.hpp>
+#include <Rendering/Meshes/MeshOptimizer.h>
+#include <Rendering/Meshes/MeshletBuilder.h>
+#include <Rendering/Renderers/SceneRenderer.h>
+#include "BenchmarkHelper.h"
+
+using namespace ZEngine::Benchmarks;
+using namespace ZEngine::Helpers;
+using namespace ZEngine::Rendering::Meshes;
+using namespace ZEngine::Rendering::Renderers;
+
+/*
+ * Unit UV sphere with the 8 floats stride of the scene vertices, triangles wound counter-clockwise seen from outside
+ */
+static void GenerateSphere(uint32_t segment_count, uint32_t ring_count, std::vector<float>& vertices, std::vector<uint32_t>& indices)
+{
+    for (uint32_t ring = 0; ring <= ring_count; ++ring)
+    {
+        const float theta = glm::pi<float>() * ring / ring_count;
+        for (uint32_t segment = 0; segment <= segment_count; ++segment)
+        {
+            const float     phi = glm::two_pi<float>() * segment / segment_count;
+            const glm::vec3 p(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+            vertices.insert(vertices.end(), {p.x, p.y, p.z, p.x, p.y, p.z, (float) segment / segment_count, (float) ring / ring_count});
+        }
+    }
+
+    const uint32_t row_size = segment_count + 1;
+    for (uint32_t ring = 0; ring < ring_count; ++ring)
+    {
+        for (uint32_t segment = 0; segment < segment_count; ++segment)
+        {
+            const uint32_t corner = (ring * row_size) + segment;
+            if (ring > 0)
+            {
+                indices.insert(indices.end(), {corner, corner + 1, corner + row_size});
+            }
+            if (ring < (ring_count - 1))
+            {
+                indices.insert(indices.end(), {corner + 1, corner + row_size + 1, corner + row_size});
+            }
+        }
+    }
+}
+
+TEST(MeshletBenchmark, BuildAndCull)
+{
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateSphere(1024, 512, vertices, indices);
+    const auto vertex_count   = (uint32_t) (vertices.size() / 8);
+    const auto triangle_count = (uint32_t) (indices.size() / 3);
+    OptimizeVertexCache(indices, vertex_count);
+
+    std::vector<Meshlet> meshlets;
+    Report(fmt::format("meshlet build ({} triangles)", triangle_count), MeasureMilliseconds([&] { meshlets = BuildMeshlets(indices.data(), (uint32_t) indices.size(), vertices.data(), vertex_count, 8); }));
+    Report("meshlet build", fmt::format("{} meshlets, {:.1f} triangles per meshlet", meshlets.size(), (float) triangle_count / meshlets.size()));
+    /*
+     * The sphere fills the middle of the view from 3 units away : about half of it faces the camera
+     */
+    const glm::vec3 camera_position(0.0f, 0.0f, 3.0f);
+    const glm::mat4 view       = glm::lookAt(camera_position, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+    const Frustum   frustum    = ExtractFrustum(projection * view);
+    const glm::mat4 transform  = glm::mat4(1.0f);
+
+    std::vector<uint32_t> visible;
+    visible.reserve(meshlets.size());
+    for (bool cone_culling : {false, true})
+    {
+        const double time = MeasureMilliseconds(
+            [&] {
+                visible.clear();
+                CullMeshlets(frustum, meshlets.data(), (uint32_t) meshlets.size(), transform, camera_position, cone_culling, visible);
+            },
+            10);
+
+        uint32_t visible_triangle_count = 0;
+        for (uint32_t meshlet : visible)
+        {
+            visible_triangle_count += meshlets[meshlet].IndexCount / 3;
+        }
+
+        const char* name = cone_culling ? "frustum and cone culling" : "frustum culling";
+        Report(name, time);
+        Report(name, fmt::format("{} / {} meshlets, {} / {} triangles drawn", visible.size(), meshlets.size(), visible_triangle_count, triangle_count));
+    }
+}
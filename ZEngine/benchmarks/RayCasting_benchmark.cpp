@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <fmt/format.h>
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/gtc/matrix_transform.hpp>
+#include <Helpers/RayCasting.h>
+#include "BenchmarkHelper.h"
+
+using namespace ZEngine::Benchmarks;
+using namespace ZEngine::Helpers;
+
+/*
+ * Height field of grid_size x grid_size quads (2 triangles each), vertices stored with the 8 floats stride of the scene vertices
+ */
+static void GenerateTerrain(uint32_t grid_size, std::vector<float>& vertices, std::vector<uint32_t>& indices)
+{
+    const uint32_t row_size = grid_size + 1;
+    vertices.reserve((size_t) row_size * row_size * 8);
+    for (uint32_t z = 0; z < row_size; ++z)
+    {
+        for (uint32_t x = 0; x < row_size; ++x)
+        {
+            const float height = 4.0f * std::sin(x * 0.05f) * std::cos(z * 0.03f) + std::sin(x * 0.71f + z * 0.37f);
+            vertices.insert(vertices.end(), {(float) x - (grid_size * 0.5f), height, (float) z - (grid_size * 0.5f), 0.0f, 1.0f, 0.0f, 0.0f, 0.0f});
+        }
+    }
+
+    indices.reserve((size_t) grid_size * grid_size * 6);
+    for (uint32_t z = 0; z < grid_size; ++z)
+    {
+        for (uint32_t x = 0; x < grid_size; ++x)
+        {
+            const uint32_t corner = (z * row_size) + x;
+            indices.insert(indices.end(), {corner, corner + row_size, corner + 1, corner + 1, corner + row_size, corner + row_size + 1});
+        }
+    }
+}
+
+TEST(RayCastingBenchmark, PickingLatency)
+{
+    const uint32_t grid_size  = 1024;
+    const uint32_t pick_count = 1000;
+
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateTerrain(grid_size, vertices, indices);
+
+    TriangleBoundingVolumeHierarchy hierarchy;
+    double                          build_time = MeasureMilliseconds([&] { hierarchy.Build(vertices.data(), 8, indices.data(), indices.size()); });
+    Report(fmt::format("triangle hierarchy build ({} triangles)", hierarchy.GetTriangleCount()), build_time);
+    /*
+     * Editor camera looking down at the terrain, each pick is a random viewport position
+     */
+    const glm::vec2 viewport_size(1920.0f, 1080.0f);
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f, 300.0f, 600.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), viewport_size.x / viewport_size.y, 0.1f, 5000.0f);
+
+    std::mt19937                          generator(3);
+    std::uniform_real_distribution<float> viewport_x(0.0f, viewport_size.x);
+    std::uniform_real_distribution<float> viewport_y(0.0f, viewport_size.y);
+    std::vector<Ray>                      ray_collection(pick_count);
+    for (auto& ray : ray_collection)
+    {
+        ray = UnprojectViewportPosition(glm::vec2(viewport_x(generator), viewport_y(generator)), viewport_size, view, projection);
+    }
+
+    const std::pair<SimdBackend, const char*> backends[] = {
+        {SimdBackend::SCALAR, "scalar"},
+        {SimdBackend::SSE4, "sse4"},
+        {SimdBackend::AVX2, "avx2"},
+    };
+    for (const auto& [backend, name] : backends)
+    {
+        if (!IsSimdBackendSupported(backend))
+        {
+            continue;
+        }
+
+        uint32_t hit_count  = 0;
+        double   total_time = MeasureMilliseconds([&] {
+            for (const auto& ray : ray_collection)
+            {
+                RayHit hit = {};
+                hit_count += hierarchy.Raycast(backend, ray, FLT_MAX, hit) ? 1 : 0;
+            }
+        });
+        Report(fmt::format("{} pick, {} of {} rays hit", name, hit_count, pick_count), total_time / pick_count);
+    }
+    /*
+     * Reference : every triangle tested without the hierarchy
+     */
+    TriangleCollection triangles;
+    triangles.Resize(indices.size() / 3);
+    for (uint32_t triangle = 0; triangle < triangles.Count; ++triangle)
+    {
+        auto position = [&vertices](uint32_t vertex) { return glm::vec3(vertices[8 * vertex], vertices[8 * vertex + 1], vertices[8 * vertex + 2]); };
+        triangles.Set(triangle, position(indices[3 * triangle]), position(indices[3 * triangle + 1]), position(indices[3 * triangle + 2]));
+    }
+
+    float  distance         = 0.0f;
+    double brute_force_time = MeasureMilliseconds([&] { IntersectRayTriangleBatch(ray_collection[0], triangles, 0, triangles.Count, FLT_MAX, distance); }, 10);
+    Report("brute force pick", brute_force_time);
+    DoNotOptimize(distance);
+}
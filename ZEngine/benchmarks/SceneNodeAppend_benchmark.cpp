@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <Rendering/Scenes/GraphicScene.h>
+#include "BenchmarkHelper.h"
+
+using namespace ZEngine::Benchmarks;
+using namespace ZEngine::Rendering::Scenes;
+
+/*
+ * CAD exports commonly have a single node holding tens of thousands of children
+ */
+constexpr uint32_t FlatChildCount = 50'000;
+
+/*
+ * Previous AddNodeAsync behavior : the RightSibling chain is walked from FirstChild on every append
+ */
+static void AppendChildBySiblingWalk(std::vector<SceneNodeHierarchy>& hierarchy_collection, int parent)
+{
+    int node = (int) hierarchy_collection.size();
+    hierarchy_collection.push_back({.Parent = parent});
+
+    int& first_child = hierarchy_collection[parent].FirstChild;
+    if (first_child == -1)
+    {
+        first_child = node;
+        return;
+    }
+
+    int sibling = first_child;
+    while (hierarchy_collection[sibling].RightSibling != -1)
+    {
+        sibling = hierarchy_collection[sibling].RightSibling;
+    }
+    hierarchy_collection[sibling].RightSibling = node;
+}
+
+TEST(SceneNodeAppendBenchmark, FlatHierarchyImport)
+{
+    GraphicScene::Initialize();
+
+    double sibling_walk_time = MeasureMilliseconds([] {
+        std::vector<SceneNodeHierarchy> hierarchy_collection = {SceneNodeHierarchy{}};
+        for (uint32_t i = 0; i < FlatChildCount; ++i)
+        {
+            AppendChildBySiblingWalk(hierarchy_collection, 0);
+        }
+        DoNotOptimize(hierarchy_collection);
+    });
+
+    int32_t root          = GraphicScene::AddNodeAsync(-1, 0).get();
+    double  add_node_time = MeasureMilliseconds([root] {
+        for (uint32_t i = 0; i < FlatChildCount; ++i)
+        {
+            GraphicScene::AddNodeAsync(root, 1).get();
+        }
+    });
+    EXPECT_EQ(GraphicScene::GetSceneNodeHierarchy(root).ChildCount, FlatChildCount);
+
+    int32_t bulk_root      = GraphicScene::AddNodeAsync(-1, 0).get();
+    double  add_nodes_time = MeasureMilliseconds([bulk_root] {
+        GraphicScene::AddNodesAsync(bulk_root, 1, FlatChildCount).get();
+    });
+    EXPECT_EQ(GraphicScene::GetSceneNodeHierarchy(bulk_root).ChildCount, FlatChildCount);
+
+    Report("sibling chain walk append, hierarchy only (50k children)", sibling_walk_time);
+    Report("AddNodeAsync (50k children)", add_node_time);
+    Report("AddNodesAsync (50k children)", add_nodes_time);
+}
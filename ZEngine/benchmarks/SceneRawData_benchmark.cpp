@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <Rendering/Scenes/GraphicScene.h>
+#include "BenchmarkHelper.h"
+
+using namespace ZEngine::Benchmarks;
+using namespace ZEngine::Rendering;
+using namespace ZEngine::Rendering::Scenes;
+
+constexpr uint32_t SceneNodeCount = 100'000;
+/*
+ * One node out of two carries a mesh, which is what the importer produces (a node + a mesh sub node)
+ */
+constexpr uint32_t MeshNodeStride = 2;
+
+struct MapSceneData
+{
+    std::map<uint32_t, entt::entity>         SceneNodeEntityMap;
+    std::map<uint32_t, Meshes::MeshVNext>    SceneNodeMeshMap;
+    std::map<uint32_t, std::string>          SceneNodeNameMap;
+    std::map<uint32_t, Meshes::MeshMaterial> SceneNodeMaterialMap;
+    std::vector<glm::mat4>                   GlobalTransformCollection;
+};
+
+static void BuildMapScene(MapSceneData& data)
+{
+    data.GlobalTransformCollection.assign(SceneNodeCount, glm::mat4(1.0f));
+    data.MaterialCollection.emplace_back();
+    data.MaterialNameCollection.emplace_back();
+    for (uint32_t i = 0; i < SceneNodeCount; ++i)
+    {
+        data.SceneNodeEntityMap[i] = static_cast<entt::entity>(i);
+        data.SceneNodeNameMap[i]   = "SceneNode";
+        if ((i % MeshNodeStride) == 0)
+        {
+            data.SceneNodeMeshMap[i]     = Meshes::MeshVNext{.VertexCount = i, .IndexCount = i};
+            data.SceneNodeMaterialMap[i] = Meshes::MeshMaterial{};
+        }
+    }
+}
+
+static void BuildDenseScene(SceneRawData& data)
+{
+    data.GlobalTransformCollection.assign(SceneNodeCount, glm::mat4(1.0f));
+    data.MaterialCollection.emplace_back();
+    data.MaterialNameCollection.emplace_back();
+    for (uint32_t i = 0; i < SceneNodeCount; ++i)
+    {
+        data.SceneNodeEntityCollection.push_back(static_cast<entt::entity>(i));
+        data.SceneNodeNameCollection.emplace_back("SceneNode");
+        data.SceneNodeMeshIndexCollection.push_back(-1);
+        if ((i % MeshNodeStride) == 0)
+        {
+            data.SceneNodeMeshIndexCollection[i] = data.MeshNodeCollection.size();
+            data.MeshNodeCollection.push_back(i);
+            data.MeshCollection.push_back(Meshes::MeshVNext{.VertexCount = i, .IndexCount = i});
+            data.MeshMaterialIndexCollection.push_back(0);
+        }
+    }
+}
+
+TEST(SceneRawDataBenchmark, Build)
+{
+    double map_build_time = MeasureMilliseconds([] {
+        MapSceneData data = {};
+        BuildMapScene(data);
+        DoNotOptimize(data);
+    });
+
+    double dense_build_time = MeasureMilliseconds([] {
+        auto data = ZEngine::CreateRef<SceneRawData>();
+        BuildDenseScene(*data);
+        DoNotOptimize(data);
+    });
+
+    Report("std::map build (100k nodes)", map_build_time);
+    Report("dense build (100k nodes)", dense_build_time);
+}
+
+TEST(SceneRawDataBenchmark, RenderIteration)
+{
+    const uint32_t iterations = 20;
+
+    MapSceneData map_data = {};
+    BuildMapScene(map_data);
+
+    auto dense_data = ZEngine::CreateRef<SceneRawData>();
+    BuildDenseScene(*dense_data);
+
+    /*
+     * Mimics SceneRenderer::RenderScene : gathering transforms, draw data and materials of every mesh node
+     */
+    uint64_t map_checksum       = 0;
+    double   map_iteration_time = MeasureMilliseconds(
+        [&] {
+            std::vector<glm::mat4>            transform_collection = {};
+            std::vector<Meshes::MeshMaterial> material_collection  = {};
+            for (const auto& mesh_pair : map_data.SceneNodeMeshMap)
+            {
+                transform_collection.push_back(map_data.GlobalTransformCollection[mesh_pair.first]);
+                material_collection.push_back(map_data.SceneNodeMaterialMap[mesh_pair.first]);
+                map_checksum += mesh_pair.second.IndexCount;
+            }
+            DoNotOptimize(transform_collection);
+            DoNotOptimize(material_collection);
+        },
+        iterations);
+
+    uint64_t dense_checksum       = 0;
+    double   dense_iteration_time = MeasureMilliseconds(
+        [&] {
+            const auto&            mesh_node_collection = dense_data->MeshNodeCollection;
+            std::vector<glm::mat4> transform_collection(mesh_node_collection.size());
+            for (uint32_t i = 0; i < mesh_node_collection.size(); ++i)
+            {
+                transform_collection[i] = dense_data->GlobalTransformCollection[mesh_node_collection[i]];
+                dense_checksum += dense_data->MeshCollection[i].IndexCount;
+            }
+            DoNotOptimize(transform_collection);
+            DoNotOptimize(dense_data->MeshMaterialIndexCollection);
+        },
+        iterations);
+
+    EXPECT_EQ(map_checksum, dense_checksum);
+
+    Report("std::map render iteration (100k nodes)", map_iteration_time);
+    Report("dense render iteration (100k nodes)", dense_iteration_time);
+}
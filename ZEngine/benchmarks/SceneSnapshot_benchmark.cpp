@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <Rendering/Scenes/GraphicScene.h>
+#include <thread>
+#include <atomic>
+#include "BenchmarkHelper.h"
+
+using namespace ZEngine::Benchmarks;
+using namespace ZEngine::Rendering::Scenes;
+
+/*
+ * The writer thread stands for the asset importer : it holds the scene for the whole duration of each batch
+ */
+constexpr uint32_t ImportBatchCount     = 8;
+constexpr uint32_t ImportBatchNodeCount = 25'000;
+
+/*
+ * Runs `frame` in a loop while the writer thread imports, and returns the worst frame time in milliseconds
+ */
+template <typename F>
+static double MeasureWorstFrameDuringImport(F&& frame)
+{
+    std::atomic_bool is_importing = true;
+    int32_t          root         = GraphicScene::AddNodeAsync(-1, 0).get();
+
+    std::thread writer([root, &is_importing] {
+        for (uint32_t i = 0; i < ImportBatchCount; ++i)
+        {
+            GraphicScene::AddNodesAsync(root, 1, ImportBatchNodeCount).get();
+        }
+        is_importing = false;
+    });
+
+    double worst_frame_time = 0.0;
+    while (is_importing)
+    {
+        worst_frame_time = std::max(worst_frame_time, MeasureMilliseconds(frame));
+    }
+    writer.join();
+    return worst_frame_time;
+}
+
+TEST(SceneSnapshotBenchmark, FrameTimeDuringImport)
+{
+    GraphicScene::Initialize();
+
+    double locking_frame_time = MeasureWorstFrameDuringImport([] {
+        GraphicScene::ComputeAllTransforms();
+        auto scene_data = GraphicScene::GetRawData();
+        DoNotOptimize(scene_data->GlobalTransformCollection);
+    });
+
+    double snapshot_frame_time = MeasureWorstFrameDuringImport([] {
+        GraphicScene::TryPublishSnapshot();
+        auto scene_snapshot = GraphicScene::AcquireSnapshot();
+        DoNotOptimize(scene_snapshot->MeshTransformCollection);
+    });
+
+    Report("worst frame, scene mutex (200k nodes imported in background)", locking_frame_time);
+    Report("worst frame, published snapshot (200k nodes imported in background)", snapshot_frame_time);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <fmt/format.h>
+#include <Rendering/Scenes/GraphicScene.h>
+#include "BenchmarkHelper.h"
+
+using namespace ZEngine::Benchmarks;
+using namespace ZEngine::Rendering::Scenes;
+
+/*
+ * 1 root -> 16 -> 256 -> 4096 -> 65536 nodes : a gizmo drag on the root dirties the whole hierarchy
+ */
+constexpr uint32_t HierarchyFanOut = 16;
+constexpr uint32_t HierarchyDepth  = 4;
+
+static void BuildHierarchy()
+{
+    std::vector<int32_t> current_level = {GraphicScene::AddNodeAsync(-1, 0).get()};
+    for (uint32_t depth = 1; depth <= HierarchyDepth; ++depth)
+    {
+        std::vector<int32_t> next_level = {};
+        for (int32_t parent : current_level)
+        {
+            for (uint32_t i = 0; i < HierarchyFanOut; ++i)
+            {
+                int32_t node                                   = GraphicScene::AddNodeAsync(parent, depth).get();
+                GraphicScene::GetSceneNodeLocalTransform(node) = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 0.5f, 0.25f));
+                next_level.push_back(node);
+            }
+        }
+        current_level = std::move(next_level);
+    }
+}
+
+static void MarkAllSceneNodesAsChanged()
+{
+    const auto& hierarchy_collection = GraphicScene::GetRawData()->NodeHierarchyCollection;
+    for (int32_t node = 0; node < hierarchy_collection.size(); ++node)
+    {
+        GraphicScene::MarkSceneNodeAsChanged(node);
+    }
+}
+
+TEST(SceneTransformBenchmark, ComputeAllTransformsScaling)
+{
+    const uint32_t iterations = 10;
+
+    GraphicScene::Initialize();
+    BuildHierarchy();
+
+    auto                   raw_data             = GraphicScene::GetRawData();
+    std::vector<glm::mat4> reference_transforms = {};
+
+    for (uint32_t worker_count : {1u, 2u, 4u, 8u})
+    {
+        GraphicScene::SetTransformWorkerCount(worker_count);
+
+        double total_time = 0.0;
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            MarkAllSceneNodesAsChanged();
+            total_time += MeasureMilliseconds([] {
+                GraphicScene::ComputeAllTransforms();
+            });
+        }
+
+        if (reference_transforms.empty())
+        {
+            reference_transforms = raw_data->GlobalTransformCollection;
+        }
+        else
+        {
+            EXPECT_EQ(reference_transforms, raw_data->GlobalTransformCollection);
+        }
+
+        Report(fmt::format("ComputeAllTransforms ({} nodes, {} threads)", raw_data->NodeHierarchyCollection.size(), worker_count), total_time / iterations);
+    }
+
+    GraphicScene::SetTransformWorkerCount(std::thread::hardware_concurrency());
+}
@@ -1,14 +1,16 @@
 #pragma once
 #include <Logging/LoggerConfiguration.h>
 #include <Window/WindowConfiguration.h>
+#include <Rendering/Renderers/RendererConfiguration.h>
 
 namespace ZEngine
 {
 
     struct EngineConfiguration
     {
-        Logging::LoggerConfiguration LoggerConfiguration;
-        Window::WindowConfiguration  WindowConfiguration;
+        Logging::LoggerConfiguration                LoggerConfiguration;
+        Window::WindowConfiguration                 WindowConfiguration;
+        Rendering::Renderers::RendererConfiguration RendererConfiguration;
     };
 
 } // namespace ZEngine
@@ -84,6 +84,7 @@ namespace ZEngine::Hardwares
         static const VkPhysicalDeviceMemoryProperties& GetPhysicalDeviceMemoryProperties();
         static VkDevice                                GetNativeDeviceHandle();
         static VkInstance                              GetNativeInstanceHandle();
+        static bool                                    IsDrawIndirectCountSupported();
 
         static bool QueueSubmit(
             Rendering::QueueType                    queue_type,
@@ -122,7 +123,7 @@ namespace ZEngine::Hardwares
 
         static void        MapAndCopyToMemory(BufferView& buffer, size_t data_size, const void* data);
         static BufferView  CreateBuffer(VkDeviceSize byte_size, VkBufferUsageFlags buffer_usage, VmaAllocationCreateFlags vma_create_flags = 0);
-        static void        CopyBuffer(const BufferView& source, const BufferView& destination, VkDeviceSize byte_size);
+        static void        CopyBuffer(const BufferView& source, const BufferView& destination, VkDeviceSize byte_size, VkDeviceSize destination_offset = 0);
         static BufferImage CreateImage(
             uint32_t              width,
             uint32_t              height,
@@ -169,6 +170,7 @@ namespace ZEngine::Hardwares
         static VkPhysicalDevice                                                                 s_physical_device;
         static VkPhysicalDeviceProperties                                                       s_physical_device_properties;
         static VkPhysicalDeviceFeatures                                                         s_physical_device_feature;
+        static bool                                                                             s_draw_indirect_count_supported;
         static VkPhysicalDeviceMemoryProperties                                                 s_physical_device_memory_properties;
         static VkDebugUtilsMessengerEXT                                                         s_debug_messenger;
         static std::map<uint32_t, std::vector<DirtyResource>>                                   s_deletion_resource_queue;
@@ -0,0 +1,178 @@
+#pragma once
+#include <cstdint>
+#include <cfloat>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ZEngine::Helpers
+{
+    /*
+     * Axis aligned bounding box. The default box is empty (Min > Max) and growing it by any point or box makes it valid
+     */
+    struct AABB
+    {
+        glm::vec3 Min{FLT_MAX};
+        glm::vec3 Max{-FLT_MAX};
+
+        bool IsEmpty() const
+        {
+            return (Min.x > Max.x) || (Min.y > Max.y) || (Min.z > Max.z);
+        }
+
+        void Grow(const glm::vec3& point)
+        {
+            Min = glm::min(Min, point);
+            Max = glm::max(Max, point);
+        }
+
+        void Grow(const AABB& box)
+        {
+            Min = glm::min(Min, box.Min);
+            Max = glm::max(Max, box.Max);
+        }
+
+        glm::vec3 GetCenter() const
+        {
+            return (Min + Max) * 0.5f;
+        }
+
+        float GetSurfaceArea() const
+        {
+            if (IsEmpty())
+            {
+                return 0.0f;
+            }
+            const glm::vec3 extent = Max - Min;
+            return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+        }
+
+        /*
+         * Squared distance from `point` to the closest point of the box, 0 when the point is inside
+         */
+        float GetDistanceSquared(const glm::vec3& point) const
+        {
+            const glm::vec3 offset = glm::max(glm::max(Min - point, point - Max), glm::vec3(0.0f));
+            return glm::dot(offset, offset);
+        }
+
+        bool Overlaps(const AABB& box) const
+        {
+            return (Min.x <= box.Max.x) && (Max.x >= box.Min.x) && (Min.y <= box.Max.y) && (Max.y >= box.Min.y) && (Min.z <= box.Max.z) && (Max.z >= box.Min.z);
+        }
+
+        bool operator==(const AABB& rhs) const
+        {
+            return (Min == rhs.Min) && (Max == rhs.Max);
+        }
+
+        bool operator!=(const AABB& rhs) const
+        {
+            return !(*this == rhs);
+        }
+    };
+
+    /*
+     * Bounds of `box` once transformed by `transform`, computed from the box center and extents (Arvo)
+     */
+    AABB TransformAABB(const AABB& box, const glm::mat4& transform);
+
+    /*
+     * BVH node : leaves reference PrimitiveCount primitives starting at FirstIndex in the primitive index collection,
+     * inner nodes (PrimitiveCount == 0) have their two children stored at FirstIndex and FirstIndex + 1.
+     * Children are always stored after their parent
+     */
+    struct BoundingVolumeNode
+    {
+        AABB     Bounds;
+        uint32_t FirstIndex{0};
+        uint32_t PrimitiveCount{0};
+    };
+
+    /*
+     * Bounding volume hierarchy over a flat collection of primitive bounds, built with a binned SAH.
+     * Moving primitives are handled by refitting the node bounds in place, the tree topology only changes with Build().
+     */
+    class BoundingVolumeHierarchy
+    {
+    public:
+        BoundingVolumeHierarchy()  = default;
+        ~BoundingVolumeHierarchy() = default;
+
+        void Build(const AABB* primitive_bounds, uint32_t primitive_count);
+        /*
+         * Nodes holding at most `max_leaf_primitive_count` primitives become leaves, e.g. to fill a SIMD batch per leaf
+         */
+        void Build(const AABB* primitive_bounds, uint32_t primitive_count, uint32_t max_leaf_primitive_count);
+        /*
+         * Recomputes every node bounds, in reverse storage order so that children are always refitted before their parent
+         */
+        void Refit(const AABB* primitive_bounds);
+        /*
+         * Refits only the leaves holding the given primitives and their ancestors, stopping at the first ancestor whose bounds don't change
+         */
+        void Refit(const AABB* primitive_bounds, const uint32_t* dirty_primitives, uint32_t dirty_count);
+        void Clear();
+
+        /*
+         * Collects the primitives whose bounds overlap `bounds`. Leaves only reference primitives, so their bounds are passed again
+         */
+        void QueryOverlap(const AABB& bounds, const AABB* primitive_bounds, std::vector<uint32_t>& primitives) const;
+        /*
+         * Primitive whose bounds are the closest to `point` within `max_distance`. Returns false when there is none,
+         * otherwise writes the primitive and its distance (0 when the point is inside its bounds)
+         */
+        bool QueryNearest(const glm::vec3& point, const AABB* primitive_bounds, float max_distance, uint32_t& primitive, float& distance) const;
+
+        /*
+         * Depth-first traversal : `node_test(const AABB&)` decides whether a node is visited,
+         * `visit_primitive(uint32_t)` is called for every primitive of the visited leaves
+         */
+        template <typename NodeTest, typename PrimitiveVisitor>
+        void Traverse(NodeTest&& node_test, PrimitiveVisitor&& visit_primitive) const
+        {
+            if (m_node_collection.empty())
+            {
+                return;
+            }
+
+            uint32_t stack[64];
+            uint32_t stack_size = 0;
+            stack[stack_size++] = 0;
+            while (stack_size > 0)
+            {
+                const BoundingVolumeNode& node = m_node_collection[stack[--stack_size]];
+                if (!node_test(node.Bounds))
+                {
+                    continue;
+                }
+
+                if (node.PrimitiveCount > 0)
+                {
+                    for (uint32_t i = 0; i < node.PrimitiveCount; ++i)
+                    {
+                        visit_primitive(m_primitive_index_collection[node.FirstIndex + i]);
+                    }
+                }
+                else
+                {
+                    stack[stack_size++] = node.FirstIndex + 1;
+                    stack[stack_size++] = node.FirstIndex;
+                }
+            }
+        }
+
+        bool                                   IsEmpty() const;
+        uint32_t                               GetPrimitiveCount() const;
+        const AABB&                            GetBounds() const;
+        const std::vector<BoundingVolumeNode>& GetNodes() const;
+        const std::vector<uint32_t>&           GetPrimitiveIndices() const;
+
+    private:
+        std::vector<BoundingVolumeNode> m_node_collection;
+        std::vector<uint32_t>           m_parent_collection;
+        std::vector<uint32_t>           m_primitive_index_collection;
+        std::vector<uint32_t>           m_primitive_leaf_collection;
+
+        void __RefitLeaf(BoundingVolumeNode& node, const AABB* primitive_bounds) const;
+    };
+} // namespace ZEngine::Helpers
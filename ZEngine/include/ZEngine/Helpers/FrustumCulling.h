@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <Helpers/BoundingVolumeHierarchy.h>
+#include <Helpers/SimdBackend.h>
+
+namespace ZEngine::Helpers
+{
+    /*
+     * Frustum planes in world space, in order left, right, bottom, top, near, far.
+     * xyz holds the plane normal pointing inside the frustum and w the plane distance
+     */
+    struct Frustum
+    {
+        glm::vec4 Planes[6];
+    };
+
+    /*
+     * Extracts the frustum planes of `projection * view` (Gribb-Hartmann). The projection is expected to use the [0, 1] depth range
+     * (GLM_FORCE_DEPTH_ZERO_TO_ONE), planes are normalized.
+     */
+    Frustum ExtractFrustum(const glm::mat4& view_projection);
+
+    /*
+     * Writes visibility[i] = 1 when bounds[i] is inside or intersects the frustum and 0 otherwise, then returns the visible count.
+     * The box is tested against each plane separately, so boxes outside of the frustum but close to its edges may be reported visible.
+     * SIMD backends test 4 (SSE4) or 8 (AVX2) boxes at once, the backend is one of SimdBackend
+     */
+    uint32_t CullAABBBatch(const Frustum& frustum, const AABB* bounds, uint32_t count, uint8_t* visibility);
+    uint32_t CullAABBBatch(SimdBackend backend, const Frustum& frustum, const AABB* bounds, uint32_t count, uint8_t* visibility);
+
+    /*
+     * True when the sphere is inside or intersects the frustum, with the same per plane approximation as CullAABBBatch()
+     */
+    bool IsSphereVisible(const Frustum& frustum, const glm::vec3& center, float radius);
+} // namespace ZEngine::Helpers
@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <Helpers/SimdBackend.h>
+
+namespace ZEngine::Helpers
+{
+    /*
+     * Computes global[node_indices[i]] = global[parent_indices[i]] * local[node_indices[i]] for i in [0, count).
+     * A negative parent index marks a root node, whose global transform is its local transform.
+     * Parents must not be written by the same batch (e.g : the batch holds nodes of a single depth level).
+     */
+    void MultiplyHierarchyTransformBatch(const int32_t* parent_indices, const uint32_t* node_indices, const glm::mat4* local, glm::mat4* global, uint32_t count);
+    void MultiplyHierarchyTransformBatch(
+        SimdBackend      backend,
+        const int32_t*   parent_indices,
+        const uint32_t*  node_indices,
+        const glm::mat4* local,
+        glm::mat4*       global,
+        uint32_t         count);
+} // namespace ZEngine::Helpers
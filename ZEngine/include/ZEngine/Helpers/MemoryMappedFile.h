@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace ZEngine::Helpers
+{
+    /*
+     * Read-only view of a whole file mapped in memory. The view stays valid until Close() or the destruction of the object
+     */
+    class MemoryMappedFile
+    {
+    public:
+        MemoryMappedFile() = default;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&)            = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        bool Open(std::string_view filename);
+        void Close();
+
+        bool           IsOpen() const;
+        const uint8_t* GetData() const;
+        size_t         GetSize() const;
+
+    private:
+        const uint8_t* m_data{nullptr};
+        size_t         m_size{0};
+#ifdef _WIN32
+        void* m_file_handle{nullptr};
+        void* m_mapping_handle{nullptr};
+#else
+        int m_file_descriptor{-1};
+#endif
+    };
+} // namespace ZEngine::Helpers
@@ -0,0 +1,178 @@
+#pragma once
+#include <cstdint>
+#include <cfloat>
+#include <vector>
+#include <glm/glm.hpp>
+#include <Helpers/IntrusivePtr.h>
+#include <Helpers/BoundingVolumeHierarchy.h>
+#include <Helpers/SimdBackend.h>
+
+namespace ZEngine::Helpers
+{
+    /*
+     * Distances along a ray are expressed in units of its direction length, so that a ray transformed into object space
+     * (direction not normalized again) reports the same distances as the world space ray
+     */
+    struct Ray
+    {
+        glm::vec3 Origin{0.0f};
+        glm::vec3 Direction{0.0f, 0.0f, -1.0f};
+    };
+
+    struct RayHit
+    {
+        uint32_t Primitive{0xFFFFFFFF};
+        float    Distance{FLT_MAX};
+
+        bool IsValid() const
+        {
+            return Primitive != 0xFFFFFFFF;
+        }
+    };
+
+    /*
+     * World space ray going through a viewport position in pixels, (0, 0) being the top left corner of the viewport as displayed
+     * by the editor. The ray starts on the near plane and its direction is normalized. The projection is expected to use the
+     * [0, 1] depth range (GLM_FORCE_DEPTH_ZERO_TO_ONE)
+     */
+    Ray UnprojectViewportPosition(const glm::vec2& viewport_position, const glm::vec2& viewport_size, const glm::mat4& view, const glm::mat4& projection);
+
+    /*
+     * Slab test, `inverse_direction` is 1 / ray.Direction. On hit, `distance` is the entry distance (0 when the origin is inside the box)
+     */
+    bool IntersectRayAABB(const Ray& ray, const glm::vec3& inverse_direction, const AABB& bounds, float max_distance, float& distance);
+
+    /*
+     * Front-to-back traversal of the hierarchy nodes hit by the ray. `visit_leaf(uint32_t first, uint32_t count)` receives a range of the
+     * hierarchy primitive indices (GetPrimitiveIndices()) and lowers `max_distance` once it finds a hit, farther nodes are then skipped
+     */
+    template <typename LeafVisitor>
+    void TraverseRay(const BoundingVolumeHierarchy& hierarchy, const Ray& ray, const float& max_distance, LeafVisitor&& visit_leaf)
+    {
+        const auto& node_collection = hierarchy.GetNodes();
+        if (node_collection.empty())
+        {
+            return;
+        }
+
+        const glm::vec3 inverse_direction = 1.0f / ray.Direction;
+        float           root_distance     = 0.0f;
+        if (!IntersectRayAABB(ray, inverse_direction, node_collection[0].Bounds, max_distance, root_distance))
+        {
+            return;
+        }
+
+        uint32_t stack[64];
+        float    stack_distance[64];
+        uint32_t stack_size          = 0;
+        stack[stack_size]            = 0;
+        stack_distance[stack_size++] = root_distance;
+        while (stack_size > 0)
+        {
+            --stack_size;
+            if (stack_distance[stack_size] > max_distance)
+            {
+                continue;
+            }
+
+            const BoundingVolumeNode& node = node_collection[stack[stack_size]];
+            if (node.PrimitiveCount > 0)
+            {
+                visit_leaf(node.FirstIndex, node.PrimitiveCount);
+                continue;
+            }
+
+            float left_distance  = 0.0f;
+            float right_distance = 0.0f;
+            bool  left_hit       = IntersectRayAABB(ray, inverse_direction, node_collection[node.FirstIndex].Bounds, max_distance, left_distance);
+            bool  right_hit      = IntersectRayAABB(ray, inverse_direction, node_collection[node.FirstIndex + 1].Bounds, max_distance, right_distance);
+            /*
+             * The nearest child is pushed last so that it is visited first
+             */
+            if (left_hit && right_hit && (left_distance <= right_distance))
+            {
+                stack[stack_size]            = node.FirstIndex + 1;
+                stack_distance[stack_size++] = right_distance;
+                stack[stack_size]            = node.FirstIndex;
+                stack_distance[stack_size++] = left_distance;
+            }
+            else if (left_hit && right_hit)
+            {
+                stack[stack_size]            = node.FirstIndex;
+                stack_distance[stack_size++] = left_distance;
+                stack[stack_size]            = node.FirstIndex + 1;
+                stack_distance[stack_size++] = right_distance;
+            }
+            else if (left_hit || right_hit)
+            {
+                stack[stack_size]            = left_hit ? node.FirstIndex : (node.FirstIndex + 1);
+                stack_distance[stack_size++] = left_hit ? left_distance : right_distance;
+            }
+        }
+    }
+
+    /*
+     * Triangles as a structure of arrays of their first vertex and both edges, the layout used by the Möller–Trumbore test.
+     * Collections are padded with degenerate triangles, so that SIMD backends can load full registers from any triangle
+     */
+    struct TriangleCollection
+    {
+        uint32_t           Count{0};
+        std::vector<float> V0X;
+        std::vector<float> V0Y;
+        std::vector<float> V0Z;
+        std::vector<float> Edge1X;
+        std::vector<float> Edge1Y;
+        std::vector<float> Edge1Z;
+        std::vector<float> Edge2X;
+        std::vector<float> Edge2Y;
+        std::vector<float> Edge2Z;
+
+        void Resize(uint32_t count);
+        void Set(uint32_t index, const glm::vec3& v0, const glm::vec3& v1, const glm::vec3& v2);
+    };
+
+    /*
+     * Closest intersection of the ray with triangles [first, first + count), both faces being hit. Triangles farther than `max_distance`
+     * are ignored. Returns the index of the hit triangle and writes its distance, or 0xFFFFFFFF when nothing is hit.
+     * SIMD backends test 4 (SSE4) or 8 (AVX2) triangles at once, the backend is one of SimdBackend
+     */
+    uint32_t IntersectRayTriangleBatch(const Ray& ray, const TriangleCollection& triangles, uint32_t first, uint32_t count, float max_distance, float& distance);
+    uint32_t IntersectRayTriangleBatch(
+        SimdBackend               backend,
+        const Ray&                ray,
+        const TriangleCollection& triangles,
+        uint32_t                  first,
+        uint32_t                  count,
+        float                     max_distance,
+        float&                    distance);
+
+    /*
+     * Ray casting structure over the triangles of one mesh, in object space. Triangles are copied in the hierarchy leaf order
+     * and leaves hold up to 8 triangles, so that each leaf is tested as a single SIMD batch.
+     */
+    class TriangleBoundingVolumeHierarchy : public RefCounted
+    {
+    public:
+        TriangleBoundingVolumeHierarchy()  = default;
+        ~TriangleBoundingVolumeHierarchy() = default;
+
+        /*
+         * `positions` points at the position of the first vertex and `vertex_stride` is the distance in floats between two positions.
+         * Indices are relative to the first vertex, three per triangle
+         */
+        void Build(const float* positions, uint32_t vertex_stride, const uint32_t* indices, uint32_t index_count);
+        /*
+         * On hit, RayHit::Primitive is the triangle index in the indices given to Build()
+         */
+        bool Raycast(const Ray& ray, float max_distance, RayHit& hit) const;
+        bool Raycast(SimdBackend backend, const Ray& ray, float max_distance, RayHit& hit) const;
+
+        uint32_t    GetTriangleCount() const;
+        const AABB& GetBounds() const;
+
+    private:
+        BoundingVolumeHierarchy m_hierarchy;
+        TriangleCollection      m_triangle_collection;
+    };
+} // namespace ZEngine::Helpers
@@ -0,0 +1,20 @@
+#pragma once
+
+namespace ZEngine::Helpers
+{
+    /*
+     * Instruction sets the batched helpers (transforms, frustum culling, ray casting) have a code path for
+     */
+    enum class SimdBackend
+    {
+        SCALAR = 0,
+        SSE4   = 1,
+        AVX2   = 2
+    };
+
+    /*
+     * Best backend supported by the running CPU, detected once at first use
+     */
+    SimdBackend GetSimdBackend();
+    bool        IsSimdBackendSupported(SimdBackend backend);
+} // namespace ZEngine::Helpers
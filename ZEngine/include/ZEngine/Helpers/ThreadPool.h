@@ -1,5 +1,8 @@
+#pragma once
 #include <atomic>
 #include <thread>
+#include <latch>
+#include <algorithm>
 #include "ThreadSafeQueue.h"
 
 namespace ZEngine::Helpers
@@ -76,6 +79,45 @@ namespace ZEngine::Helpers
             }
         }
 
+        /*
+         * Splits [0, count) into contiguous ranges, processes them on the pool with f(begin, end) and blocks until every range is done.
+         * The calling thread takes the last range itself. It must not be a pool worker since it waits on the others.
+         */
+        template <typename F>
+        static void ParallelFor(uint32_t count, F&& f, uint32_t worker_count = std::thread::hardware_concurrency(), uint32_t min_batch_size = 1)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            min_batch_size       = std::max(min_batch_size, 1u);
+            uint32_t max_workers = (count + min_batch_size - 1) / min_batch_size;
+            uint32_t range_count = std::clamp(worker_count, 1u, max_workers);
+            if ((range_count == 1) || !m_threadPool)
+            {
+                f(0u, count);
+                return;
+            }
+
+            uint32_t range_size = (count + range_count - 1) / range_count;
+            range_count         = (count + range_size - 1) / range_size;
+
+            std::latch completion(range_count - 1);
+            for (uint32_t range = 0; range < (range_count - 1); ++range)
+            {
+                uint32_t begin = range * range_size;
+                uint32_t end   = std::min(begin + range_size, count);
+                m_threadPool->Enqueue([&f, &completion, begin, end] {
+                    f(begin, end);
+                    completion.count_down();
+                });
+            }
+
+            f((range_count - 1) * range_size, count);
+            completion.wait();
+        }
+
         static void Shutdown()
         {
             m_threadPool->Shutdown();
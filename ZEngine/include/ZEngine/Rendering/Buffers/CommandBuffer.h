@@ -23,6 +23,7 @@ namespace ZEngine::Rendering::Buffers
     class IndirectBuffer;
     class VertexBuffer;
     class IndexBuffer;
+    class StorageBuffer;
 
     enum CommanBufferState : uint8_t
     {
@@ -56,13 +57,19 @@ namespace ZEngine::Rendering::Buffers
 
         void BeginRenderPass(const Ref<Renderers::RenderPasses::RenderPass>&);
         void EndRenderPass();
+        void BeginComputePass(const Ref<Renderers::RenderPasses::RenderPass>&);
+        void EndComputePass();
         void BindDescriptorSets(uint32_t frame_index = 0);
         void BindDescriptorSet(const VkDescriptorSet& descriptor);
+        void Dispatch(uint32_t group_count_x, uint32_t group_count_y = 1, uint32_t group_count_z = 1);
         void DrawIndirect(const Ref<Buffers::IndirectBuffer>& buffer);
+        void DrawIndirectCount(const Buffers::StorageBuffer& buffer, const Buffers::StorageBuffer& count_buffer, uint32_t max_draw_count);
         void DrawIndexedIndirect(const Ref<Buffers::IndirectBuffer>& buffer, uint32_t count);
         void DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance);
 
         void TransitionImageLayout(const Primitives::ImageMemoryBarrier& image_barrier);
+        void PipelineMemoryBarrier(VkPipelineStageFlags source_stage, VkAccessFlags source_access, VkPipelineStageFlags destination_stage, VkAccessFlags destination_access);
+        void FillBuffer(const Buffers::StorageBuffer& buffer, uint32_t value);
 
         void CopyBufferToImage(
             const Hardwares::BufferView& source,
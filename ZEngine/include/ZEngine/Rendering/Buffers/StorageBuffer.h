@@ -9,7 +9,10 @@ namespace ZEngine::Rendering::Buffers
     class StorageBuffer : public IGraphicBuffer
     {
     public:
-        explicit StorageBuffer() : IGraphicBuffer() {}
+        /*
+         * `additional_usage` is added to the buffer usage, e.g VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT for draw commands written by a compute pass
+         */
+        explicit StorageBuffer(VkBufferUsageFlags additional_usage = 0) : IGraphicBuffer(), m_additional_usage(additional_usage) {}
 
         void SetData(const void* data, uint32_t offset, size_t byte_size)
         {
@@ -18,21 +21,46 @@ namespace ZEngine::Rendering::Buffers
                 return;
             }
 
-            if (this->m_byte_size < byte_size)
+            Reserve(offset + byte_size);
+            WriteData(data, offset, byte_size);
+        }
+
+        /*
+         * Grows the buffer to hold at least `byte_size` bytes. A new allocation doesn't keep the previous content, returns true when the
+         * buffer got reallocated
+         */
+        bool Reserve(size_t byte_size)
+        {
+            if (this->m_byte_size >= byte_size)
+            {
+                return false;
+            }
+            /*
+             * Tracking the size change..
+             */
+            m_last_byte_size = m_byte_size;
+
+            CleanUpMemory();
+            this->m_byte_size = byte_size;
+            m_storage_buffer  = Hardwares::VulkanDevice::CreateBuffer(
+                static_cast<VkDeviceSize>(this->m_byte_size),
+                VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | m_additional_usage,
+                VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_ALLOW_TRANSFER_INSTEAD_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+            return true;
+        }
+
+        /*
+         * Writes `byte_size` bytes at `offset`, the rest of the buffer is left untouched. The range must fit in the reserved size
+         */
+        void WriteData(const void* data, size_t offset, size_t byte_size)
+        {
+            if (!data || (byte_size == 0))
             {
-                /*
-                 * Tracking the size change..
-                 */
-                m_last_byte_size = m_byte_size;
-
-                CleanUpMemory();
-                this->m_byte_size = byte_size;
-                m_storage_buffer  = Hardwares::VulkanDevice::CreateBuffer(
-                    static_cast<VkDeviceSize>(this->m_byte_size),
-                    VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
-                    VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_ALLOW_TRANSFER_INSTEAD_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+                return;
             }
 
+            ZENGINE_VALIDATE_ASSERT(offset + byte_size <= this->m_byte_size, "Storage buffer write is out of range")
+
             auto                  allocator = Hardwares::VulkanDevice::GetVmaAllocator();
             VkMemoryPropertyFlags mem_prop_flags;
             vmaGetAllocationMemoryProperties(allocator, m_storage_buffer.Allocation, &mem_prop_flags);
@@ -41,31 +69,28 @@ namespace ZEngine::Rendering::Buffers
             {
                 VmaAllocationInfo allocation_info = {};
                 vmaGetAllocationInfo(allocator, m_storage_buffer.Allocation, &allocation_info);
-                if (data && allocation_info.pMappedData)
+                if (allocation_info.pMappedData)
                 {
                     ZENGINE_VALIDATE_ASSERT(
-                        Helpers::secure_memcpy(allocation_info.pMappedData, allocation_info.size, data, this->m_byte_size) == Helpers::MEMORY_OP_SUCCESS,
+                        Helpers::secure_memcpy(reinterpret_cast<uint8_t*>(allocation_info.pMappedData) + offset, allocation_info.size - offset, data, byte_size) ==
+                            Helpers::MEMORY_OP_SUCCESS,
                         "Failed to perform memory copy operation")
                 }
             }
             else
             {
                 Hardwares::BufferView staging_buffer = Hardwares::VulkanDevice::CreateBuffer(
-                    static_cast<VkDeviceSize>(this->m_byte_size),
-                    VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                    VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+                    static_cast<VkDeviceSize>(byte_size), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
 
                 VmaAllocationInfo allocation_info = {};
                 vmaGetAllocationInfo(allocator, staging_buffer.Allocation, &allocation_info);
 
-                if (data && allocation_info.pMappedData)
+                if (allocation_info.pMappedData)
                 {
                     ZENGINE_VALIDATE_ASSERT(
-                        Helpers::secure_memcpy(allocation_info.pMappedData, allocation_info.size, data, this->m_byte_size) == Helpers::MEMORY_OP_SUCCESS,
-                        "Failed to perform memory copy operation")
-                    ZENGINE_VALIDATE_ASSERT(
-                        vmaFlushAllocation(allocator, staging_buffer.Allocation, 0, static_cast<VkDeviceSize>(this->m_byte_size)) == VK_SUCCESS, "Failed to flush allocation")
-                    Hardwares::VulkanDevice::CopyBuffer(staging_buffer, m_storage_buffer, static_cast<VkDeviceSize>(this->m_byte_size));
+                        Helpers::secure_memcpy(allocation_info.pMappedData, allocation_info.size, data, byte_size) == Helpers::MEMORY_OP_SUCCESS, "Failed to perform memory copy operation")
+                    ZENGINE_VALIDATE_ASSERT(vmaFlushAllocation(allocator, staging_buffer.Allocation, 0, static_cast<VkDeviceSize>(byte_size)) == VK_SUCCESS, "Failed to flush allocation")
+                    Hardwares::VulkanDevice::CopyBuffer(staging_buffer, m_storage_buffer, static_cast<VkDeviceSize>(byte_size), static_cast<VkDeviceSize>(offset));
                 }
 
                 /* Cleanup resource */
@@ -80,6 +105,34 @@ namespace ZEngine::Rendering::Buffers
             this->SetData(content.data(), 0, byte_size);
         }
 
+        /*
+         * Copies the buffer content back into `data`, only possible when the buffer memory is host visible (always the case on software implementations
+         * such as lavapipe). The caller must make sure that the GPU is done writing the buffer
+         */
+        bool ReadData(void* data, size_t byte_size)
+        {
+            if (!m_storage_buffer || (byte_size > this->m_byte_size))
+            {
+                return false;
+            }
+
+            auto                  allocator = Hardwares::VulkanDevice::GetVmaAllocator();
+            VkMemoryPropertyFlags mem_prop_flags;
+            vmaGetAllocationMemoryProperties(allocator, m_storage_buffer.Allocation, &mem_prop_flags);
+
+            VmaAllocationInfo allocation_info = {};
+            vmaGetAllocationInfo(allocator, m_storage_buffer.Allocation, &allocation_info);
+            if (!(mem_prop_flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) || !allocation_info.pMappedData)
+            {
+                return false;
+            }
+
+            ZENGINE_VALIDATE_ASSERT(vmaInvalidateAllocation(allocator, m_storage_buffer.Allocation, 0, static_cast<VkDeviceSize>(byte_size)) == VK_SUCCESS, "Failed to invalidate allocation")
+            ZENGINE_VALIDATE_ASSERT(
+                Helpers::secure_memcpy(data, byte_size, allocation_info.pMappedData, byte_size) == Helpers::MEMORY_OP_SUCCESS, "Failed to perform memory copy operation")
+            return true;
+        }
+
         ~StorageBuffer()
         {
             CleanUpMemory();
@@ -112,13 +165,14 @@ namespace ZEngine::Rendering::Buffers
         }
 
     private:
+        VkBufferUsageFlags     m_additional_usage{0};
         Hardwares::BufferView  m_storage_buffer;
         VkDescriptorBufferInfo m_buffer_info{};
     };
 
     struct StorageBufferSet : public Helpers::RefCounted
     {
-        StorageBufferSet(uint32_t count = 0) : m_buffer_set(count) {}
+        StorageBufferSet(uint32_t count = 0, VkBufferUsageFlags additional_usage = 0) : m_buffer_set(count, StorageBuffer{additional_usage}) {}
 
         StorageBuffer& operator[](uint32_t index)
         {
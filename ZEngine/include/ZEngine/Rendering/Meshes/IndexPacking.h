@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <Rendering/Meshes/Mesh.h>
+
+namespace ZEngine::Rendering::Meshes
+{
+    /*
+     * Mesh relative indices fit in 16 bits when the mesh has at most that many vertices
+     */
+    constexpr uint32_t MAX_UINT16_INDEX_VERTEX_COUNT = 65536;
+
+    /*
+     * Smallest index format addressing `vertex_count` vertices
+     */
+    IndexFormat SelectIndexFormat(uint32_t vertex_count);
+    /*
+     * Size of `index_count` indices in 32 bits words of the scene index stream : an odd count of 16 bits indices leaves the upper half of
+     * its last word unused
+     */
+    uint32_t    GetIndexWordCount(uint32_t index_count, IndexFormat format);
+    /*
+     * Rewrites indices below MAX_UINT16_INDEX_VERTEX_COUNT as IndexFormat::UINT16, in place : index 2k goes in the lower half of word k and
+     * index 2k + 1 in its upper half, as FetchIndex() in vertex_common.glsl reads them. The stream shrinks to GetIndexWordCount() words
+     */
+    void        PackIndices(std::vector<uint32_t>& indices);
+
+    /*
+     * Index at `position` of an index range starting at `words`
+     */
+    inline uint32_t ReadIndex(const uint32_t* words, uint32_t position, IndexFormat format)
+    {
+        if (format == IndexFormat::UINT16)
+        {
+            return (words[position >> 1] >> ((position & 1) * 16)) & 0xFFFF;
+        }
+        return words[position];
+    }
+
+    /*
+     * `index_count` indices of a range starting at `words`, as 32 bits indices
+     */
+    std::vector<uint32_t> DecodeIndices(const uint32_t* words, uint32_t index_count, IndexFormat format);
+} // namespace ZEngine::Rendering::Meshes
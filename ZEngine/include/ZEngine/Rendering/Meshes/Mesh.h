@@ -1,10 +1,12 @@
 #pragma once
+#include <algorithm>
 #include <vector>
 #include <glm/glm.hpp>
 #include <ZEngineDef.h>
 #include <Maths/Math.h>
 #include <Rendering/Materials/ShaderMaterial.h>
 #include <Rendering/Geometries/IGeometry.h>
+#include <Helpers/BoundingVolumeHierarchy.h>
 
 namespace ZEngine::Rendering::Meshes
 {
@@ -17,17 +19,103 @@ namespace ZEngine::Rendering::Meshes
         SQUARE = 3
     };
 
-    struct MeshVNext
+    /*
+     * Layout of the vertices of a mesh in the scene vertex stream, see Meshes::QuantizedVertex
+     */
+    enum class VertexFormat : uint32_t
+    {
+        FLOAT     = 0,
+        QUANTIZED = 1
+    };
+
+    /*
+     * Layout of the indices of a mesh in the scene index stream, see Meshes::PackIndices()
+     */
+    enum class IndexFormat : uint32_t
+    {
+        UINT32 = 0,
+        UINT16 = 1
+    };
+
+    constexpr uint32_t MAX_MESH_LOD_COUNT = 3;
+
+    /*
+     * Simplified level of a mesh : an index range over the mesh vertices. IndexOffset is relative to the mesh IndexOffset and Error is the
+     * simplification error relative to the radius of the mesh bounds
+     */
+    struct MeshLod
     {
-        uint32_t VertexCount{0};
-        uint32_t IndexCount{0};
-        uint32_t VertexOffset{0};
         uint32_t IndexOffset{0};
-        uint32_t StreamOffset{0};
-        uint32_t IndexStreamOffset{0};
-        uint32_t VertexUnitStreamSize{0};
-        uint32_t IndexUnitStreamSize{0};
-        uint32_t TotalByteSize{0};
+        uint32_t IndexCount{0};
+        float    Error{0.0f};
+    };
+
+    /*
+     * Levels from the finest to the coarsest, their ranges follow the full resolution indices of the mesh.
+     * Mirrors MeshLodSet in Resources/Shaders/scene_culling.comp
+     */
+    struct MeshLodSet
+    {
+        uint32_t Count{0};
+        MeshLod  Levels[MAX_MESH_LOD_COUNT];
+    };
+
+    /*
+     * Size of the whole index range of a mesh : its full resolution indices and the indices of its levels
+     */
+    inline uint32_t GetMeshIndexRangeCount(uint32_t index_count, const MeshLodSet& lods)
+    {
+        uint32_t range_count = index_count;
+        for (uint32_t i = 0; i < lods.Count; ++i)
+        {
+            range_count = std::max(range_count, lods.Levels[i].IndexOffset + lods.Levels[i].IndexCount);
+        }
+        return range_count;
+    }
+
+    /*
+     * Cluster of consecutive triangles of the full resolution range of a mesh (see BuildMeshlets()). IndexOffset is relative to the mesh
+     * IndexOffset. Center, Radius and the normal cone are in the mesh object space : the cluster faces away from a viewpoint p when
+     * dot(Center - p, ConeAxis) >= ConeCutoff * length(Center - p) + Radius, a ConeCutoff of 1 never does
+     */
+    struct Meshlet
+    {
+        uint32_t  IndexOffset{0};
+        uint32_t  IndexCount{0};
+        uint32_t  VertexCount{0};
+        glm::vec3 Center{0.0f};
+        float     Radius{0.0f};
+        glm::vec3 ConeAxis{0.0f, 0.0f, 1.0f};
+        float     ConeCutoff{1.0f};
+    };
+
+    /*
+     * VertexOffset is in floats (32 bits words) of the scene vertex stream, where meshes of every vertex format are packed.
+     * IndexOffset is in 32 bits words of the scene index stream, IndexType UINT16 meshes hold two indices per word. Index counts and
+     * the ranges of the levels and meshlets are in indices relative to the mesh, whatever its index type.
+     * IndexCount is the full resolution range, Lods the simplified levels. Large meshes also have MeshletCount meshlets from MeshletOffset
+     * in the scene meshlets
+     */
+    struct MeshVNext
+    {
+        uint32_t      VertexCount{0};
+        uint32_t      IndexCount{0};
+        uint32_t      VertexOffset{0};
+        uint32_t      IndexOffset{0};
+        uint32_t      StreamOffset{0};
+        uint32_t      IndexStreamOffset{0};
+        uint32_t      VertexUnitStreamSize{0};
+        uint32_t      IndexUnitStreamSize{0};
+        uint32_t      TotalByteSize{0};
+        VertexFormat  Format{VertexFormat::FLOAT};
+        MeshLodSet    Lods;
+        uint32_t      MeshletOffset{0};
+        uint32_t      MeshletCount{0};
+        IndexFormat   IndexType{IndexFormat::UINT32};
+        /*
+         * Object space bounds of the vertex positions, quantized positions are relative to them
+         */
+        Helpers::AABB LocalBounds;
     };
 
     struct gpuvec4
@@ -40,21 +128,27 @@ namespace ZEngine::Rendering::Meshes
         explicit gpuvec4(const glm::vec4& v) : x(v.x), y(v.y), z(v.z), w(v.w) {}
     };
 
+    /*
+     * std430 layout of MaterialData (Resources/Shaders/final_color.frag) : 112 bytes without implicit padding, texture maps are
+     * indices in the scene texture array and 0xFFFFFFFF means no texture
+     */
     struct MeshMaterial
     {
-        gpuvec4   AmbientColor{1.0f};
-        gpuvec4   EmissiveColor{0.0f};
-        gpuvec4   AlbedoColor{1.0f};
-        gpuvec4   DiffuseColor{1.0f};
-        gpuvec4   RoughnessColor{1.0f};
-        float     TransparencyFactor{1.0f};
-        float     MetallicFactor{0.0f};
-        float     AlphaTest{1.0f};
-        uint64_t  EmissiveTextureMap{0xFFFFFFFF};
-        uint64_t  AlbedoTextureMap{0xFFFFFFFF};
-        uint64_t  NormalTextureMap{0xFFFFFFFF};
-        uint64_t  OpacityTextureMap{0xFFFFFFFF};
+        gpuvec4  AmbientColor{1.0f};
+        gpuvec4  EmissiveColor{0.0f};
+        gpuvec4  AlbedoColor{1.0f};
+        gpuvec4  DiffuseColor{1.0f};
+        gpuvec4  RoughnessColor{1.0f};
+        float    TransparencyFactor{1.0f};
+        float    MetallicFactor{0.0f};
+        float    AlphaTest{1.0f};
+        uint32_t EmissiveTextureMap{0xFFFFFFFF};
+        uint32_t AlbedoTextureMap{0xFFFFFFFF};
+        uint32_t NormalTextureMap{0xFFFFFFFF};
+        uint32_t OpacityTextureMap{0xFFFFFFFF};
+        uint32_t Padding{0};
     };
+    static_assert(sizeof(MeshMaterial) == 112, "MeshMaterial must match the std430 MaterialData layout");
 
     /*Need to be deprecated*/
     class Mesh
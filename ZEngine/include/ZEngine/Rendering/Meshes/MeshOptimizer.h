@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace ZEngine::Rendering::Meshes
+{
+    /*
+     * Post-transform cache behaviour of an index buffer, simulated with a FIFO cache. ACMR is the number of transformed vertices per
+     * triangle (0.5 at best for a regular grid, 3 without any reuse) and ATVR the number of transformed vertices per referenced vertex
+     * (1 at best). Statistics of several meshes add up
+     */
+    struct VertexCacheStatistics
+    {
+        uint64_t TransformedVertexCount{0};
+        uint64_t TriangleCount{0};
+        uint64_t VertexCount{0};
+
+        float GetACMR() const;
+        float GetATVR() const;
+
+        VertexCacheStatistics& operator+=(const VertexCacheStatistics& statistics);
+    };
+
+    /*
+     * Vertex buffer traffic of an index buffer, simulated with a FIFO cache of 64 bytes lines. Overfetch is the fetched size over the
+     * size of the referenced vertices (1 at best)
+     */
+    struct VertexFetchStatistics
+    {
+        uint64_t FetchedByteCount{0};
+        uint64_t VertexByteCount{0};
+
+        float GetOverfetch() const;
+
+        VertexFetchStatistics& operator+=(const VertexFetchStatistics& statistics);
+    };
+
+    VertexCacheStatistics AnalyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertex_count, uint32_t cache_size = 16);
+    VertexFetchStatistics AnalyzeVertexFetch(const std::vector<uint32_t>& indices, uint32_t vertex_count, uint32_t vertex_byte_size);
+
+    /*
+     * Reorders triangles for post-transform cache reuse (Forsyth, "Linear-Speed Vertex Cache Optimisation"). Vertices are not moved
+     */
+    void     OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertex_count);
+    /*
+     * Reorders clusters of a cache optimized index buffer so that outer, outward facing clusters are drawn first (Sander et al., "Fast
+     * Triangle Reordering for Vertex Locality and Reduced Overdraw"). Clusters are split as long as the ACMR stays within `threshold` times
+     * the ACMR of the input. `vertices` is a stream of `vertex_float_count` floats per vertex starting with the position
+     */
+    void     OptimizeOverdraw(std::vector<uint32_t>& indices, const float* vertices, uint32_t vertex_count, uint32_t vertex_float_count, float threshold = 1.05f);
+    /*
+     * Moves vertices in the order the index buffer first references them and drops the unreferenced ones, returns the new vertex count
+     */
+    uint32_t OptimizeVertexFetch(std::vector<uint32_t>& indices, std::vector<float>& vertices, uint32_t vertex_float_count);
+} // namespace ZEngine::Rendering::Meshes
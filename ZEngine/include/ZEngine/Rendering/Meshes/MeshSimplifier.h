@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace ZEngine::Rendering::Meshes
+{
+    /*
+     * Quadric error metric simplification (Garland and Heckbert, "Surface Simplification Using Quadric Error Metrics") by edge collapses
+     * onto existing vertices : the result indexes the input vertices, so it can be stored as another index range of the same mesh.
+     * Vertices on borders and attribute seams never move. Collapses stop at `target_index_count` indices or before the error exceeds
+     * `target_error`. Errors are relative to the radius of the mesh bounds, `result_error` receives the largest collapse error.
+     * `vertices` is a stream of `vertex_float_count` floats per vertex starting with the position
+     */
+    std::vector<uint32_t> SimplifyMesh(
+        const std::vector<uint32_t>& indices,
+        const float*                 vertices,
+        uint32_t                     vertex_count,
+        uint32_t                     vertex_float_count,
+        size_t                       target_index_count,
+        float                        target_error,
+        float*                       result_error = nullptr);
+} // namespace ZEngine::Rendering::Meshes
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <Rendering/Meshes/Mesh.h>
+
+namespace ZEngine::Rendering::Meshes
+{
+    constexpr uint32_t MESHLET_MAX_VERTEX_COUNT   = 64;
+    constexpr uint32_t MESHLET_MAX_TRIANGLE_COUNT = 124;
+
+    /*
+     * Splits the triangles, in their current order, into runs of at most MESHLET_MAX_TRIANGLE_COUNT triangles using at most
+     * MESHLET_MAX_VERTEX_COUNT distinct vertices. Triangles are not moved, so meshlets are index ranges and the index order is kept :
+     * once ordered for the vertex cache (OptimizeVertexCache()), neighbouring triangles follow each other and meshlets stay compact.
+     * `vertices` is a stream of `vertex_float_count` floats per vertex starting with the position
+     */
+    std::vector<Meshlet> BuildMeshlets(const uint32_t* indices, uint32_t index_count, const float* vertices, uint32_t vertex_count, uint32_t vertex_float_count);
+
+    /*
+     * True when every triangle of the meshlet faces away from `position`, given in the mesh object space. The test is invariant under
+     * the mesh transform, so the camera is brought into the object space rather than the cone into the world space
+     */
+    inline bool IsMeshletBackFacing(const Meshlet& meshlet, const glm::vec3& position)
+    {
+        const glm::vec3 direction = meshlet.Center - position;
+        return glm::dot(direction, meshlet.ConeAxis) >= ((meshlet.ConeCutoff * glm::length(direction)) + meshlet.Radius);
+    }
+} // namespace ZEngine::Rendering::Meshes
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <Rendering/Meshes/Mesh.h>
+#include <Rendering/Renderers/Storages/IVertex.h>
+
+namespace ZEngine::Rendering::Meshes
+{
+    /*
+     * 16 bytes vertex of the VertexFormat::QUANTIZED meshes : position as 16 bits unorm relative to the mesh bounds, normal
+     * octahedral encoded as two 16 bits snorm and texture coordinates as two half floats.
+     * FetchVertex() in vertex_common.glsl decodes it and must be kept in sync
+     */
+    struct QuantizedVertex
+    {
+        uint32_t PositionXY{0};
+        uint32_t PositionZ{0};
+        uint32_t Normal{0};
+        uint32_t TextureCoord{0};
+    };
+
+    /*
+     * Size of a vertex in floats (32 bits words) of the scene vertex stream
+     */
+    uint32_t GetVertexFloatCount(VertexFormat format);
+
+    QuantizedVertex              QuantizeVertex(const Renderers::Storages::IVertex& vertex, const Helpers::AABB& bounds);
+    Renderers::Storages::IVertex DequantizeVertex(const QuantizedVertex& vertex, const Helpers::AABB& bounds);
+    /*
+     * Rewrites a stream of IVertex as quantized vertices, in place : the stream shrinks to half of its size
+     */
+    void                         QuantizeVertices(std::vector<float>& vertices, const Helpers::AABB& bounds);
+    /*
+     * Object space positions (3 floats per vertex) of `vertex_count` vertices of the stream
+     */
+    std::vector<float>           DecodeVertexPositions(const float* vertices, uint32_t vertex_count, VertexFormat format, const Helpers::AABB& bounds);
+} // namespace ZEngine::Rendering::Meshes
@@ -41,7 +41,10 @@ namespace ZEngine::Rendering::Renderers
         static void Update();
         static void Upload();
 
-        static void DrawScene(const Ref<Rendering::Cameras::Camera>& camera, const Ref<Rendering::Scenes::SceneRawData>& data);
+        static void DrawScene(const Ref<Rendering::Cameras::Camera>& camera, const Ref<Rendering::Scenes::SceneSnapshot>& data);
+
+        static void             SetSceneCullingMode(SceneCullingMode mode);
+        static SceneCullingMode GetSceneCullingMode();
 
         static void BeginImguiFrame();
         static void DrawUIFrame();
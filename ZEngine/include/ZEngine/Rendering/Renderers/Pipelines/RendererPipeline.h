@@ -4,6 +4,7 @@
 #include <Rendering/Buffers/Framebuffer.h>
 #include <Rendering/Shaders/Shader.h>
 #include <Rendering/Specifications/GraphicRendererPipelineSpecification.h>
+#include <Rendering/Specifications/ComputePipelineSpecification.h>
 
 namespace ZEngine::Rendering::Renderers::Pipelines
 {
@@ -37,4 +38,29 @@ namespace ZEngine::Rendering::Renderers::Pipelines
         Ref<Buffers::FramebufferVNext>                       m_target_framebuffer;
         Ref<Rendering::Swapchain>                            m_target_swapchain;
     };
+
+    struct ComputePipeline : public Helpers::RefCounted
+    {
+    public:
+        ComputePipeline() = default;
+        ComputePipeline(Specifications::ComputePipelineSpecification&& spec);
+        ~ComputePipeline() = default;
+
+        Specifications::ComputePipelineSpecification& GetSpecification();
+        void                                          Bake();
+        void                                          Dispose();
+
+        VkPipeline           GetHandle() const;
+        VkPipelineLayout     GetPipelineLayout() const;
+        Ref<Shaders::Shader> GetShader() const;
+
+    public:
+        static Ref<ComputePipeline> Create(Specifications::ComputePipelineSpecification& spec);
+
+    protected:
+        VkPipeline                                   m_pipeline_handle{VK_NULL_HANDLE};
+        VkPipelineLayout                             m_pipeline_layout{VK_NULL_HANDLE};
+        Specifications::ComputePipelineSpecification m_pipeline_specification;
+        Ref<Shaders::Shader>                         m_shader;
+    };
 } // namespace ZEngine::Rendering::Renderers::Pipelines
\ No newline at end of file
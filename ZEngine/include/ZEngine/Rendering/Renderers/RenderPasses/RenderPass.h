@@ -42,6 +42,11 @@ namespace ZEngine::Rendering::Renderers::RenderPasses
         void Dispose();
 
         Ref<Pipelines::GraphicPipeline> GetPipeline() const;
+        Ref<Pipelines::ComputePipeline> GetComputePipeline() const;
+        Ref<Shaders::Shader>            GetShader() const;
+        VkPipelineLayout                GetPipelineLayout() const;
+        VkPipelineBindPoint             GetPipelineBindPoint() const;
+        bool                            IsCompute() const;
         void                            Bake();
         bool                            Verify();
         void                            Update();
@@ -66,5 +71,6 @@ namespace ZEngine::Rendering::Renderers::RenderPasses
         bool                            m_perform_update{false};
         std::vector<PassInput>          m_input_collection;
         Ref<Pipelines::GraphicPipeline> m_pipeline;
+        Ref<Pipelines::ComputePipeline> m_compute_pipeline;
     };
 } // namespace ZEngine::Rendering::Renderers::RenderPasses
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstdint>
+
+namespace ZEngine::Rendering::Renderers
+{
+    enum class SceneCullingMode : uint32_t
+    {
+        /*
+         * Visible meshes are compacted on the thread pool and only their draw data, transforms and indirect commands are uploaded
+         */
+        CPU = 0,
+        /*
+         * Every mesh is uploaded and a compute pass compacts the visible ones, the final pass draws them with vkCmdDrawIndirectCount
+         */
+        GPU
+    };
+
+    struct RendererConfiguration
+    {
+        /*
+         * GPU culling falls back to CPU culling when the device doesn't support vkCmdDrawIndirectCount
+         */
+        SceneCullingMode CullingMode{SceneCullingMode::CPU};
+    };
+} // namespace ZEngine::Rendering::Renderers
@@ -5,22 +5,103 @@
 #include <Rendering/Scenes/GraphicScene.h>
 #include <Rendering/Cameras/Camera.h>
 #include <Rendering/Renderers/RenderPasses/RenderPass.h>
+#include <Rendering/Renderers/RendererConfiguration.h>
 #include <Rendering/Buffers/IndirectBuffer.h>
+#include <Helpers/FrustumCulling.h>
 
 namespace ZEngine::Rendering::Renderers
 {
 
+    /*
+     * VertexOffset is in floats of the vertex stream and IndexOffset in words of the index stream, IndexFormat tells how the indices are
+     * packed in these words. Quantized vertices are decoded in the vertex shaders with the mesh local bounds, as PositionOffset + position * PositionScale
+     */
     struct DrawData
     {
-        uint32_t Index{0xFFFFFFFF};
-        uint32_t TransformIndex{0xFFFFFFFF};
-        uint32_t MaterialIndex{0xFFFFFFFF};
-        uint32_t VertexOffset;
-        uint32_t IndexOffset;
-        uint32_t VertexCount;
-        uint32_t IndexCount;
+        uint32_t  Index{0xFFFFFFFF};
+        uint32_t  TransformIndex{0xFFFFFFFF};
+        uint32_t  MaterialIndex{0xFFFFFFFF};
+        uint32_t  VertexOffset;
+        uint32_t  IndexOffset;
+        uint32_t  VertexCount;
+        uint32_t  IndexCount;
+        uint32_t  VertexFormat{0};
+        uint32_t  IndexFormat{0};
+        glm::vec3 PositionOffset{0.0f};
+        glm::vec3 PositionScale{1.0f};
     };
 
+    /*
+     * Push constants of the culling compute pass (Resources/Shaders/scene_culling.comp)
+     */
+    struct GpuCullingConstants
+    {
+        glm::vec4 Planes[6];
+        glm::vec4 LodCamera{0.0f};
+        uint32_t  DrawCount{0};
+    };
+
+    /*
+     * LOD level drawn for a mesh : 0 for the full mesh, i for lods.Levels[i - 1]. The coarsest level whose error, scaled by the radius of
+     * the world bounds and projected at their distance, stays under one unit of lod_camera.w is picked. lod_camera holds the camera
+     * position and the projection scale in pixels at distance 1 divided by the tolerated pixel error, 0 keeps the full meshes.
+     * Mirrored by Resources/Shaders/scene_culling.comp
+     */
+    uint32_t SelectMeshLod(const Meshes::MeshLodSet& lods, const Helpers::AABB& world_bounds, const glm::vec4& lod_camera);
+
+    /*
+     * CPU reference of the culling compute pass : same inputs, same test, the visible draws are written in draw data order.
+     * The compute pass appends its commands with an atomic counter, so its output is the same set in any order.
+     * Without mesh_lods, every visible draw is the full mesh
+     */
+    uint32_t CullDrawDataReference(
+        const Helpers::Frustum&             frustum,
+        const DrawData*                     draw_data,
+        uint32_t                            draw_count,
+        const glm::mat4*                    transforms,
+        const Helpers::AABB*                local_bounds,
+        std::vector<VkDrawIndirectCommand>& commands,
+        const Meshes::MeshLodSet*           mesh_lods  = nullptr,
+        const glm::vec4&                    lod_camera = glm::vec4(0.0f));
+
+    /*
+     * Appends to `visible` the indices of the meshlets, of a mesh drawn at full resolution, whose world bounding sphere is in the frustum and,
+     * with cone_culling, that face the camera. camera_position is in the world space. Returns the number of appended meshlets
+     */
+    uint32_t CullMeshlets(
+        const Helpers::Frustum& frustum,
+        const Meshes::Meshlet*  meshlets,
+        uint32_t                meshlet_count,
+        const glm::mat4&        transform,
+        const glm::vec3&        camera_position,
+        bool                    cone_culling,
+        std::vector<uint32_t>&  visible);
+
+    /*
+     * Frustum culling : mesh slots are culled in chunks, the visible ones are then compacted into the draw data, transform and
+     * indirect command collections uploaded every frame. Draw k reads the k-th draw data and transform (gl_BaseInstance == k).
+     * Meshes with meshlets get one command per visible meshlet, all reading the same draw data : commands are counted per chunk next to the
+     * draws, with the visible meshlets of each chunk, the LOD level and the command count of each mesh slot
+     */
+    struct SceneCullingState
+    {
+        std::vector<uint8_t>               MeshVisibilityCollection;
+        std::vector<uint32_t>              ChunkOffsetCollection;
+        std::vector<uint32_t>              ChunkCommandOffsetCollection;
+        std::vector<std::vector<uint32_t>> ChunkMeshletCollection;
+        std::vector<uint8_t>               MeshLodSelectionCollection;
+        std::vector<uint32_t>              MeshCommandCountCollection;
+        std::vector<DrawData>              DrawDataCollection;
+        std::vector<glm::mat4>             TransformCollection;
+        std::vector<VkDrawIndirectCommand> IndirectCommandCollection;
+    };
+
+    /*
+     * CPU culling of the meshes of a snapshot, in mesh slot order. lod_camera is the one of SelectMeshLod() and gives the camera position of
+     * the meshlet cone test. The state keeps its collections across frames, chunks are split across the thread pool
+     */
+    void CullSceneSnapshot(const Scenes::SceneSnapshot& scene_snapshot, const Helpers::Frustum& frustum, const glm::vec4& lod_camera, bool cone_culling, SceneCullingState& state);
+
     struct SceneRenderer : public Helpers::RefCounted
     {
         SceneRenderer()  = default;
@@ -32,14 +113,27 @@ namespace ZEngine::Rendering::Renderers
         void StartScene(const glm::vec3& camera_position, const glm::mat4& camera_view, const glm::mat4& camera_projection);
         void StartScene(const glm::vec4& camera_position, const glm::mat4& camera_view, const glm::mat4& camera_projection);
         void StartScene(Buffers::CommandBuffer* const command_buffer);
-        void RenderScene(const Ref<Rendering::Scenes::SceneRawData>& scene_data, uint32_t current_frame_index = 0);
+        void RenderScene(const Ref<Rendering::Scenes::SceneSnapshot>& scene_snapshot, uint32_t current_frame_index = 0);
         void EndScene(Buffers::CommandBuffer* const command_buffer, uint32_t current_frame_index = 0);
         void SetViewportSize(uint32_t width, uint32_t height);
+        /*
+         * Falls back to CPU culling when the device doesn't support vkCmdDrawIndirectCount
+         */
+        void             SetCullingMode(SceneCullingMode mode);
+        SceneCullingMode GetCullingMode() const;
+        /*
+         * Back-facing meshlets are skipped by the CPU culling, which assumes single-sided geometry. Scenes with two-sided materials turn it off
+         */
+        void SetMeshletConeCulling(bool enabled);
 
     private:
-        glm::vec4 m_camera_position{1.0f};
-        glm::mat4 m_camera_view{1.0f};
-        glm::mat4 m_camera_projection{1.0f};
+        glm::vec4        m_camera_position{1.0f};
+        glm::mat4        m_camera_view{1.0f};
+        glm::mat4        m_camera_projection{1.0f};
+        Helpers::Frustum m_camera_frustum{};
+        glm::vec4        m_lod_camera{0.0f};
+        uint32_t         m_viewport_height{1};
+        bool             m_meshlet_cone_culling{true};
         /*
          * Scene Data Per Frame
          */
@@ -86,9 +180,40 @@ namespace ZEngine::Rendering::Renderers
         const std::vector<VkDrawIndirectCommand> m_cubemap_indirect_commmand = {VkDrawIndirectCommand{.vertexCount = 36, .instanceCount = 1, .firstVertex = 0, .firstInstance = 0}};
 
     private:
-        int                   m_upload_once_per_frame_count{-1};
-        uint32_t              m_last_uploaded_buffer_image_count{0};
-        std::vector<uint32_t> m_last_drawn_vertices_count;
-        std::vector<uint32_t> m_last_drawn_index_count;
+        int                                             m_upload_once_per_frame_count{-1};
+        Ref<Textures::TextureArray>                     m_last_uploaded_texture_collection;
+        /*
+         * Geometry and material palette pieces last uploaded per frame, they are shared between snapshots until they change
+         */
+        std::vector<Ref<Scenes::SceneGeometrySnapshot>> m_last_uploaded_geometry;
+        std::vector<Ref<Scenes::SceneMaterialSnapshot>> m_last_uploaded_materials;
+        SceneCullingState                               m_culling_state;
+        /*
+         * Largest visible count uploaded per frame : storage buffers are reallocated, and their descriptors updated, only when it grows
+         */
+        std::vector<uint32_t>                           m_visible_draw_capacity;
+        /*
+         * GPU culling : draw data k is mesh slot k, the culling pass writes the visible draws in m_SBIndirectCommand and their count in m_SBIndirectCount
+         */
+        SceneCullingMode                                m_culling_mode{SceneCullingMode::CPU};
+        GpuCullingConstants                             m_gpu_culling_constants{};
+        Ref<Buffers::StorageBufferSet>                  m_SBMeshBound;
+        Ref<Buffers::StorageBufferSet>                  m_SBMeshLod;
+        Ref<Buffers::StorageBufferSet>                  m_SBIndirectCommand;
+        Ref<Buffers::StorageBufferSet>                  m_SBIndirectCount;
+        Ref<RenderPasses::RenderPass>                   m_culling_pass;
+        std::vector<DrawData>                           m_mesh_draw_data_collection;
+        std::vector<Helpers::AABB>                      m_mesh_local_bound_collection;
+        std::vector<Meshes::MeshLodSet>                 m_mesh_lod_collection;
+        /*
+         * CPU reference of the last culling pass recorded per frame, compared with the GPU output once the frame comes back (ENABLE_GPU_CULLING_VALIDATION)
+         */
+        std::vector<std::vector<VkDrawIndirectCommand>> m_gpu_culling_reference_collection;
+        std::vector<uint8_t>                            m_gpu_culling_pending_validation;
+        uint64_t                                        m_gpu_culling_validated_frame_count{0};
+
+        void __InitializeGpuCulling();
+        void __PrepareGpuCulling(const Scenes::SceneSnapshot& scene_snapshot, uint32_t current_frame_index, bool geometry_changed);
+        void __ValidateGpuCulling(uint32_t current_frame_index);
     };
 } // namespace ZEngine::Rendering::Renderers
\ No newline at end of file
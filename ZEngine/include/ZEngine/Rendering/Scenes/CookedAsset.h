@@ -0,0 +1,155 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+#include <glm/glm.hpp>
+#include <Rendering/Meshes/Mesh.h>
+#include <Helpers/BoundingVolumeHierarchy.h>
+#include <Helpers/MemoryMappedFile.h>
+
+namespace ZEngine::Rendering::Scenes
+{
+    /*
+     * Range of CookedAssetView::Strings, strings are not null terminated
+     */
+    struct CookedAssetString
+    {
+        uint32_t Offset{0};
+        uint32_t Length{0};
+    };
+
+    /*
+     * Scene nodes in the order the import creates them, so that a parent always precedes its children. Parent is an index in the asset
+     * nodes (-1 for the asset root) and Mesh the index of the asset mesh held by the node (-1 for none)
+     */
+    struct CookedAssetNode
+    {
+        int32_t           Parent{-1};
+        int32_t           DepthLevel{0};
+        int32_t           Mesh{-1};
+        CookedAssetString Name;
+    };
+
+    /*
+     * Ranges are relative to the asset vertices and indices, and indices to the first vertex of the mesh, as for MeshVNext : VertexOffset
+     * is in floats of the asset vertices, each vertex taking GetVertexFloatCount(Format) floats, and IndexOffset in 32 bits words of the
+     * asset indices, packed as IndexType.
+     * Meshes are ordered by first node reference and packed in that order, so the first nodes of an asset only need the front of its geometry.
+     * The index range of a mesh spans its LOD levels (see GetMeshIndexRangeCount()), its meshlet range is relative to the asset meshlets
+     */
+    struct CookedAssetMesh
+    {
+        uint32_t             VertexOffset{0};
+        uint32_t             VertexCount{0};
+        uint32_t             IndexOffset{0};
+        uint32_t             IndexCount{0};
+        uint32_t             Material{0};
+        Meshes::VertexFormat Format{Meshes::VertexFormat::FLOAT};
+        Helpers::AABB        LocalBounds;
+        Meshes::MeshLodSet   Lods;
+        uint32_t             MeshletOffset{0};
+        uint32_t             MeshletCount{0};
+        Meshes::IndexFormat  IndexType{Meshes::IndexFormat::UINT32};
+    };
+
+    /*
+     * Sections of a cooked asset. Material texture maps are indices in TextureFiles (0xFFFFFFFF for none), vertices are laid out as the
+     * scene vertex stream (IVertex or QuantizedVertex, depending on the mesh format)
+     */
+    struct CookedAssetView
+    {
+        std::span<const CookedAssetNode>      Nodes;
+        std::span<const glm::mat4>            LocalTransforms;
+        std::span<const CookedAssetMesh>      Meshes;
+        std::span<const Meshes::MeshMaterial> Materials;
+        std::span<const CookedAssetString>    MaterialNames;
+        std::span<const CookedAssetString>    TextureFiles;
+        std::span<const float>                Vertices;
+        std::span<const uint32_t>             Indices;
+        std::span<const Meshes::Meshlet>      Meshlets;
+        std::span<const char>                 Strings;
+
+        std::string_view GetString(const CookedAssetString& string) const;
+    };
+
+    /*
+     * Cooked asset built by an import, owning its sections
+     */
+    struct CookedAssetData
+    {
+        std::vector<CookedAssetNode>      Nodes;
+        std::vector<glm::mat4>            LocalTransforms;
+        std::vector<CookedAssetMesh>      Meshes;
+        std::vector<Meshes::MeshMaterial> Materials;
+        std::vector<CookedAssetString>    MaterialNames;
+        std::vector<CookedAssetString>    TextureFiles;
+        std::vector<float>                Vertices;
+        std::vector<uint32_t>             Indices;
+        std::vector<Meshes::Meshlet>      Meshlets;
+        std::vector<char>                 Strings;
+
+        CookedAssetString AddString(std::string_view string);
+        CookedAssetView   GetView() const;
+    };
+
+    /*
+     * Geometry of one cooked mesh before it is packed into the asset sections
+     */
+    struct CookedMeshGeometry
+    {
+        std::span<const float>           Vertices;
+        std::span<const uint32_t>        Indices;
+        std::span<const Meshes::Meshlet> Meshlets;
+    };
+
+    /*
+     * Packs geometry_collection[i] as the geometry of cooked_asset.Meshes[i], whose Format must be set, replacing the asset vertices,
+     * indices and meshlets. Ranges are the exclusive prefix sum of the mesh sizes, the copies run on the thread pool
+     */
+    void PackCookedAssetMeshes(std::span<const CookedMeshGeometry> geometry_collection, CookedAssetData& cooked_asset);
+
+    /*
+     * A cooked asset is only valid for the source content, the import flags and the vertex format it was cooked from
+     */
+    struct CookedAssetKey
+    {
+        uint64_t SourceHash{0};
+        uint64_t SourceSize{0};
+        uint32_t ImportFlags{0};
+        uint32_t VertexFormat{0};
+
+        bool operator==(const CookedAssetKey&) const = default;
+    };
+
+    /*
+     * 64 bits hash of a file content. Large contents are hashed in chunks on the thread pool, so it must not be called from a pool worker
+     */
+    uint64_t ComputeContentHash(const uint8_t* data, size_t size);
+
+    /*
+     * The file is written next to its final location then renamed, so that readers never map a partially written file
+     */
+    bool WriteCookedAsset(std::string_view filename, const CookedAssetKey& key, const CookedAssetView& asset);
+
+    /*
+     * Cooked asset file mapped in memory, the view points into the mapping and stays valid while the object is alive
+     */
+    class CookedAssetFile
+    {
+    public:
+        CookedAssetFile()  = default;
+        ~CookedAssetFile() = default;
+
+        /*
+         * Fails when the file is missing, was cooked for another key or by another version of the format, or has out of range sections
+         */
+        bool                   Open(std::string_view filename, const CookedAssetKey& key);
+        void                   Close();
+        const CookedAssetView& GetView() const;
+
+    private:
+        Helpers::MemoryMappedFile m_file;
+        CookedAssetView           m_view;
+    };
+} // namespace ZEngine::Rendering::Scenes
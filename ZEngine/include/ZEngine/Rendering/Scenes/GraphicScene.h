@@ -2,22 +2,31 @@
 #include <vector>
 #include <future>
 #include <unordered_set>
+#include <unordered_map>
 #include <set>
 #include <Rendering/Meshes/Mesh.h>
 #include <Rendering/Entities/GraphicSceneEntity.h>
 #include <entt/entt.hpp>
 #include <uuid.h>
 #include <mutex>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include <cstring>
 #include <assimp/scene.h>
 #include <ZEngineDef.h>
 #include <Rendering/Textures/Texture.h>
+#include <Helpers/BoundingVolumeHierarchy.h>
+#include <Helpers/RayCasting.h>
+#include <Rendering/Scenes/CookedAsset.h>
 
 namespace ZEngine::Serializers
 {
     class GraphicScene3DSerializer;
 }
 
-typedef std::future<void> (*ReadCallback)(bool success, const void* scene, std::string_view parent_path);
+using ReadCallback = std::function<std::future<void>(bool success, const ZEngine::Rendering::Scenes::CookedAssetView& asset)>;
 
 namespace ZEngine::Rendering::Scenes
 {
@@ -25,8 +34,121 @@ namespace ZEngine::Rendering::Scenes
     {
         int Parent{-1};
         int FirstChild{-1};
+        int LastChild{-1};
         int RightSibling{-1};
         int DepthLevel{-1};
+        int ChildCount{0};
+    };
+
+    struct SceneNodeDirtyRange
+    {
+        uint32_t Begin{0xFFFFFFFF};
+        uint32_t End{0};
+    };
+
+    /*
+     * Transform propagation bookkeeping. Nodes are kept in depth-sorted order (level after level), a set dirty bit implies
+     * that the whole subtree of the node is dirty, and each level tracks the [Begin, End) positions holding dirty nodes
+     */
+    struct SceneNodeDirtyTracker
+    {
+        bool                             IsDepthSortedOrderValid{false};
+        std::vector<uint32_t>            DepthSortedNodeCollection;
+        std::vector<uint32_t>            LevelOffsetCollection;
+        std::vector<uint32_t>            SortedPositionCollection;
+        std::vector<uint64_t>            DirtyBitset;
+        std::vector<SceneNodeDirtyRange> LevelDirtyRangeCollection;
+        std::vector<uint32_t>            NodeScratchCollection;
+        std::vector<int32_t>             ParentScratchCollection;
+        std::vector<uint32_t>            MeshScratchCollection;
+    };
+
+    /*
+     * Transparent string hash, so that name lookups by std::string_view don't allocate a key
+     */
+    struct EntityNameHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view name) const
+        {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    /*
+     * Materials are deduplicated by content : MeshMaterial has no implicit padding, so its bytes are hashed and compared directly
+     */
+    struct MaterialContentHash
+    {
+        size_t operator()(const Meshes::MeshMaterial& material) const
+        {
+            return std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char*>(&material), sizeof(Meshes::MeshMaterial)));
+        }
+    };
+
+    struct MaterialContentEqual
+    {
+        bool operator()(const Meshes::MeshMaterial& lhs, const Meshes::MeshMaterial& rhs) const
+        {
+            return std::memcmp(&lhs, &rhs, sizeof(Meshes::MeshMaterial)) == 0;
+        }
+    };
+
+    using EntityNameIndexMap   = std::unordered_map<std::string, std::vector<entt::entity>, EntityNameHash, std::equal_to<>>;
+    using EntityUUIDIndexMap   = std::unordered_map<uuids::uuid, entt::entity>;
+    using EntityNodeIndexMap   = std::unordered_map<entt::entity, int32_t>;
+    using MaterialIndexMap     = std::unordered_map<Meshes::MeshMaterial, uint32_t, MaterialContentHash, MaterialContentEqual>;
+    using TriangleHierarchyRef = Ref<Helpers::TriangleBoundingVolumeHierarchy>;
+
+    /*
+     * Geometry range of a mesh slot : slots sharing a range are instances of the same imported mesh
+     */
+    struct MeshGeometryRange
+    {
+        uint32_t VertexOffset{0};
+        uint32_t IndexOffset{0};
+        uint32_t IndexCount{0};
+
+        bool operator==(const MeshGeometryRange&) const = default;
+    };
+
+    struct MeshGeometryRangeHash
+    {
+        size_t operator()(const MeshGeometryRange& range) const
+        {
+            return std::hash<uint64_t>{}((((uint64_t) range.VertexOffset) << 32) | range.IndexOffset) ^ (range.IndexCount * 0x9E3779B97F4A7C15ull);
+        }
+    };
+
+    using TriangleHierarchyIndexMap = std::unordered_map<MeshGeometryRange, TriangleHierarchyRef, MeshGeometryRangeHash>;
+
+    /*
+     * Closest mesh scene node hit by a ray, Triangle is the triangle index within the mesh indices
+     */
+    struct SceneRaycastHit
+    {
+        int32_t  SceneNode{-1};
+        uint32_t Triangle{0xFFFFFFFF};
+        float    Distance{FLT_MAX};
+    };
+
+    /*
+     * Closest mesh scene node to a point, Distance is measured to the node world bounds
+     */
+    struct SceneNearestHit
+    {
+        int32_t SceneNode{-1};
+        float   Distance{FLT_MAX};
+    };
+
+    /*
+     * Results of a batch of overlap queries : the scene nodes of query i are SceneNodes[QueryOffsets[i], QueryOffsets[i + 1])
+     */
+    struct SceneOverlapQueryResult
+    {
+        std::vector<uint32_t> QueryOffsets;
+        std::vector<int32_t>  SceneNodes;
     };
 
     /*
@@ -38,70 +160,412 @@ namespace ZEngine::Rendering::Scenes
      * (2) --> (3) --> (4) --> (5) --> ##-1
      *         /
      *        (6) --> ##-1
+     *
+     * Every per-node collection is addressed by the node identifier. Nodes carrying geometry are also
+     * referenced from the compact mesh slots (MeshNodeCollection, MeshCollection, MaterialCollection...),
+     * so that the renderer can iterate them contiguously without visiting empty nodes.
+     * Removed nodes leave free slots (DepthLevel == -1) that are recycled by the next added node.
+     * GeometryRevision changes every time mesh slots, materials or geometry buffers change, HierarchyRevision every time nodes
+     * are added, removed, renumbered or renamed and TransformRevision every time ComputeAllTransforms updates global transforms.
+     * EntityNameIndex and EntityUUIDIndex mirror the NameComponent and UUIComponent of every scene entity, they are kept up to date
+     * on create, rename and remove so that entity lookups don't scan the registry. Names aren't unique, empty names aren't indexed.
+     * EntityNodeIndex maps the entity of each scene node to the node identifier, it follows nodes as they are renumbered.
+     * MeshWorldBoundCollection holds the world space bounds of each mesh slot, updated by ComputeAllTransforms together with the
+     * MeshBoundingVolumeHierarchy built over them. The hierarchy is refitted as transforms change and rebuilt on the next spatial
+     * query once mesh slots were added or removed.
+     * MeshTriangleHierarchyCollection holds the object space triangle hierarchy of each mesh slot used by ray casts. A hierarchy is
+     * built the first time a ray reaches the mesh bounds and owns a copy of the triangles, so CompactScene() doesn't invalidate it.
+     * MeshTriangleHierarchyIndex maps a geometry range to its hierarchy, mesh slots sharing the range share the hierarchy.
+     * MaterialCollection is a palette of unique materials (MaterialIndex maps a material content to its palette entry) and each mesh
+     * slot references its entry through MeshMaterialIndexCollection. MaterialRevision changes every time the palette changes.
+     * Vertices and Indices only grow, except when CompactScene() moves ranges : GeometryBufferRevision changes then.
+     * Vertices is a stream of 32 bits words holding meshes of every vertex format (Meshes::VertexFormat), SVertexOffset and the mesh
+     * vertex offsets are in floats of that stream. Indices is a stream of 32 bits words as well, holding meshes of every index format
+     * (Meshes::IndexFormat) : SIndexOffset and the mesh index offsets are in words.
      */
     struct SceneRawData : public Helpers::RefCounted
     {
-        uint32_t                                 SVertexOffset{0};
-        uint32_t                                 SIndexOffset{0};
-        std::vector<float>                       Vertices;
-        std::vector<uint32_t>                    Indices;
-        std::vector<SceneNodeHierarchy>          NodeHierarchyCollection;
-        std::vector<glm::mat4>                   LocalTransformCollection;
-        std::vector<glm::mat4>                   GlobalTransformCollection;
-        std::map<uint32_t, entt::entity>         SceneNodeEntityMap;
-        std::map<uint32_t, Meshes::MeshVNext>    SceneNodeMeshMap;
-        std::map<uint32_t, std::string>          SceneNodeNameMap;
-        std::map<uint32_t, Meshes::MeshMaterial> SceneNodeMaterialMap;
-        std::map<uint32_t, std::string>          SceneNodeMaterialNameMap;
-        std::map<uint32_t, std::set<uint32_t>>   LevelSceneNodeChangedMap;
-        Ref<Textures::TextureArray>              TextureCollection = CreateRef<Textures::TextureArray>();
-        std::shared_ptr<entt::registry>          EntityRegistry;
+        uint32_t                               SVertexOffset{0};
+        uint32_t                               SIndexOffset{0};
+        uint32_t                               GeometryRevision{0};
+        uint32_t                               GeometryBufferRevision{0};
+        uint32_t                               HierarchyRevision{0};
+        uint32_t                               TransformRevision{0};
+        uint32_t                               MaterialRevision{0};
+        std::vector<float>                     Vertices;
+        std::vector<uint32_t>                  Indices;
+        std::vector<Meshes::Meshlet>           Meshlets;
+        std::vector<SceneNodeHierarchy>        NodeHierarchyCollection;
+        std::vector<glm::mat4>                 LocalTransformCollection;
+        std::vector<glm::mat4>                 GlobalTransformCollection;
+        std::vector<entt::entity>              SceneNodeEntityCollection;
+        std::vector<std::string>               SceneNodeNameCollection;
+        std::vector<int32_t>                   SceneNodeMeshIndexCollection;
+        std::vector<int32_t>                   FreeSceneNodeCollection;
+        /*
+         * Mesh slots : the i-th entry of each collection describes the same mesh node
+         */
+        std::vector<uint32_t>                  MeshNodeCollection;
+        std::vector<Meshes::MeshVNext>         MeshCollection;
+        std::vector<uint32_t>                  MeshMaterialIndexCollection;
+        std::vector<Helpers::AABB>             MeshWorldBoundCollection;
+        std::vector<TriangleHierarchyRef>      MeshTriangleHierarchyCollection;
+        TriangleHierarchyIndexMap              MeshTriangleHierarchyIndex;
+        Helpers::BoundingVolumeHierarchy       MeshBoundingVolumeHierarchy;
+        bool                                   IsMeshBoundingVolumeHierarchyValid{false};
+        SceneNodeDirtyTracker                  TransformDirtyTracker;
+        Ref<Textures::TextureArray>            TextureCollection = CreateRef<Textures::TextureArray>();
+        std::shared_ptr<entt::registry>        EntityRegistry;
+        EntityNameIndexMap                     EntityNameIndex;
+        EntityUUIDIndexMap                     EntityUUIDIndex;
+        EntityNodeIndexMap                     EntityNodeIndex;
+        /*
+         * Material palette
+         */
+        std::vector<Meshes::MeshMaterial>      MaterialCollection;
+        std::vector<std::string>               MaterialNameCollection;
+        MaterialIndexMap                       MaterialIndex;
     };
 
+    /*
+     * Contiguous part of the scene Vertices/Indices, VertexOffset is in floats and IndexOffset in words of the index stream
+     */
+    struct SceneGeometryBlock : public Helpers::RefCounted
+    {
+        uint32_t              VertexOffset{0};
+        uint32_t              IndexOffset{0};
+        std::vector<float>    Vertices;
+        std::vector<uint32_t> Indices;
+    };
+
+    /*
+     * Immutable copies of the scene published to the render thread (see GraphicScene::PublishSnapshot()).
+     * Geometry and hierarchy pieces whose revision didn't change are shared between consecutive snapshots.
+     * The geometry is published as blocks : while the scene geometry only grows (e.g an asset streaming in), a snapshot shares the
+     * blocks of the previous one and adds a block with the appended tail, so the renderer only uploads that tail.
+     * Blocks of the same BufferRevision never overlap and are ordered by offset
+     */
+    struct SceneGeometrySnapshot : public Helpers::RefCounted
+    {
+        uint32_t                             Revision{0};
+        uint32_t                             BufferRevision{0};
+        uint32_t                             VertexFloatCount{0};
+        uint32_t                             IndexCount{0};
+        std::vector<Ref<SceneGeometryBlock>> BlockCollection;
+        std::vector<Meshes::MeshVNext>       MeshCollection;
+        std::vector<uint32_t>                MeshMaterialIndexCollection;
+        std::vector<Meshes::Meshlet>         MeshletCollection;
+    };
+
+    /*
+     * Texture maps not loaded yet (at or past TextureCount) are published as missing, so materials render untextured until their
+     * textures arrive. TextureCollection holds the TextureCount first scene textures and is never modified once published : the
+     * import keeps appending to the scene texture collection while the renderer binds this one
+     */
+    struct SceneMaterialSnapshot : public Helpers::RefCounted
+    {
+        uint32_t                          Revision{0};
+        uint32_t                          TextureCount{0};
+        std::vector<Meshes::MeshMaterial> MaterialCollection;
+        Ref<Textures::TextureArray>       TextureCollection;
+    };
+
+    struct SceneHierarchySnapshot : public Helpers::RefCounted
+    {
+        uint32_t                        Revision{0};
+        std::vector<SceneNodeHierarchy> NodeHierarchyCollection;
+        std::vector<std::string>        SceneNodeNameCollection;
+        std::vector<int32_t>            RootSceneNodeCollection;
+    };
+
+    struct SceneSnapshot : public Helpers::RefCounted
+    {
+        uint32_t                    TransformRevision{0};
+        Ref<SceneGeometrySnapshot>  Geometry;
+        Ref<SceneMaterialSnapshot>  Materials;
+        Ref<SceneHierarchySnapshot> Hierarchy;
+        /*
+         * Global transform and world space bounds of each mesh slot, indexed like Geometry->MeshCollection
+         */
+        std::vector<glm::mat4>      MeshTransformCollection;
+        std::vector<Helpers::AABB>  MeshWorldBoundCollection;
+    };
+
+    /*
+     * A scene instance owns its SceneRawData (node storage, geometry, entity registry, textures) and its published snapshots.
+     * Several scenes can live side by side, e.g. the next level being imported on a worker thread while the active one renders
+     */
+    struct Scene : public Helpers::RefCounted
+    {
+        Scene()             = default;
+        Scene(const Scene&) = delete;
+        ~Scene()            = default;
+
+        void                         Initialize();
+        /*
+         * Releases the snapshots and disposes the textures of the scene, no reader may hold one of its snapshots anymore
+         */
+        void                         Deinitialize();
+        /*
+         * Drops the snapshots held by the scene itself and returns true once readers (the renderer) dropped theirs as well
+         */
+        bool                         ReleaseSnapshots();
+        Entities::GraphicSceneEntity GetPrimariyCameraEntity();
+        /*
+         * SceneEntity operations
+         */
+        std::future<Entities::GraphicSceneEntity>              CreateEntityAsync(std::string_view entity_name = "Empty Entity");
+        std::future<Entities::GraphicSceneEntity>              CreateEntityAsync(uuids::uuid uuid, std::string_view entity_name);
+        std::future<Entities::GraphicSceneEntity>              CreateEntityAsync(std::string_view uuid_string, std::string_view entity_name);
+        /*
+         * Lookups are O(1) through the name and UUID indices. Names aren't unique : GetEntityAsync(entity_name) returns
+         * one of the matching entities, GetEntitiesAsync(entity_name) all of them
+         */
+        std::future<Entities::GraphicSceneEntity>              GetEntityAsync(std::string_view entity_name);
+        std::future<Entities::GraphicSceneEntity>              GetEntityAsync(uuids::uuid uuid);
+        std::future<std::vector<Entities::GraphicSceneEntity>> GetEntitiesAsync(std::string_view entity_name);
+        std::future<bool>                                      RenameEntityAsync(const Entities::GraphicSceneEntity& entity, std::string_view entity_name);
+        /*
+         * Removing the entity of a scene node removes the node and its subtree, as RemoveNodeAsync() does
+         */
+        std::future<bool>                                      RemoveEntityAsync(const Entities::GraphicSceneEntity& entity);
+        std::shared_ptr<entt::registry>                        GetRegistry();
+        /*
+         * SceneNode operations
+         */
+        std::future<int32_t>           AddNodeAsync(int parent_node, int depth_level);
+        /*
+         * Adds `count` children to parent_node at once, node storage is reserved up front.
+         * Returns the first identifier of the created contiguous range
+         */
+        std::future<int32_t>           AddNodesAsync(int parent_node, int depth_level, uint32_t count);
+        std::future<bool>              RemoveNodeAsync(int32_t node_identifier);
+        int32_t                        GetSceneNodeParent(int32_t node_identifier);
+        int32_t                        GetSceneNodeFirstChild(int32_t node_identifier);
+        std::vector<int32_t>           GetSceneNodeSiblingCollection(int32_t node_identifier);
+        std::string_view               GetSceneNodeName(int32_t node_identifier);
+        /*
+         * Node data is returned by copy : imports and CompactScene() resize and renumber the node storage while the editor runs, so no
+         * reference to it may outlive the scene lock. Writers go through SetSceneNodeLocalTransform()
+         */
+        glm::mat4                      GetSceneNodeLocalTransform(int32_t node_identifier);
+        glm::mat4                      GetSceneNodeGlobalTransform(int32_t node_identifier);
+        SceneNodeHierarchy             GetSceneNodeHierarchy(int32_t node_identifier);
+        Entities::GraphicSceneEntity   GetSceneNodeEntityWrapper(int32_t node_identifier);
+        /*
+         * Sets the local transform and marks the node as changed under the scene lock, a node that is not alive anymore is ignored
+         */
+        void                           SetSceneNodeLocalTransform(int32_t node_identifier, const glm::mat4& transform);
+        bool                           IsSceneNodeAlive(int32_t node_identifier);
+        std::future<void>              SetSceneNodeNameAsync(int32_t node_identifier, std::string_view node_name);
+        std::future<Meshes::MeshVNext> GetSceneNodeMeshAsync(int32_t node_identifier);
+        void                           MarkSceneNodeAsChanged(int32_t node_identifier);
+        /*
+         * Scene Graph operations
+         */
+        bool                 HasSceneNodes();
+        uint32_t             GetSceneNodeCount() = delete;
+        std::vector<int32_t> GetRootSceneNodes();
+        /*
+         * The asset is read on a worker thread, the returned future is ready once the asset is fully imported.
+         * Nodes and their geometry are published chunk after chunk while the asset streams in, then textures as they get loaded.
+         * VertexFormat::QUANTIZED halves the vertex memory of the asset, at the cost of the precision of positions (16 bits per axis
+         * across the mesh bounds), normals and texture coordinates (half floats).
+         * Asset nodes are renumbered breadth-first once all of them are added, identifiers of the nodes already in the scene are kept
+         */
+        std::future<void>    ImportAssetAsync(std::string_view asset_filename, Meshes::VertexFormat vertex_format = Meshes::VertexFormat::FLOAT);
+        /*
+         * Adds an asset already cooked (read from the cache or built in memory) on the calling thread, as ImportAssetAsync() does
+         */
+        void                 ImportCookedAsset(const CookedAssetView& asset);
+        /*
+         * Node count of the first chunk an import publishes (256 by default), the next chunks double in size
+         */
+        void                 SetImportChunkNodeCount(uint32_t node_count);
+        std::future<bool>    LoadSceneFilenameAsync(std::string_view scene_file) = delete;
+        Ref<SceneRawData>    GetRawData();
+        void                 ComputeAllTransforms();
+        /*
+         * Renumbers nodes in breadth-first order (parent identifier always lower than child identifier) and returns the old to new
+         * identifier table. The depth-sorted order used by ComputeAllTransforms then matches the node storage order
+         */
+        std::vector<int32_t> ReorderSceneNodesBreadthFirst();
+        /*
+         * Drops free node slots, renumbers nodes breadth-first and packs the Vertices/Indices ranges still referenced by meshes.
+         * Returns the old to new node identifier table (removed nodes map to -1)
+         */
+        std::vector<int32_t> CompactScene();
+        void                 SetTransformWorkerCount(uint32_t worker_count);
+        /*
+         * Spatial queries go through the mesh bounding volume hierarchy, bounds are the ones of the last ComputeAllTransforms() call.
+         * Returns the mesh scene nodes whose world bounds overlap `bounds`
+         */
+        std::vector<int32_t> QuerySceneNodesInBounds(const Helpers::AABB& bounds);
+        /*
+         * Closest mesh scene node hit by the world space ray. Meshes are visited front to back through their world bounds, then their
+         * triangles are tested in object space
+         */
+        SceneRaycastHit      RaycastSceneNodes(const Helpers::Ray& ray);
+        /*
+         * Batched spatial queries : the scene lock is taken once for the whole batch and the queries are split across the thread pool.
+         * Results are written at the index of their query
+         */
+        void                    RaycastSceneNodes(const Helpers::Ray* rays, uint32_t ray_count, SceneRaycastHit* hits);
+        SceneOverlapQueryResult QuerySceneNodesInBounds(const Helpers::AABB* bounds, uint32_t bounds_count);
+        void                    QueryNearestSceneNodes(const glm::vec3* points, uint32_t point_count, float max_distance, SceneNearestHit* hits);
+        void                    SetSpatialQueryWorkerCount(uint32_t worker_count);
+        /*
+         * Snapshot operations
+         *
+         * Writers (importer, editor) mutate SceneRawData under the scene mutex, while the renderer and the UI only read the last
+         * published SceneSnapshot. PublishSnapshot() builds the next snapshot and stores it with an atomic pointer exchange,
+         * AcquireSnapshot() swaps it in at the frame boundary. AcquireSnapshot() and GetSnapshot() belong to the render thread
+         */
+        void               PublishSnapshot();
+        /*
+         * Computes transforms and publishes a snapshot if the scene changed. Returns false without waiting when a writer owns the scene
+         */
+        bool               TryPublishSnapshot();
+        Ref<SceneSnapshot> AcquireSnapshot();
+        Ref<SceneSnapshot> GetSnapshot();
+        /*
+         * Material textures operations. PostProcessMaterials() loads the textures added since its last call, materials are published
+         * untextured until then
+         */
+        int32_t AddTexture(std::string_view filename);
+        void    PostProcessMaterials();
+
+    private:
+        Ref<SceneRawData>           m_raw_data                   = CreateRef<SceneRawData>();
+        std::vector<std::string>    m_texture_file_collection    = {};
+        std::recursive_mutex        m_scene_node_mutex;
+        std::mutex                  m_texture_mutex;
+        uint32_t                    m_transform_worker_count     = std::max(std::thread::hardware_concurrency(), 1u);
+        uint32_t                    m_spatial_query_worker_count = std::max(std::thread::hardware_concurrency(), 1u);
+        uint32_t                    m_import_chunk_node_count    = 256;
+        Ref<SceneSnapshot>          m_published_snapshot;
+        std::atomic<SceneSnapshot*> m_pending_snapshot{nullptr};
+        Ref<SceneSnapshot>          m_front_snapshot;
+
+        /*
+         * Node identifiers of the assets streaming in, kept valid by __RemapSceneNodes()
+         */
+        std::vector<std::vector<int32_t>*> m_streamed_node_identifier_collection;
+
+        int32_t                     __AddNode(int parent_node, int depth_level, bool reuse_free_slot = true);
+        bool                        __IsSceneNodeAlive(int32_t node_identifier);
+        void                        __SetSceneNodeName(int32_t node_identifier, std::string_view node_name);
+        void                        __SetEntityName(entt::entity entity, std::string_view entity_name);
+        void                        __SetEntityUUID(entt::entity entity, uuids::uuid uuid);
+        void                        __RemoveEntityFromIndices(entt::entity entity);
+        void                        __ReleaseSceneNode(int32_t node_identifier);
+        void                        __RemoveSceneNodeMesh(uint32_t mesh_slot);
+        void                        __CompactSceneGeometry();
+        void                        __ReserveSceneNodes(uint32_t count);
+        void                        __RebuildDepthSortedOrder();
+        void                        __RemapSceneNodes(const std::vector<int32_t>& node_remap);
+        void                        __ReorderSceneNodesBreadthFirst(const std::vector<int32_t>& node_collection);
+        uint32_t                    __AddSceneNodeMesh(int32_t node_identifier, const Meshes::MeshVNext& mesh);
+        uint32_t                    __AddMaterial(const Meshes::MeshMaterial& material, std::string_view material_name);
+        void                        __CompactMaterials();
+        void                        __UpdateMeshWorldBounds();
+        void                        __UpdateMeshBoundingVolumeHierarchy();
+        const TriangleHierarchyRef& __GetMeshTriangleHierarchy(uint32_t mesh_slot);
+        bool                        __RaycastMeshes(const Helpers::Ray& ray, SceneRaycastHit& hit, std::atomic<uint8_t>* missing_hierarchies) const;
+        void                        __AddCookedAsset(const CookedAssetView& asset);
+        std::future<void>           __ReadAssetFileAsync(std::string_view filename, Meshes::VertexFormat vertex_format, ReadCallback callback);
+        friend class ZEngine::Serializers::GraphicScene3DSerializer;
+    };
+
+    /*
+     * Static facade over the active Scene, kept for the existing call sites.
+     * Scenes can be loaded in the background with LoadSceneAsync() and become active at the next ActivatePendingScene() call,
+     * which is meant to run at the frame boundary
+     */
     struct GraphicScene : public Helpers::RefCounted
     {
         GraphicScene()                    = delete;
         GraphicScene(const GraphicScene&) = delete;
         ~GraphicScene()                   = default;
 
+        /*
+         * Creates and initializes a new active scene
+         */
         static void                         Initialize();
         static void                         Deinitialize();
         static Entities::GraphicSceneEntity GetPrimariyCameraEntity();
+        /*
+         * Scene instance operations
+         */
+        static Ref<Scene>              GetActiveScene();
+        /*
+         * The scene replaces the active one at the next ActivatePendingScene() call. The replaced scene is deinitialized at a later
+         * call, once the renderer released its last snapshot
+         */
+        static void                    SetPendingScene(const Ref<Scene>& scene);
+        /*
+         * Imports the asset into a new scene off-thread, while the active scene keeps rendering.
+         * The loaded scene is made pending once the whole asset is imported and its snapshot published
+         */
+        static std::future<Ref<Scene>> LoadSceneAsync(std::string_view asset_filename, Meshes::VertexFormat vertex_format = Meshes::VertexFormat::FLOAT);
+        static bool                    ActivatePendingScene();
         /*
          * SceneEntity operations
          */
-        static std::future<Entities::GraphicSceneEntity> CreateEntityAsync(std::string_view entity_name = "Empty Entity");
-        static std::future<Entities::GraphicSceneEntity> CreateEntityAsync(uuids::uuid uuid, std::string_view entity_name);
-        static std::future<Entities::GraphicSceneEntity> CreateEntityAsync(std::string_view uuid_string, std::string_view entity_name);
-        static std::future<Entities::GraphicSceneEntity> GetEntityAsync(std::string_view entity_name);
-        static std::future<bool>                         RemoveEntityAsync(const Entities::GraphicSceneEntity& entity);
-        static std::shared_ptr<entt::registry>           GetRegistry();
+        static std::future<Entities::GraphicSceneEntity>              CreateEntityAsync(std::string_view entity_name = "Empty Entity");
+        static std::future<Entities::GraphicSceneEntity>              CreateEntityAsync(uuids::uuid uuid, std::string_view entity_name);
+        static std::future<Entities::GraphicSceneEntity>              CreateEntityAsync(std::string_view uuid_string, std::string_view entity_name);
+        static std::future<Entities::GraphicSceneEntity>              GetEntityAsync(std::string_view entity_name);
+        static std::future<Entities::GraphicSceneEntity>              GetEntityAsync(uuids::uuid uuid);
+        static std::future<std::vector<Entities::GraphicSceneEntity>> GetEntitiesAsync(std::string_view entity_name);
+        static std::future<bool>                                      RenameEntityAsync(const Entities::GraphicSceneEntity& entity, std::string_view entity_name);
+        static std::future<bool>                                      RemoveEntityAsync(const Entities::GraphicSceneEntity& entity);
+        static std::shared_ptr<entt::registry>                        GetRegistry();
         /*
          * SceneNode operations
          */
         static std::future<int32_t>           AddNodeAsync(int parent_node, int depth_level);
+        static std::future<int32_t>           AddNodesAsync(int parent_node, int depth_level, uint32_t count);
         static std::future<bool>              RemoveNodeAsync(int32_t node_identifier);
         static int32_t                        GetSceneNodeParent(int32_t node_identifier);
         static int32_t                        GetSceneNodeFirstChild(int32_t node_identifier);
         static std::vector<int32_t>           GetSceneNodeSiblingCollection(int32_t node_identifier);
         static std::string_view               GetSceneNodeName(int32_t node_identifier);
-        static glm::mat4&                     GetSceneNodeLocalTransform(int32_t node_identifier);
-        static glm::mat4&                     GetSceneNodeGlobalTransform(int32_t node_identifier);
-        static const SceneNodeHierarchy&      GetSceneNodeHierarchy(int32_t node_identifier);
+        static glm::mat4                      GetSceneNodeLocalTransform(int32_t node_identifier);
+        static glm::mat4                      GetSceneNodeGlobalTransform(int32_t node_identifier);
+        static SceneNodeHierarchy             GetSceneNodeHierarchy(int32_t node_identifier);
         static Entities::GraphicSceneEntity   GetSceneNodeEntityWrapper(int32_t node_identifier);
+        static void                           SetSceneNodeLocalTransform(int32_t node_identifier, const glm::mat4& transform);
+        static bool                           IsSceneNodeAlive(int32_t node_identifier);
         static std::future<void>              SetSceneNodeNameAsync(int32_t node_identifier, std::string_view node_name);
         static std::future<Meshes::MeshVNext> GetSceneNodeMeshAsync(int32_t node_identifier);
         static void                           MarkSceneNodeAsChanged(int32_t node_identifier);
         /*
          * Scene Graph operations
          */
-        static bool                 HasSceneNodes();
-        static uint32_t             GetSceneNodeCount() = delete;
-        static std::vector<int32_t> GetRootSceneNodes();
-        static std::future<void>    ImportAssetAsync(std::string_view asset_filename);
-        static std::future<bool>    LoadSceneFilenameAsync(std::string_view scene_file) = delete;
-        static Ref<SceneRawData>    GetRawData();
-        static void                 ComputeAllTransforms();
+        static bool                    HasSceneNodes();
+        static std::vector<int32_t>    GetRootSceneNodes();
+        static std::future<void>       ImportAssetAsync(std::string_view asset_filename, Meshes::VertexFormat vertex_format = Meshes::VertexFormat::FLOAT);
+        static void                    ImportCookedAsset(const CookedAssetView& asset);
+        static void                    SetImportChunkNodeCount(uint32_t node_count);
+        static Ref<SceneRawData>       GetRawData();
+        static void                    ComputeAllTransforms();
+        static std::vector<int32_t>    ReorderSceneNodesBreadthFirst();
+        static std::vector<int32_t>    CompactScene();
+        static void                    SetTransformWorkerCount(uint32_t worker_count);
+        static std::vector<int32_t>    QuerySceneNodesInBounds(const Helpers::AABB& bounds);
+        static SceneRaycastHit         RaycastSceneNodes(const Helpers::Ray& ray);
+        static void                    RaycastSceneNodes(const Helpers::Ray* rays, uint32_t ray_count, SceneRaycastHit* hits);
+        static SceneOverlapQueryResult QuerySceneNodesInBounds(const Helpers::AABB* bounds, uint32_t bounds_count);
+        static void                    QueryNearestSceneNodes(const glm::vec3* points, uint32_t point_count, float max_distance, SceneNearestHit* hits);
+        static void                    SetSpatialQueryWorkerCount(uint32_t worker_count);
+        /*
+         * Snapshot operations
+         */
+        static void               PublishSnapshot();
+        static bool               TryPublishSnapshot();
+        static Ref<SceneSnapshot> AcquireSnapshot();
+        static Ref<SceneSnapshot> GetSnapshot();
         /*
          * Material textures operations
          */
@@ -109,21 +573,9 @@ namespace ZEngine::Rendering::Scenes
         static void    PostProcessMaterials();
 
     private:
-        static Ref<SceneRawData>        s_raw_data;
-        static std::vector<std::string> s_texture_file_collection;
-        static std::recursive_mutex     s_scene_node_mutex;
-        static std::future<bool>        __TraverseAssetNodeAsync(
-                   const aiScene*   assimp_scene,
-                   aiNode*          node,
-                   int              parent_node,
-                   int              depth_level,
-                   std::string_view material_texture_parent_path);
-        static std::future<Meshes::MeshVNext>    __ReadSceneNodeMeshDataAsync(const aiScene* assimp_scene, uint32_t mesh_identifier);
-        static std::future<Meshes::MeshMaterial> __ReadSceneNodeMeshMaterialDataAsync(
-            const aiScene*   assimp_scene,
-            uint32_t         material_identifier,
-            std::string_view material_texture_parent_path);
-        static void __ReadAssetFileAsync(std::string_view filename, ReadCallback callback);
-        friend class ZEngine::Serializers::GraphicScene3DSerializer;
+        static std::mutex              s_scene_instance_mutex;
+        static Ref<Scene>              s_active_scene;
+        static Ref<Scene>              s_pending_scene;
+        static std::vector<Ref<Scene>> s_retired_scene_collection;
     };
 } // namespace ZEngine::Rendering::Scenes
@@ -0,0 +1,12 @@
+#pragma once
+#include <ZEngineDef.h>
+#include <Rendering/Specifications/ShaderSpecification.h>
+
+namespace ZEngine::Rendering::Specifications
+{
+    struct ComputePipelineSpecification
+    {
+        std::string         DebugName           = {};
+        ShaderSpecification ShaderSpecification = {};
+    };
+} // namespace ZEngine::Rendering::Specifications
@@ -8,5 +8,9 @@ namespace ZEngine::Rendering::Renderers::RenderPasses
     {
         std::string                     DebugName;
         Ref<Pipelines::GraphicPipeline> Pipeline;
+        /*
+         * Compute passes set this pipeline instead of the graphic one, they have no render target
+         */
+        Ref<Pipelines::ComputePipeline> ComputePipeline;
     };
 } // namespace ZEngine::Rendering::Specifications
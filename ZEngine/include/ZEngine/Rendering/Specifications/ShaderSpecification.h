@@ -74,6 +74,10 @@ namespace ZEngine::Rendering::Specifications
         uint32_t    OverloadMaxSet   = 1;
         std::string VertexFilename   = {};
         std::string FragmentFilename = {};
+        /*
+         * A compute shader is a pipeline on its own : when set, the vertex and fragment filenames are ignored
+         */
+        std::string ComputeFilename = {};
     };
 } // ZEngine::Rendering::Specifications
 
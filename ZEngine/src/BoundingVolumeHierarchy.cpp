@@ -0,0 +1,359 @@
+#include <pch.h>
+#include <Helpers/BoundingVolumeHierarchy.h>
+#include <numeric>
+
+#define BVH_INVALID_NODE 0xFFFFFFFF
+#define BVH_MAX_LEAF_PRIMITIVE_COUNT 4
+#define BVH_MAX_DEPTH 60
+#define BVH_BIN_COUNT 16
+
+namespace ZEngine::Helpers
+{
+    AABB TransformAABB(const AABB& box, const glm::mat4& transform)
+    {
+        if (box.IsEmpty())
+        {
+            return box;
+        }
+
+        const glm::vec3 center = glm::vec3(transform * glm::vec4(box.GetCenter(), 1.0f));
+        const glm::vec3 extent = (box.Max - box.Min) * 0.5f;
+        /*
+         * The transformed extent along each world axis is the absolute linear part applied to the local extent
+         */
+        glm::vec3 world_extent;
+        for (int row = 0; row < 3; ++row)
+        {
+            world_extent[row] = std::abs(transform[0][row]) * extent.x + std::abs(transform[1][row]) * extent.y + std::abs(transform[2][row]) * extent.z;
+        }
+        return {.Min = center - world_extent, .Max = center + world_extent};
+    }
+
+    struct BuildTask
+    {
+        uint32_t Node;
+        uint32_t Begin;
+        uint32_t End;
+        uint32_t Depth;
+    };
+
+    struct BuildBin
+    {
+        AABB     Bounds;
+        uint32_t Count{0};
+    };
+
+    void BoundingVolumeHierarchy::Build(const AABB* primitive_bounds, uint32_t primitive_count)
+    {
+        Build(primitive_bounds, primitive_count, BVH_MAX_LEAF_PRIMITIVE_COUNT);
+    }
+
+    void BoundingVolumeHierarchy::Build(const AABB* primitive_bounds, uint32_t primitive_count, uint32_t max_leaf_primitive_count)
+    {
+        Clear();
+        if (primitive_count == 0)
+        {
+            return;
+        }
+
+        m_primitive_index_collection.resize(primitive_count);
+        std::iota(m_primitive_index_collection.begin(), m_primitive_index_collection.end(), 0u);
+
+        std::vector<glm::vec3> centroid_collection(primitive_count);
+        for (uint32_t i = 0; i < primitive_count; ++i)
+        {
+            centroid_collection[i] = primitive_bounds[i].GetCenter();
+        }
+        /*
+         * A binary tree with at least one primitive per leaf never has more than 2n - 1 nodes, so node references stay valid while building
+         */
+        m_node_collection.reserve((2 * primitive_count) - 1);
+        m_parent_collection.reserve((2 * primitive_count) - 1);
+        m_node_collection.emplace_back();
+        m_parent_collection.push_back(BVH_INVALID_NODE);
+
+        std::vector<BuildTask> task_collection;
+        task_collection.push_back({.Node = 0, .Begin = 0, .End = primitive_count, .Depth = 0});
+        while (!task_collection.empty())
+        {
+            const BuildTask task = task_collection.back();
+            task_collection.pop_back();
+
+            BoundingVolumeNode& node = m_node_collection[task.Node];
+            AABB                centroid_bounds;
+            for (uint32_t i = task.Begin; i < task.End; ++i)
+            {
+                uint32_t primitive = m_primitive_index_collection[i];
+                node.Bounds.Grow(primitive_bounds[primitive]);
+                centroid_bounds.Grow(centroid_collection[primitive]);
+            }
+
+            const uint32_t count = task.End - task.Begin;
+            node.FirstIndex      = task.Begin;
+            node.PrimitiveCount  = count;
+            if ((count <= std::max(max_leaf_primitive_count, 1u)) || (task.Depth >= BVH_MAX_DEPTH))
+            {
+                continue;
+            }
+            /*
+             * Binned SAH along the longest centroid axis : primitives are binned by centroid and the cheapest bin boundary wins
+             */
+            const glm::vec3 centroid_extent = centroid_bounds.Max - centroid_bounds.Min;
+            int             best_axis       = (centroid_extent.x > centroid_extent.y) ? ((centroid_extent.x > centroid_extent.z) ? 0 : 2) : ((centroid_extent.y > centroid_extent.z) ? 1 : 2);
+            uint32_t        best_split      = 0;
+            float           best_cost       = FLT_MAX;
+            if (centroid_extent[best_axis] > 0.0f)
+            {
+                const float axis_min = centroid_bounds.Min[best_axis];
+                const float scale    = BVH_BIN_COUNT / centroid_extent[best_axis];
+                BuildBin    bins[BVH_BIN_COUNT];
+                for (uint32_t i = task.Begin; i < task.End; ++i)
+                {
+                    uint32_t primitive = m_primitive_index_collection[i];
+                    uint32_t bin       = std::min((uint32_t) ((centroid_collection[primitive][best_axis] - axis_min) * scale), (uint32_t) BVH_BIN_COUNT - 1);
+                    bins[bin].Bounds.Grow(primitive_bounds[primitive]);
+                    bins[bin].Count++;
+                }
+
+                float    right_area[BVH_BIN_COUNT];
+                uint32_t right_count[BVH_BIN_COUNT];
+                AABB     right_bounds;
+                uint32_t right_sum = 0;
+                for (int bin = BVH_BIN_COUNT - 1; bin > 0; --bin)
+                {
+                    right_bounds.Grow(bins[bin].Bounds);
+                    right_sum += bins[bin].Count;
+                    right_area[bin]  = right_bounds.GetSurfaceArea();
+                    right_count[bin] = right_sum;
+                }
+
+                AABB     left_bounds;
+                uint32_t left_sum = 0;
+                for (uint32_t split = 1; split < BVH_BIN_COUNT; ++split)
+                {
+                    left_bounds.Grow(bins[split - 1].Bounds);
+                    left_sum += bins[split - 1].Count;
+                    if ((left_sum == 0) || (right_count[split] == 0))
+                    {
+                        continue;
+                    }
+
+                    float cost = (left_sum * left_bounds.GetSurfaceArea()) + (right_count[split] * right_area[split]);
+                    if (cost < best_cost)
+                    {
+                        best_cost  = cost;
+                        best_split = split;
+                    }
+                }
+            }
+            /*
+             * Every centroid is at the same position, splitting wouldn't separate anything
+             */
+            if (centroid_extent[best_axis] <= 0.0f)
+            {
+                continue;
+            }
+            /*
+             * A split without any SAH candidate (all centroids in one bin) falls back to the median
+             */
+            const float axis_min = centroid_bounds.Min[best_axis];
+            const float scale    = BVH_BIN_COUNT / centroid_extent[best_axis];
+            auto        first    = m_primitive_index_collection.begin() + task.Begin;
+            auto        last     = m_primitive_index_collection.begin() + task.End;
+            auto        middle   = std::partition(first, last, [&](uint32_t primitive) {
+                uint32_t bin = std::min((uint32_t) ((centroid_collection[primitive][best_axis] - axis_min) * scale), (uint32_t) BVH_BIN_COUNT - 1);
+                return bin < best_split;
+            });
+            uint32_t    split    = (uint32_t) std::distance(m_primitive_index_collection.begin(), middle);
+            if ((split == task.Begin) || (split == task.End))
+            {
+                split = task.Begin + (count / 2);
+                std::nth_element(first, m_primitive_index_collection.begin() + split, last, [&](uint32_t lhs, uint32_t rhs) {
+                    return centroid_collection[lhs][best_axis] < centroid_collection[rhs][best_axis];
+                });
+            }
+
+            const uint32_t left_child = (uint32_t) m_node_collection.size();
+            node.FirstIndex           = left_child;
+            node.PrimitiveCount       = 0;
+            m_node_collection.emplace_back();
+            m_node_collection.emplace_back();
+            m_parent_collection.push_back(task.Node);
+            m_parent_collection.push_back(task.Node);
+
+            task_collection.push_back({.Node = left_child + 1, .Begin = split, .End = task.End, .Depth = task.Depth + 1});
+            task_collection.push_back({.Node = left_child, .Begin = task.Begin, .End = split, .Depth = task.Depth + 1});
+        }
+
+        m_primitive_leaf_collection.resize(primitive_count);
+        for (uint32_t node_index = 0; node_index < m_node_collection.size(); ++node_index)
+        {
+            const BoundingVolumeNode& node = m_node_collection[node_index];
+            for (uint32_t i = 0; i < node.PrimitiveCount; ++i)
+            {
+                m_primitive_leaf_collection[m_primitive_index_collection[node.FirstIndex + i]] = node_index;
+            }
+        }
+    }
+
+    void BoundingVolumeHierarchy::Refit(const AABB* primitive_bounds)
+    {
+        for (size_t node_index = m_node_collection.size(); node_index > 0; --node_index)
+        {
+            BoundingVolumeNode& node = m_node_collection[node_index - 1];
+            if (node.PrimitiveCount > 0)
+            {
+                __RefitLeaf(node, primitive_bounds);
+                continue;
+            }
+
+            node.Bounds = m_node_collection[node.FirstIndex].Bounds;
+            node.Bounds.Grow(m_node_collection[node.FirstIndex + 1].Bounds);
+        }
+    }
+
+    void BoundingVolumeHierarchy::Refit(const AABB* primitive_bounds, const uint32_t* dirty_primitives, uint32_t dirty_count)
+    {
+        for (uint32_t i = 0; i < dirty_count; ++i)
+        {
+            uint32_t            node_index  = m_primitive_leaf_collection[dirty_primitives[i]];
+            BoundingVolumeNode& leaf        = m_node_collection[node_index];
+            const AABB          leaf_bounds = leaf.Bounds;
+            __RefitLeaf(leaf, primitive_bounds);
+            if (leaf.Bounds == leaf_bounds)
+            {
+                continue;
+            }
+            /*
+             * Ancestors are recomputed from both children, so earlier dirty primitives of the same subtree are already accounted for
+             */
+            node_index = m_parent_collection[node_index];
+            while (node_index != BVH_INVALID_NODE)
+            {
+                BoundingVolumeNode& node   = m_node_collection[node_index];
+                AABB                bounds = m_node_collection[node.FirstIndex].Bounds;
+                bounds.Grow(m_node_collection[node.FirstIndex + 1].Bounds);
+                if (bounds == node.Bounds)
+                {
+                    break;
+                }
+                node.Bounds = bounds;
+                node_index  = m_parent_collection[node_index];
+            }
+        }
+    }
+
+    void BoundingVolumeHierarchy::Clear()
+    {
+        m_node_collection.clear();
+        m_parent_collection.clear();
+        m_primitive_index_collection.clear();
+        m_primitive_leaf_collection.clear();
+    }
+
+    void BoundingVolumeHierarchy::QueryOverlap(const AABB& bounds, const AABB* primitive_bounds, std::vector<uint32_t>& primitives) const
+    {
+        Traverse(
+            [&bounds](const AABB& node_bounds) { return node_bounds.Overlaps(bounds); },
+            [&](uint32_t primitive) {
+                if (primitive_bounds[primitive].Overlaps(bounds))
+                {
+                    primitives.push_back(primitive);
+                }
+            });
+    }
+
+    bool BoundingVolumeHierarchy::QueryNearest(const glm::vec3& point, const AABB* primitive_bounds, float max_distance, uint32_t& primitive, float& distance) const
+    {
+        if (m_node_collection.empty())
+        {
+            return false;
+        }
+        /*
+         * Distances are compared squared. The nearest child is visited first, so that the best distance shrinks early and prunes the other one
+         */
+        float    best_distance_squared = std::min(max_distance * max_distance, FLT_MAX);
+        uint32_t best_primitive        = 0xFFFFFFFF;
+
+        uint32_t stack[64];
+        float    stack_distance[64];
+        uint32_t stack_size          = 0;
+        stack[stack_size]            = 0;
+        stack_distance[stack_size++] = m_node_collection[0].Bounds.GetDistanceSquared(point);
+        while (stack_size > 0)
+        {
+            --stack_size;
+            if (stack_distance[stack_size] > best_distance_squared)
+            {
+                continue;
+            }
+
+            const BoundingVolumeNode& node = m_node_collection[stack[stack_size]];
+            if (node.PrimitiveCount > 0)
+            {
+                for (uint32_t i = 0; i < node.PrimitiveCount; ++i)
+                {
+                    const uint32_t candidate          = m_primitive_index_collection[node.FirstIndex + i];
+                    const float    candidate_distance = primitive_bounds[candidate].GetDistanceSquared(point);
+                    if ((candidate_distance < best_distance_squared) || ((candidate_distance == best_distance_squared) && (candidate < best_primitive)))
+                    {
+                        best_distance_squared = candidate_distance;
+                        best_primitive        = candidate;
+                    }
+                }
+                continue;
+            }
+
+            const float left_distance    = m_node_collection[node.FirstIndex].Bounds.GetDistanceSquared(point);
+            const float right_distance   = m_node_collection[node.FirstIndex + 1].Bounds.GetDistanceSquared(point);
+            const bool  left_first       = left_distance <= right_distance;
+            stack[stack_size]            = left_first ? (node.FirstIndex + 1) : node.FirstIndex;
+            stack_distance[stack_size++] = left_first ? right_distance : left_distance;
+            stack[stack_size]            = left_first ? node.FirstIndex : (node.FirstIndex + 1);
+            stack_distance[stack_size++] = left_first ? left_distance : right_distance;
+        }
+
+        if (best_primitive == 0xFFFFFFFF)
+        {
+            return false;
+        }
+        primitive = best_primitive;
+        distance  = std::sqrt(best_distance_squared);
+        return true;
+    }
+
+    bool BoundingVolumeHierarchy::IsEmpty() const
+    {
+        return m_node_collection.empty();
+    }
+
+    uint32_t BoundingVolumeHierarchy::GetPrimitiveCount() const
+    {
+        return (uint32_t) m_primitive_index_collection.size();
+    }
+
+    const AABB& BoundingVolumeHierarchy::GetBounds() const
+    {
+        static const AABB empty_bounds = {};
+        return m_node_collection.empty() ? empty_bounds : m_node_collection[0].Bounds;
+    }
+
+    const std::vector<BoundingVolumeNode>& BoundingVolumeHierarchy::GetNodes() const
+    {
+        return m_node_collection;
+    }
+
+    const std::vector<uint32_t>& BoundingVolumeHierarchy::GetPrimitiveIndices() const
+    {
+        return m_primitive_index_collection;
+    }
+
+    void BoundingVolumeHierarchy::__RefitLeaf(BoundingVolumeNode& node, const AABB* primitive_bounds) const
+    {
+        node.Bounds = {};
+        for (uint32_t i = 0; i < node.PrimitiveCount; ++i)
+        {
+            node.Bounds.Grow(primitive_bounds[m_primitive_index_collection[node.FirstIndex + i]]);
+        }
+    }
+} // namespace ZEngine::Helpers
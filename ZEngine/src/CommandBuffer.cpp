@@ -5,6 +5,7 @@
 #include <Rendering/Buffers/IndirectBuffer.h>
 #include <Rendering/Buffers/VertexBuffer.h>
 #include <Rendering/Buffers/IndexBuffer.h>
+#include <Rendering/Buffers/StorageBuffer.h>
 #include <Rendering/Renderers/RenderPasses/RenderPass.h>
 
 #include <Engine.h>
@@ -214,21 +215,36 @@ namespace ZEngine::Rendering::Buffers
         }
     }
 
+    void CommandBuffer::BeginComputePass(const Ref<Renderers::RenderPasses::RenderPass>& render_pass)
+    {
+        ZENGINE_VALIDATE_ASSERT(m_command_buffer != nullptr, "Command buffer can't be null")
+        ZENGINE_VALIDATE_ASSERT(render_pass->IsCompute(), "Render pass must be a compute pass")
+
+        vkCmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, render_pass->GetComputePipeline()->GetHandle());
+
+        m_active_render_pass = render_pass;
+    }
+
+    void CommandBuffer::EndComputePass()
+    {
+        m_active_render_pass.reset();
+    }
+
     void CommandBuffer::BindDescriptorSets(uint32_t frame_index)
     {
         if (auto render_pass = m_active_render_pass.lock())
         {
             render_pass->Update();
-            auto        render_pass_pipeline = render_pass->GetPipeline();
-            auto        pipeline_layout      = render_pass_pipeline->GetPipelineLayout();
-            const auto& descriptor_set_map   = render_pass_pipeline->GetShader()->GetDescriptorSetMap();
+            auto        pipeline_layout    = render_pass->GetPipelineLayout();
+            const auto& descriptor_set_map = render_pass->GetShader()->GetDescriptorSetMap();
 
             std::vector<VkDescriptorSet> frame_set_collection = {};
             for (auto& descriptor_set : descriptor_set_map)
             {
                 frame_set_collection.emplace_back(descriptor_set.second.at(frame_index));
             }
-            vkCmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0, frame_set_collection.size(), frame_set_collection.data(), 0, nullptr);
+            vkCmdBindDescriptorSets(
+                m_command_buffer, render_pass->GetPipelineBindPoint(), pipeline_layout, 0, frame_set_collection.size(), frame_set_collection.data(), 0, nullptr);
         }
     }
 
@@ -238,13 +254,18 @@ namespace ZEngine::Rendering::Buffers
         ZENGINE_VALIDATE_ASSERT(descriptor != nullptr, "DescriptorSet can't be null")
         if (auto render_pass = m_active_render_pass.lock())
         {
-            auto render_pass_pipeline = render_pass->GetPipeline();
-            auto pipeline_layout = render_pass_pipeline->GetPipelineLayout();
-            VkDescriptorSet desc_set[1]          = {descriptor};
-            vkCmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0, 1, desc_set, 0, nullptr);
+            auto            pipeline_layout = render_pass->GetPipelineLayout();
+            VkDescriptorSet desc_set[1]     = {descriptor};
+            vkCmdBindDescriptorSets(m_command_buffer, render_pass->GetPipelineBindPoint(), pipeline_layout, 0, 1, desc_set, 0, nullptr);
         }
     }
 
+    void CommandBuffer::Dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
+    {
+        ZENGINE_VALIDATE_ASSERT(m_command_buffer != nullptr, "Command buffer can't be null")
+        vkCmdDispatch(m_command_buffer, group_count_x, group_count_y, group_count_z);
+    }
+
     void CommandBuffer::DrawIndirect(const Ref<Buffers::IndirectBuffer>& buffer)
     {
         ZENGINE_VALIDATE_ASSERT(m_command_buffer != nullptr, "Command buffer can't be null")
@@ -254,6 +275,22 @@ namespace ZEngine::Rendering::Buffers
         }
     }
 
+    void CommandBuffer::DrawIndirectCount(const Buffers::StorageBuffer& buffer, const Buffers::StorageBuffer& count_buffer, uint32_t max_draw_count)
+    {
+        ZENGINE_VALIDATE_ASSERT(m_command_buffer != nullptr, "Command buffer can't be null")
+        if (buffer.GetNativeBufferHandle() && count_buffer.GetNativeBufferHandle())
+        {
+            vkCmdDrawIndirectCount(
+                m_command_buffer,
+                reinterpret_cast<VkBuffer>(buffer.GetNativeBufferHandle()),
+                0,
+                reinterpret_cast<VkBuffer>(count_buffer.GetNativeBufferHandle()),
+                0,
+                max_draw_count,
+                sizeof(VkDrawIndirectCommand));
+        }
+    }
+
     void CommandBuffer::DrawIndexedIndirect(const Ref<Buffers::IndirectBuffer>& buffer, uint32_t count)
     {
         ZENGINE_VALIDATE_ASSERT(m_command_buffer != nullptr, "Command buffer can't be null")
@@ -280,6 +317,26 @@ namespace ZEngine::Rendering::Buffers
         vkCmdPipelineBarrier(m_command_buffer, barrier_spec.SourceStageMask, barrier_spec.DestinationStageMask, 0, 0, nullptr, 0, nullptr, 1, &barrier_handle);
     }
 
+    void CommandBuffer::PipelineMemoryBarrier(VkPipelineStageFlags source_stage, VkAccessFlags source_access, VkPipelineStageFlags destination_stage, VkAccessFlags destination_access)
+    {
+        ZENGINE_VALIDATE_ASSERT(m_command_buffer != nullptr, "Command buffer can't be null")
+
+        VkMemoryBarrier memory_barrier = {};
+        memory_barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memory_barrier.srcAccessMask   = source_access;
+        memory_barrier.dstAccessMask   = destination_access;
+        vkCmdPipelineBarrier(m_command_buffer, source_stage, destination_stage, 0, 1, &memory_barrier, 0, nullptr, 0, nullptr);
+    }
+
+    void CommandBuffer::FillBuffer(const Buffers::StorageBuffer& buffer, uint32_t value)
+    {
+        ZENGINE_VALIDATE_ASSERT(m_command_buffer != nullptr, "Command buffer can't be null")
+        if (buffer.GetNativeBufferHandle())
+        {
+            vkCmdFillBuffer(m_command_buffer, reinterpret_cast<VkBuffer>(buffer.GetNativeBufferHandle()), 0, VK_WHOLE_SIZE, value);
+        }
+    }
+
     void CommandBuffer::CopyBufferToImage(
         const Hardwares::BufferView& source,
         Hardwares::BufferImage&      destination,
@@ -337,8 +394,7 @@ namespace ZEngine::Rendering::Buffers
 
         if (auto render_pass = m_active_render_pass.lock())
         {
-            auto render_pass_pipeline = render_pass->GetPipeline();
-            auto pipeline_layout      = render_pass_pipeline->GetPipelineLayout();
+            auto pipeline_layout = render_pass->GetPipelineLayout();
             vkCmdPushConstants(m_command_buffer, pipeline_layout, stage_flags, offset, size, data);
         }
     }
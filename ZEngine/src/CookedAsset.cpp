@@ -0,0 +1,452 @@
+#include <pch.h>
+#include <Rendering/Scenes/CookedAsset.h>
+#include <Rendering/Meshes/VertexQuantization.h>
+#include <Helpers/ThreadPool.h>
+#include <array>
+#include <cstring>
+
+#define COOKED_ASSET_MAGIC 0x5453415A /* "ZAST" */
+#define COOKED_ASSET_VERSION 5
+#define COOKED_ASSET_SECTION_ALIGNMENT 16
+#define CONTENT_HASH_CHUNK_SIZE (4ull << 20)
+
+namespace ZEngine::Rendering::Scenes
+{
+    /*
+     * Any layout change of the cooked structures must come with a new COOKED_ASSET_VERSION, so that older files are cooked again
+     */
+    static_assert(sizeof(CookedAssetNode) == 20, "CookedAssetNode layout changed, bump COOKED_ASSET_VERSION");
+    static_assert(sizeof(CookedAssetMesh) == 100, "CookedAssetMesh layout changed, bump COOKED_ASSET_VERSION");
+    static_assert(sizeof(Meshes::Meshlet) == 44, "Meshlet layout changed, bump COOKED_ASSET_VERSION");
+    static_assert(sizeof(Meshes::MeshMaterial) == 112, "MeshMaterial layout changed, bump COOKED_ASSET_VERSION");
+    static_assert(sizeof(Renderers::Storages::IVertex) == 32, "IVertex layout changed, bump COOKED_ASSET_VERSION");
+    static_assert(sizeof(Meshes::QuantizedVertex) == 16, "QuantizedVertex layout changed, bump COOKED_ASSET_VERSION");
+
+    enum CookedAssetSectionType : uint32_t
+    {
+        COOKED_ASSET_NODES = 0,
+        COOKED_ASSET_LOCAL_TRANSFORMS,
+        COOKED_ASSET_MESHES,
+        COOKED_ASSET_MATERIALS,
+        COOKED_ASSET_MATERIAL_NAMES,
+        COOKED_ASSET_TEXTURE_FILES,
+        COOKED_ASSET_VERTICES,
+        COOKED_ASSET_INDICES,
+        COOKED_ASSET_MESHLETS,
+        COOKED_ASSET_STRINGS,
+        COOKED_ASSET_SECTION_COUNT
+    };
+
+    /*
+     * Offsets are in bytes from the start of the file, counts in elements of the section
+     */
+    struct CookedAssetSection
+    {
+        uint64_t Offset{0};
+        uint64_t Count{0};
+    };
+
+    struct CookedAssetHeader
+    {
+        uint32_t           Magic{COOKED_ASSET_MAGIC};
+        uint32_t           Version{COOKED_ASSET_VERSION};
+        CookedAssetKey     Key;
+        CookedAssetSection Sections[COOKED_ASSET_SECTION_COUNT];
+    };
+
+    struct CookedAssetSectionSource
+    {
+        const void* Data{nullptr};
+        size_t      Count{0};
+        size_t      ElementSize{0};
+    };
+
+    static std::array<CookedAssetSectionSource, COOKED_ASSET_SECTION_COUNT> GetSectionSources(const CookedAssetView& asset)
+    {
+        auto source = [](const auto& span) -> CookedAssetSectionSource {
+            return {.Data = span.data(), .Count = span.size(), .ElementSize = sizeof(typename std::decay_t<decltype(span)>::element_type)};
+        };
+        return {
+            source(asset.Nodes),
+            source(asset.LocalTransforms),
+            source(asset.Meshes),
+            source(asset.Materials),
+            source(asset.MaterialNames),
+            source(asset.TextureFiles),
+            source(asset.Vertices),
+            source(asset.Indices),
+            source(asset.Meshlets),
+            source(asset.Strings)};
+    }
+
+    template <typename T>
+    static bool MapSection(const uint8_t* data, size_t size, const CookedAssetSection& section, std::span<const T>& output)
+    {
+        if ((section.Offset % COOKED_ASSET_SECTION_ALIGNMENT) != 0 || (section.Offset > size) || (section.Count > (size - section.Offset) / sizeof(T)))
+        {
+            return false;
+        }
+        output = std::span<const T>(reinterpret_cast<const T*>(data + section.Offset), (size_t) section.Count);
+        return true;
+    }
+
+    static bool IsStringValid(const CookedAssetView& asset, const CookedAssetString& string)
+    {
+        return ((uint64_t) string.Offset + string.Length) <= asset.Strings.size();
+    }
+
+    /*
+     * Cross-section references are checked once at load, so that a corrupted file is cooked again instead of being read out of bounds
+     */
+    static bool IsCookedAssetValid(const CookedAssetView& asset)
+    {
+        if ((asset.LocalTransforms.size() != asset.Nodes.size()) || (asset.MaterialNames.size() != asset.Materials.size()))
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < asset.Nodes.size(); ++i)
+        {
+            const auto& node = asset.Nodes[i];
+            if ((node.Parent < -1) || (node.Parent >= (int64_t) i) || (node.Mesh < -1) || (node.Mesh >= (int64_t) asset.Meshes.size()) || !IsStringValid(asset, node.Name))
+            {
+                return false;
+            }
+        }
+
+        for (const auto& mesh : asset.Meshes)
+        {
+            if (((mesh.Format != Meshes::VertexFormat::FLOAT) && (mesh.Format != Meshes::VertexFormat::QUANTIZED)) ||
+                ((mesh.IndexType != Meshes::IndexFormat::UINT32) && (mesh.IndexType != Meshes::IndexFormat::UINT16)) || (mesh.Lods.Count > Meshes::MAX_MESH_LOD_COUNT))
+            {
+                return false;
+            }
+            /*
+             * The index range covers the full resolution indices and every level, it is counted in 64 bits so that corrupted ranges can't wrap
+             */
+            uint64_t index_range_count = mesh.IndexCount;
+            for (uint32_t i = 0; i < mesh.Lods.Count; ++i)
+            {
+                index_range_count = std::max(index_range_count, (uint64_t) mesh.Lods.Levels[i].IndexOffset + mesh.Lods.Levels[i].IndexCount);
+            }
+
+            const uint64_t vertex_end = (uint64_t) mesh.VertexOffset + (uint64_t) mesh.VertexCount * Meshes::GetVertexFloatCount(mesh.Format);
+            const uint64_t index_end  = (uint64_t) mesh.IndexOffset + ((mesh.IndexType == Meshes::IndexFormat::UINT16) ? ((index_range_count + 1) / 2) : index_range_count);
+            if ((vertex_end > asset.Vertices.size()) || (index_end > asset.Indices.size()) || (mesh.Material >= asset.Materials.size()) ||
+                (((uint64_t) mesh.MeshletOffset + mesh.MeshletCount) > asset.Meshlets.size()))
+            {
+                return false;
+            }
+
+            for (uint32_t i = 0; i < mesh.MeshletCount; ++i)
+            {
+                const auto& meshlet = asset.Meshlets[mesh.MeshletOffset + i];
+                if (((uint64_t) meshlet.IndexOffset + meshlet.IndexCount) > mesh.IndexCount)
+                {
+                    return false;
+                }
+            }
+        }
+
+        for (const auto& material : asset.Materials)
+        {
+            for (uint32_t texture_map : {material.EmissiveTextureMap, material.AlbedoTextureMap, material.NormalTextureMap, material.OpacityTextureMap})
+            {
+                if ((texture_map != 0xFFFFFFFF) && (texture_map >= asset.TextureFiles.size()))
+                {
+                    return false;
+                }
+            }
+        }
+
+        for (const auto& strings : {asset.MaterialNames, asset.TextureFiles})
+        {
+            for (const auto& string : strings)
+            {
+                if (!IsStringValid(asset, string))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /*
+     * XXH64 over a single memory range
+     */
+    static constexpr uint64_t HASH_PRIME_1 = 0x9E3779B185EBCA87ull;
+    static constexpr uint64_t HASH_PRIME_2 = 0xC2B2AE3D27D4EB4Full;
+    static constexpr uint64_t HASH_PRIME_3 = 0x165667B19E3779F9ull;
+    static constexpr uint64_t HASH_PRIME_4 = 0x85EBCA77C2B2AE63ull;
+    static constexpr uint64_t HASH_PRIME_5 = 0x27D4EB2F165667C5ull;
+
+    static inline uint64_t RotateLeft(uint64_t value, int count)
+    {
+        return (value << count) | (value >> (64 - count));
+    }
+
+    static inline uint64_t ReadUInt64(const uint8_t* data)
+    {
+        uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static inline uint32_t ReadUInt32(const uint8_t* data)
+    {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static inline uint64_t HashRound(uint64_t accumulator, uint64_t input)
+    {
+        accumulator += input * HASH_PRIME_2;
+        return RotateLeft(accumulator, 31) * HASH_PRIME_1;
+    }
+
+    static inline uint64_t HashMergeRound(uint64_t accumulator, uint64_t value)
+    {
+        accumulator ^= HashRound(0, value);
+        return (accumulator * HASH_PRIME_1) + HASH_PRIME_4;
+    }
+
+    static uint64_t HashRange(const uint8_t* data, size_t size, uint64_t seed)
+    {
+        const uint8_t* end = data + size;
+        uint64_t       hash;
+        if (size >= 32)
+        {
+            uint64_t lane_1 = seed + HASH_PRIME_1 + HASH_PRIME_2;
+            uint64_t lane_2 = seed + HASH_PRIME_2;
+            uint64_t lane_3 = seed;
+            uint64_t lane_4 = seed - HASH_PRIME_1;
+            for (; data + 32 <= end; data += 32)
+            {
+                lane_1 = HashRound(lane_1, ReadUInt64(data));
+                lane_2 = HashRound(lane_2, ReadUInt64(data + 8));
+                lane_3 = HashRound(lane_3, ReadUInt64(data + 16));
+                lane_4 = HashRound(lane_4, ReadUInt64(data + 24));
+            }
+            hash = RotateLeft(lane_1, 1) + RotateLeft(lane_2, 7) + RotateLeft(lane_3, 12) + RotateLeft(lane_4, 18);
+            hash = HashMergeRound(hash, lane_1);
+            hash = HashMergeRound(hash, lane_2);
+            hash = HashMergeRound(hash, lane_3);
+            hash = HashMergeRound(hash, lane_4);
+        }
+        else
+        {
+            hash = seed + HASH_PRIME_5;
+        }
+
+        hash += (uint64_t) size;
+        for (; data + 8 <= end; data += 8)
+        {
+            hash ^= HashRound(0, ReadUInt64(data));
+            hash = (RotateLeft(hash, 27) * HASH_PRIME_1) + HASH_PRIME_4;
+        }
+        if (data + 4 <= end)
+        {
+            hash ^= (uint64_t) ReadUInt32(data) * HASH_PRIME_1;
+            hash = (RotateLeft(hash, 23) * HASH_PRIME_2) + HASH_PRIME_3;
+            data += 4;
+        }
+        for (; data < end; ++data)
+        {
+            hash ^= (*data) * HASH_PRIME_5;
+            hash = RotateLeft(hash, 11) * HASH_PRIME_1;
+        }
+
+        hash ^= hash >> 33;
+        hash *= HASH_PRIME_2;
+        hash ^= hash >> 29;
+        hash *= HASH_PRIME_3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    uint64_t ComputeContentHash(const uint8_t* data, size_t size)
+    {
+        const size_t chunk_count = (size + CONTENT_HASH_CHUNK_SIZE - 1) / CONTENT_HASH_CHUNK_SIZE;
+        if (chunk_count <= 1)
+        {
+            return HashRange(data, size, 0);
+        }
+        /*
+         * Chunks are hashed independently, the content hash is the hash of the chunk hashes in order, seeded with the content size
+         */
+        std::vector<uint64_t> chunk_hash_collection(chunk_count);
+        Helpers::ThreadPoolHelper::ParallelFor((uint32_t) chunk_count, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t chunk = begin; chunk < end; ++chunk)
+            {
+                const size_t offset          = (size_t) chunk * CONTENT_HASH_CHUNK_SIZE;
+                chunk_hash_collection[chunk] = HashRange(data + offset, std::min<size_t>(CONTENT_HASH_CHUNK_SIZE, size - offset), 0);
+            }
+        });
+        return HashRange(reinterpret_cast<const uint8_t*>(chunk_hash_collection.data()), chunk_count * sizeof(uint64_t), (uint64_t) size);
+    }
+
+    std::string_view CookedAssetView::GetString(const CookedAssetString& string) const
+    {
+        return std::string_view(Strings.data() + string.Offset, string.Length);
+    }
+
+    CookedAssetString CookedAssetData::AddString(std::string_view string)
+    {
+        CookedAssetString output = {.Offset = (uint32_t) Strings.size(), .Length = (uint32_t) string.size()};
+        Strings.insert(Strings.end(), string.begin(), string.end());
+        return output;
+    }
+
+    CookedAssetView CookedAssetData::GetView() const
+    {
+        return {
+            .Nodes           = Nodes,
+            .LocalTransforms = LocalTransforms,
+            .Meshes          = Meshes,
+            .Materials       = Materials,
+            .MaterialNames   = MaterialNames,
+            .TextureFiles    = TextureFiles,
+            .Vertices        = Vertices,
+            .Indices         = Indices,
+            .Meshlets        = Meshlets,
+            .Strings         = Strings};
+    }
+
+    void PackCookedAssetMeshes(std::span<const CookedMeshGeometry> geometry_collection, CookedAssetData& cooked_asset)
+    {
+        /*
+         * The cooked arrays grow once, then the meshes are copied into their ranges in parallel
+         */
+        const auto mesh_count     = (uint32_t) geometry_collection.size();
+        uint32_t   vertex_offset  = 0;
+        uint32_t   index_offset   = 0;
+        uint32_t   meshlet_offset = 0;
+        for (uint32_t i = 0; i < mesh_count; ++i)
+        {
+            const auto& geometry = geometry_collection[i];
+            auto&       mesh     = cooked_asset.Meshes[i];
+            mesh.VertexOffset    = vertex_offset;
+            mesh.VertexCount     = (uint32_t) (geometry.Vertices.size() / Meshes::GetVertexFloatCount(mesh.Format));
+            mesh.IndexOffset     = index_offset;
+            mesh.MeshletOffset   = meshlet_offset;
+            mesh.MeshletCount    = (uint32_t) geometry.Meshlets.size();
+
+            vertex_offset += (uint32_t) geometry.Vertices.size();
+            index_offset += (uint32_t) geometry.Indices.size();
+            meshlet_offset += mesh.MeshletCount;
+        }
+
+        cooked_asset.Vertices.resize(vertex_offset);
+        cooked_asset.Indices.resize(index_offset);
+        cooked_asset.Meshlets.resize(meshlet_offset);
+        Helpers::ThreadPoolHelper::ParallelFor(mesh_count, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                const auto& geometry = geometry_collection[i];
+                const auto& mesh     = cooked_asset.Meshes[i];
+                std::copy(geometry.Vertices.begin(), geometry.Vertices.end(), cooked_asset.Vertices.begin() + mesh.VertexOffset);
+                std::copy(geometry.Indices.begin(), geometry.Indices.end(), cooked_asset.Indices.begin() + mesh.IndexOffset);
+                std::copy(geometry.Meshlets.begin(), geometry.Meshlets.end(), cooked_asset.Meshlets.begin() + mesh.MeshletOffset);
+            }
+        });
+    }
+
+    bool WriteCookedAsset(std::string_view filename, const CookedAssetKey& key, const CookedAssetView& asset)
+    {
+        const auto sources = GetSectionSources(asset);
+
+        CookedAssetHeader header = {.Key = key};
+        uint64_t          offset = sizeof(CookedAssetHeader);
+        for (uint32_t section = 0; section < COOKED_ASSET_SECTION_COUNT; ++section)
+        {
+            offset                   = (offset + COOKED_ASSET_SECTION_ALIGNMENT - 1) & ~(uint64_t) (COOKED_ASSET_SECTION_ALIGNMENT - 1);
+            header.Sections[section] = {.Offset = offset, .Count = sources[section].Count};
+            offset += sources[section].Count * sources[section].ElementSize;
+        }
+
+        const std::string temporary_filename = std::string(filename) + ".tmp";
+        {
+            std::ofstream output(temporary_filename, std::ios::binary | std::ios::trunc);
+            if (!output)
+            {
+                return false;
+            }
+
+            const char padding[COOKED_ASSET_SECTION_ALIGNMENT] = {};
+            output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            for (uint32_t section = 0; section < COOKED_ASSET_SECTION_COUNT; ++section)
+            {
+                output.write(padding, (std::streamsize) (header.Sections[section].Offset - (uint64_t) output.tellp()));
+                output.write(reinterpret_cast<const char*>(sources[section].Data), (std::streamsize) (sources[section].Count * sources[section].ElementSize));
+            }
+            if (!output)
+            {
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary_filename, filename, error);
+        if (error)
+        {
+            std::filesystem::remove(temporary_filename, error);
+            return false;
+        }
+        return true;
+    }
+
+    bool CookedAssetFile::Open(std::string_view filename, const CookedAssetKey& key)
+    {
+        Close();
+        if (!m_file.Open(filename))
+        {
+            return false;
+        }
+
+        const uint8_t* data = m_file.GetData();
+        const size_t   size = m_file.GetSize();
+
+        CookedAssetHeader header;
+        if (size < sizeof(header))
+        {
+            m_file.Close();
+            return false;
+        }
+        std::memcpy(&header, data, sizeof(header));
+
+        CookedAssetView view;
+        bool            is_valid = (header.Magic == COOKED_ASSET_MAGIC) && (header.Version == COOKED_ASSET_VERSION) && (header.Key == key);
+        is_valid                 = is_valid && MapSection(data, size, header.Sections[COOKED_ASSET_NODES], view.Nodes);
+        is_valid                 = is_valid && MapSection(data, size, header.Sections[COOKED_ASSET_LOCAL_TRANSFORMS], view.LocalTransforms);
+        is_valid                 = is_valid && MapSection(data, size, header.Sections[COOKED_ASSET_MESHES], view.Meshes);
+        is_valid                 = is_valid && MapSection(data, size, header.Sections[COOKED_ASSET_MATERIALS], view.Materials);
+        is_valid                 = is_valid && MapSection(data, size, header.Sections[COOKED_ASSET_MATERIAL_NAMES], view.MaterialNames);
+        is_valid                 = is_valid && MapSection(data, size, header.Sections[COOKED_ASSET_TEXTURE_FILES], view.TextureFiles);
+        is_valid                 = is_valid && MapSection(data, size, header.Sections[COOKED_ASSET_VERTICES], view.Vertices);
+        is_valid                 = is_valid && MapSection(data, size, header.Sections[COOKED_ASSET_INDICES], view.Indices);
+        is_valid                 = is_valid && MapSection(data, size, header.Sections[COOKED_ASSET_MESHLETS], view.Meshlets);
+        is_valid                 = is_valid && MapSection(data, size, header.Sections[COOKED_ASSET_STRINGS], view.Strings);
+        is_valid                 = is_valid && IsCookedAssetValid(view);
+        if (!is_valid)
+        {
+            m_file.Close();
+            return false;
+        }
+
+        m_view = view;
+        return true;
+    }
+
+    void CookedAssetFile::Close()
+    {
+        m_view = {};
+        m_file.Close();
+    }
+
+    const CookedAssetView& CookedAssetFile::GetView() const
+    {
+        return m_view;
+    }
+} // namespace ZEngine::Rendering::Scenes
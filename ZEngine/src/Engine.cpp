@@ -33,6 +33,7 @@ namespace ZEngine
         /*
          * Renderer Post initialization
          */
+        GraphicRenderer::SetSceneCullingMode(engine_configuration.RendererConfiguration.CullingMode);
         ZENGINE_CORE_INFO("Engine initialized")
 
         for (const auto& layer : engine_configuration.WindowConfiguration.RenderingLayerCollection)
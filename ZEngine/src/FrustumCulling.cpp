@@ -0,0 +1,218 @@
+#include <pch.h>
+#include <Helpers/FrustumCulling.h>
+#include <bit>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define ZENGINE_FRUSTUM_CULLING_X86 1
+#include <immintrin.h>
+#else
+#define ZENGINE_FRUSTUM_CULLING_X86 0
+#endif
+
+#if ZENGINE_FRUSTUM_CULLING_X86 && (defined(__GNUC__) || defined(__clang__))
+#define ZENGINE_TARGET_SSE4 __attribute__((target("sse4.1")))
+#define ZENGINE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define ZENGINE_TARGET_SSE4
+#define ZENGINE_TARGET_AVX2
+#endif
+
+static_assert(sizeof(ZEngine::Helpers::AABB) == (6 * sizeof(float)), "AABB is expected to be 6 tightly packed floats");
+
+namespace ZEngine::Helpers
+{
+    Frustum ExtractFrustum(const glm::mat4& view_projection)
+    {
+        auto row = [&view_projection](int index) {
+            return glm::vec4(view_projection[0][index], view_projection[1][index], view_projection[2][index], view_projection[3][index]);
+        };
+
+        Frustum frustum   = {};
+        frustum.Planes[0] = row(3) + row(0);
+        frustum.Planes[1] = row(3) - row(0);
+        frustum.Planes[2] = row(3) + row(1);
+        frustum.Planes[3] = row(3) - row(1);
+        frustum.Planes[4] = row(2);
+        frustum.Planes[5] = row(3) - row(2);
+        for (auto& plane : frustum.Planes)
+        {
+            plane /= glm::length(glm::vec3(plane));
+        }
+        return frustum;
+    }
+
+    /*
+     * A box is outside when its vertex the furthest along the plane normal is behind the plane.
+     * With the box center c and half extent e, that vertex distance is dot(n, c) + dot(|n|, e) + w
+     */
+    static inline bool IsAABBVisible(const Frustum& frustum, const AABB& bounds)
+    {
+        const glm::vec3 center = (bounds.Min + bounds.Max) * 0.5f;
+        const glm::vec3 extent = (bounds.Max - bounds.Min) * 0.5f;
+        for (const auto& plane : frustum.Planes)
+        {
+            const glm::vec3 normal = glm::vec3(plane);
+            if ((glm::dot(normal, center) + glm::dot(glm::abs(normal), extent) + plane.w) < 0.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static uint32_t CullScalar(const Frustum& frustum, const AABB* bounds, uint32_t count, uint8_t* visibility)
+    {
+        uint32_t visible_count = 0;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            visibility[i] = IsAABBVisible(frustum, bounds[i]) ? 1 : 0;
+            visible_count += visibility[i];
+        }
+        return visible_count;
+    }
+
+#if ZENGINE_FRUSTUM_CULLING_X86
+    /*
+     * Boxes are transposed into registers holding one component of 4 boxes, each plane is then tested against the 4 boxes at once
+     */
+    ZENGINE_TARGET_SSE4 static uint32_t CullSSE4(const Frustum& frustum, const AABB* bounds, uint32_t count, uint8_t* visibility)
+    {
+        const __m128 half     = _mm_set1_ps(0.5f);
+        const __m128 zero     = _mm_setzero_ps();
+        const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+        uint32_t visible_count = 0;
+        uint32_t i             = 0;
+        for (; (i + 4) <= count; i += 4)
+        {
+            const AABB* box = bounds + i;
+
+            __m128 min_x = _mm_setr_ps(box[0].Min.x, box[1].Min.x, box[2].Min.x, box[3].Min.x);
+            __m128 min_y = _mm_setr_ps(box[0].Min.y, box[1].Min.y, box[2].Min.y, box[3].Min.y);
+            __m128 min_z = _mm_setr_ps(box[0].Min.z, box[1].Min.z, box[2].Min.z, box[3].Min.z);
+            __m128 max_x = _mm_setr_ps(box[0].Max.x, box[1].Max.x, box[2].Max.x, box[3].Max.x);
+            __m128 max_y = _mm_setr_ps(box[0].Max.y, box[1].Max.y, box[2].Max.y, box[3].Max.y);
+            __m128 max_z = _mm_setr_ps(box[0].Max.z, box[1].Max.z, box[2].Max.z, box[3].Max.z);
+
+            const __m128 center_x = _mm_mul_ps(_mm_add_ps(min_x, max_x), half);
+            const __m128 center_y = _mm_mul_ps(_mm_add_ps(min_y, max_y), half);
+            const __m128 center_z = _mm_mul_ps(_mm_add_ps(min_z, max_z), half);
+            const __m128 extent_x = _mm_mul_ps(_mm_sub_ps(max_x, min_x), half);
+            const __m128 extent_y = _mm_mul_ps(_mm_sub_ps(max_y, min_y), half);
+            const __m128 extent_z = _mm_mul_ps(_mm_sub_ps(max_z, min_z), half);
+
+            __m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (const auto& plane : frustum.Planes)
+            {
+                const __m128 normal_x = _mm_set1_ps(plane.x);
+                const __m128 normal_y = _mm_set1_ps(plane.y);
+                const __m128 normal_z = _mm_set1_ps(plane.z);
+
+                __m128 distance = _mm_add_ps(_mm_mul_ps(normal_x, center_x), _mm_set1_ps(plane.w));
+                distance        = _mm_add_ps(distance, _mm_mul_ps(normal_y, center_y));
+                distance        = _mm_add_ps(distance, _mm_mul_ps(normal_z, center_z));
+                distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_and_ps(normal_x, abs_mask), extent_x));
+                distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_and_ps(normal_y, abs_mask), extent_y));
+                distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_and_ps(normal_z, abs_mask), extent_z));
+                visible         = _mm_and_ps(visible, _mm_cmpge_ps(distance, zero));
+            }
+
+            const int mask = _mm_movemask_ps(visible);
+            for (uint32_t lane = 0; lane < 4; ++lane)
+            {
+                visibility[i + lane] = (mask >> lane) & 1;
+            }
+            visible_count += std::popcount((uint32_t) mask);
+        }
+        return visible_count + CullScalar(frustum, bounds + i, count - i, visibility + i);
+    }
+
+    /*
+     * Same as CullSSE4 with 8 boxes per register, components are gathered with a stride of one AABB (6 floats)
+     */
+    ZENGINE_TARGET_AVX2 static uint32_t CullAVX2(const Frustum& frustum, const AABB* bounds, uint32_t count, uint8_t* visibility)
+    {
+        const __m256  half     = _mm256_set1_ps(0.5f);
+        const __m256  zero     = _mm256_setzero_ps();
+        const __m256  abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+        const __m256i stride   = _mm256_setr_epi32(0, 6, 12, 18, 24, 30, 36, 42);
+
+        uint32_t visible_count = 0;
+        uint32_t i             = 0;
+        for (; (i + 8) <= count; i += 8)
+        {
+            const float* box = reinterpret_cast<const float*>(bounds + i);
+
+            const __m256 min_x = _mm256_i32gather_ps(box, stride, 4);
+            const __m256 min_y = _mm256_i32gather_ps(box + 1, stride, 4);
+            const __m256 min_z = _mm256_i32gather_ps(box + 2, stride, 4);
+            const __m256 max_x = _mm256_i32gather_ps(box + 3, stride, 4);
+            const __m256 max_y = _mm256_i32gather_ps(box + 4, stride, 4);
+            const __m256 max_z = _mm256_i32gather_ps(box + 5, stride, 4);
+
+            const __m256 center_x = _mm256_mul_ps(_mm256_add_ps(min_x, max_x), half);
+            const __m256 center_y = _mm256_mul_ps(_mm256_add_ps(min_y, max_y), half);
+            const __m256 center_z = _mm256_mul_ps(_mm256_add_ps(min_z, max_z), half);
+            const __m256 extent_x = _mm256_mul_ps(_mm256_sub_ps(max_x, min_x), half);
+            const __m256 extent_y = _mm256_mul_ps(_mm256_sub_ps(max_y, min_y), half);
+            const __m256 extent_z = _mm256_mul_ps(_mm256_sub_ps(max_z, min_z), half);
+
+            __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (const auto& plane : frustum.Planes)
+            {
+                const __m256 normal_x = _mm256_set1_ps(plane.x);
+                const __m256 normal_y = _mm256_set1_ps(plane.y);
+                const __m256 normal_z = _mm256_set1_ps(plane.z);
+
+                __m256 distance = _mm256_fmadd_ps(normal_x, center_x, _mm256_set1_ps(plane.w));
+                distance        = _mm256_fmadd_ps(normal_y, center_y, distance);
+                distance        = _mm256_fmadd_ps(normal_z, center_z, distance);
+                distance        = _mm256_fmadd_ps(_mm256_and_ps(normal_x, abs_mask), extent_x, distance);
+                distance        = _mm256_fmadd_ps(_mm256_and_ps(normal_y, abs_mask), extent_y, distance);
+                distance        = _mm256_fmadd_ps(_mm256_and_ps(normal_z, abs_mask), extent_z, distance);
+                visible         = _mm256_and_ps(visible, _mm256_cmp_ps(distance, zero, _CMP_GE_OQ));
+            }
+
+            const int mask = _mm256_movemask_ps(visible);
+            for (uint32_t lane = 0; lane < 8; ++lane)
+            {
+                visibility[i + lane] = (mask >> lane) & 1;
+            }
+            visible_count += std::popcount((uint32_t) mask);
+        }
+        return visible_count + CullScalar(frustum, bounds + i, count - i, visibility + i);
+    }
+#endif
+
+    bool IsSphereVisible(const Frustum& frustum, const glm::vec3& center, float radius)
+    {
+        for (const auto& plane : frustum.Planes)
+        {
+            if ((glm::dot(glm::vec3(plane), center) + plane.w) < -radius)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint32_t CullAABBBatch(const Frustum& frustum, const AABB* bounds, uint32_t count, uint8_t* visibility)
+    {
+        return CullAABBBatch(GetSimdBackend(), frustum, bounds, count, visibility);
+    }
+
+    uint32_t CullAABBBatch(SimdBackend backend, const Frustum& frustum, const AABB* bounds, uint32_t count, uint8_t* visibility)
+    {
+        switch (backend)
+        {
+#if ZENGINE_FRUSTUM_CULLING_X86
+            case SimdBackend::AVX2:
+                return CullAVX2(frustum, bounds, count, visibility);
+            case SimdBackend::SSE4:
+                return CullSSE4(frustum, bounds, count, visibility);
+#endif
+            default:
+                return CullScalar(frustum, bounds, count, visibility);
+        }
+    }
+} // namespace ZEngine::Helpers
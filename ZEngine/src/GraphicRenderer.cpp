@@ -88,7 +88,7 @@ namespace ZEngine::Rendering::Renderers
         GetRendererInformation();
     }
 
-    void GraphicRenderer::DrawScene(const Ref<Rendering::Cameras::Camera>& camera, const Ref<Rendering::Scenes::SceneRawData>& data)
+    void GraphicRenderer::DrawScene(const Ref<Rendering::Cameras::Camera>& camera, const Ref<Rendering::Scenes::SceneSnapshot>& data)
     {
         s_current_command_buffer = s_command_pool->GetCommmandBuffer();
 
@@ -96,12 +96,23 @@ namespace ZEngine::Rendering::Renderers
         auto  ubo_camera_data = UBOCameraLayout{.View = camera->GetViewMatrix(), .Projection = camera->GetPerspectiveMatrix(), .Position = glm::vec4(camera->GetPosition(), 1.0f)};
         scene_camera[s_renderer_information.CurrentFrameIndex].SetData(&ubo_camera_data, sizeof(UBOCameraLayout));
         {
+            s_scene_renderer->StartScene(camera->GetPosition(), camera->GetViewMatrix(), camera->GetPerspectiveMatrix());
             s_scene_renderer->StartScene(s_current_command_buffer);
             s_scene_renderer->RenderScene(data, s_renderer_information.CurrentFrameIndex);
             s_scene_renderer->EndScene(s_current_command_buffer, s_renderer_information.CurrentFrameIndex);
         }
     }
 
+    void GraphicRenderer::SetSceneCullingMode(SceneCullingMode mode)
+    {
+        s_scene_renderer->SetCullingMode(mode);
+    }
+
+    SceneCullingMode GraphicRenderer::GetSceneCullingMode()
+    {
+        return s_scene_renderer->GetCullingMode();
+    }
+
     void GraphicRenderer::BeginImguiFrame()
     {
         s_current_command_buffer_ui = s_command_pool->GetCommmandBuffer();
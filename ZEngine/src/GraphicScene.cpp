@@ -11,13 +11,24 @@
 #include <Rendering/Components/UUIComponent.h>
 #include <Rendering/Components/ValidComponent.h>
 #include <Rendering/Lights/DirectionalLight.h>
+#include <Rendering/Meshes/VertexQuantization.h>
+#include <Rendering/Meshes/MeshOptimizer.h>
+#include <Rendering/Meshes/MeshSimplifier.h>
+#include <Rendering/Meshes/MeshletBuilder.h>
+#include <Rendering/Meshes/IndexPacking.h>
 #include <Core/Coroutine.h>
 
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 #include <assimp/pbrmaterial.h>
 #include <Helpers/MathHelper.h>
+#include <Helpers/MatrixBatch.h>
+#include <Helpers/MemoryMappedFile.h>
+#include <Helpers/ThreadPool.h>
 #include <fmt/format.h>
+#include <chrono>
+#include <numeric>
+#include <unordered_map>
 
 #include <Rendering/Textures/Texture2D.h>
 
@@ -32,6 +43,16 @@
 #define SCENE_ROOT_DEPTH_LEVEL 0
 #define INVALID_SCENE_NODE_ID -1
 #define INVALID_TEXTURE_MAP 0xFFFFFFFF
+#define TRANSFORM_MIN_BATCH_SIZE 256
+#define SPATIAL_QUERY_MIN_BATCH_SIZE 16
+#define COOKED_ASSET_COPY_BLOCK_SIZE (4 << 20)
+#define SNAPSHOT_MAX_GEOMETRY_BLOCK_COUNT 64
+#define TEXTURE_IMPORT_BATCH_SIZE 8u
+#define MESH_OVERDRAW_THRESHOLD 1.05f
+#define MESH_LOD_MAX_ERROR 0.05f
+#define MESH_LOD_MIN_INDEX_COUNT 384
+#define MESH_LOD_MIN_REDUCTION 0.8f
+#define MESH_MESHLET_MIN_TRIANGLE_COUNT 8192
 
 using namespace ZEngine::Controllers;
 using namespace ZEngine::Rendering::Components;
@@ -39,399 +60,182 @@ using namespace ZEngine::Rendering::Entities;
 
 namespace ZEngine::Rendering::Scenes
 {
-    std::recursive_mutex     GraphicScene::s_scene_node_mutex;
-    std::vector<std::string> GraphicScene::s_texture_file_collection = {};
-    Ref<SceneRawData>        GraphicScene::s_raw_data                = CreateRef<SceneRawData>();
-
-    void GraphicScene::Initialize()
-    {
-        s_raw_data->EntityRegistry = std::make_shared<entt::registry>();
-    }
-
-    void GraphicScene::Deinitialize()
-    {
-        s_raw_data->TextureCollection->Dispose();
-    }
-
-    std::future<GraphicSceneEntity> GraphicScene::CreateEntityAsync(std::string_view entity_name)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-
-        auto scene_node_identifier = co_await AddNodeAsync(SCENE_ROOT_PARENT_ID, SCENE_ROOT_DEPTH_LEVEL);
-        co_await SetSceneNodeNameAsync(scene_node_identifier, entity_name);
-
-        auto  scene_entity   = GraphicSceneEntity::CreateWrapper(s_raw_data->EntityRegistry, s_raw_data->SceneNodeEntityMap[scene_node_identifier]);
-        auto& name_component = scene_entity.GetComponent<NameComponent>();
-        name_component.Name  = entity_name;
-        co_return scene_entity;
-    }
-
-    std::future<GraphicSceneEntity> GraphicScene::CreateEntityAsync(uuids::uuid uuid, std::string_view entity_name)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-        auto             scene_entity = co_await CreateEntityAsync(entity_name);
-        scene_entity.AddComponent<UUIComponent>(uuid);
-        co_return scene_entity;
-    }
-
-    std::future<GraphicSceneEntity> GraphicScene::CreateEntityAsync(std::string_view uuid_string, std::string_view entity_name)
+    static inline bool IsSceneNodeDirty(const std::vector<uint64_t>& dirty_bitset, uint32_t node_identifier)
     {
-        std::unique_lock lock(s_scene_node_mutex);
-        auto             scene_entity = co_await CreateEntityAsync(entity_name);
-        scene_entity.AddComponent<UUIComponent>(uuid_string);
-        co_return scene_entity;
+        return (dirty_bitset[node_identifier >> 6] & (1ull << (node_identifier & 63))) != 0;
     }
 
-    std::future<Entities::GraphicSceneEntity> GraphicScene::GetEntityAsync(std::string_view entity_name)
+    static inline void SetSceneNodeDirty(std::vector<uint64_t>& dirty_bitset, uint32_t node_identifier)
     {
-        std::unique_lock lock(s_scene_node_mutex);
-
-        entt::entity entity_handle{entt::null};
-        auto         views = s_raw_data->EntityRegistry->view<NameComponent>();
-        for (auto entity : views)
-        {
-            auto name = views.get<NameComponent>(entity).Name;
-            if (name == entity_name)
-            {
-                entity_handle = entity;
-                break;
-            }
-        }
-
-        if (entity_handle == entt::null)
-        {
-            ZENGINE_CORE_ERROR("An entity with name {0} deosn't exist", entity_name)
-        }
-
-        co_return GraphicSceneEntity::CreateWrapper(s_raw_data->EntityRegistry, entity_handle);
+        dirty_bitset[node_identifier >> 6] |= (1ull << (node_identifier & 63));
     }
 
-    std::future<bool> GraphicScene::RemoveEntityAsync(const Entities::GraphicSceneEntity& entity)
+    static uint32_t CountAssetSceneNodes(const aiNode* node)
     {
-        std::unique_lock lock(s_scene_node_mutex);
-        if (!s_raw_data->EntityRegistry->valid(entity))
+        uint32_t count = 1 + node->mNumMeshes;
+        for (uint32_t i = 0; i < node->mNumChildren; ++i)
         {
-            ZENGINE_CORE_ERROR("This entity is no longer valid")
-            co_return false;
+            count += CountAssetSceneNodes(node->mChildren[i]);
         }
-        s_raw_data->EntityRegistry->destroy(entity);
-        co_return true;
-    }
-
-    std::shared_ptr<entt::registry> GraphicScene::GetRegistry()
-    {
-        return s_raw_data->EntityRegistry;
+        return count;
     }
 
-    std::future<int32_t> GraphicScene::AddNodeAsync(int parent_node_id, int depth_level)
+    /*
+     * Mesh references in the order CookAssetNode visits them : node meshes first, then children depth-first
+     */
+    static void CollectAssetMeshReferences(const aiNode* node, std::vector<uint32_t>& mesh_references)
     {
-        std::unique_lock lock(s_scene_node_mutex);
-
-        int scene_node_identifier = (int) s_raw_data->NodeHierarchyCollection.size();
-
-        s_raw_data->NodeHierarchyCollection.push_back({.Parent = parent_node_id});
-        s_raw_data->LocalTransformCollection.emplace_back(1.0f);
-        s_raw_data->GlobalTransformCollection.emplace_back(1.0f);
-
-        if (parent_node_id > SCENE_ROOT_PARENT_ID)
+        mesh_references.insert(mesh_references.end(), node->mMeshes, node->mMeshes + node->mNumMeshes);
+        for (uint32_t i = 0; i < node->mNumChildren; ++i)
         {
-            int first_child = s_raw_data->NodeHierarchyCollection[parent_node_id].FirstChild;
-
-            if (first_child == INVALID_SCENE_NODE_ID)
-            {
-                s_raw_data->NodeHierarchyCollection[parent_node_id].FirstChild = scene_node_identifier;
-            }
-            else
-            {
-                int right_sibling = s_raw_data->NodeHierarchyCollection[first_child].RightSibling;
-                if (right_sibling > INVALID_SCENE_NODE_ID)
-                {
-                    // iterate nextSibling_ indices
-                    for (right_sibling = first_child; s_raw_data->NodeHierarchyCollection[right_sibling].RightSibling != INVALID_SCENE_NODE_ID;
-                         right_sibling = s_raw_data->NodeHierarchyCollection[right_sibling].RightSibling)
-                    {
-                    }
-                    s_raw_data->NodeHierarchyCollection[right_sibling].RightSibling = scene_node_identifier;
-                }
-                else
-                {
-                    s_raw_data->NodeHierarchyCollection[first_child].RightSibling = scene_node_identifier;
-                }
-            }
+            CollectAssetMeshReferences(node->mChildren[i], mesh_references);
         }
-        s_raw_data->NodeHierarchyCollection[scene_node_identifier].DepthLevel   = depth_level;
-        s_raw_data->NodeHierarchyCollection[scene_node_identifier].RightSibling = INVALID_SCENE_NODE_ID;
-        s_raw_data->NodeHierarchyCollection[scene_node_identifier].FirstChild   = INVALID_SCENE_NODE_ID;
-        /*
-         * Extra SceneEntity information for a SceneNode
-         */
-        s_raw_data->SceneNodeEntityMap[scene_node_identifier] = s_raw_data->EntityRegistry->create();
-        auto entity_wrapper = GraphicSceneEntity::CreateWrapper(s_raw_data->EntityRegistry, s_raw_data->SceneNodeEntityMap[scene_node_identifier]);
-        entity_wrapper.AddComponent<TransformComponent>(s_raw_data->LocalTransformCollection[scene_node_identifier]);
-        entity_wrapper.AddComponent<UUIComponent>();
-        entity_wrapper.AddComponent<NameComponent>();
-
-        co_return scene_node_identifier;
-    }
-
-    std::future<bool> GraphicScene::RemoveNodeAsync(int32_t node_identifier)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-
-        return std::future<bool>();
-    }
-
-    int32_t GraphicScene::GetSceneNodeParent(int32_t node_identifier)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-        return (node_identifier < 0) ? INVALID_SCENE_NODE_ID : s_raw_data->NodeHierarchyCollection[node_identifier].Parent;
     }
 
-    int32_t GraphicScene::GetSceneNodeFirstChild(int32_t node_identifier)
+    /*
+     * Geometry of one assimp mesh, laid out as the scene vertex stream (IVertex until quantized) and indices.
+     * The first IndexCount indices are the full resolution mesh, its simplified levels follow
+     */
+    struct AssetMeshGeometry
     {
-        std::unique_lock lock(s_scene_node_mutex);
-        return (node_identifier < 0) ? INVALID_SCENE_NODE_ID : s_raw_data->NodeHierarchyCollection[node_identifier].FirstChild;
-    }
-
-    std::vector<int32_t> GraphicScene::GetSceneNodeSiblingCollection(int32_t node_identifier)
+        std::vector<float>            Vertices;
+        std::vector<uint32_t>         Indices;
+        uint32_t                      IndexCount{0};
+        Meshes::MeshLodSet            Lods;
+        std::vector<Meshes::Meshlet>  Meshlets;
+        double                        MeshletBuildMilliseconds{0.0};
+        Meshes::IndexFormat           IndexType{Meshes::IndexFormat::UINT32};
+        Helpers::AABB                 LocalBounds;
+        Meshes::VertexCacheStatistics SourceCacheStatistics;
+        Meshes::VertexCacheStatistics CacheStatistics;
+        Meshes::VertexFetchStatistics SourceFetchStatistics;
+        Meshes::VertexFetchStatistics FetchStatistics;
+    };
+
+    static void ExtractAssetMeshGeometry(const aiMesh* assimp_mesh, AssetMeshGeometry& geometry)
     {
-        std::unique_lock lock(s_scene_node_mutex);
-
-        std::vector<int32_t> sibling_scene_nodes = {};
-        if (node_identifier < 0)
-        {
-            return sibling_scene_nodes;
-        }
+        const uint32_t vertex_float_count = sizeof(Renderers::Storages::IVertex) / sizeof(float);
+        const bool     has_normals        = assimp_mesh->HasNormals();
+        const bool     has_tex_coords     = assimp_mesh->HasTextureCoords(0);
 
-        for (auto sibling = s_raw_data->NodeHierarchyCollection[node_identifier].RightSibling; sibling != INVALID_SCENE_NODE_ID;
-             sibling      = s_raw_data->NodeHierarchyCollection[sibling].RightSibling)
+        geometry.Vertices.resize((size_t) assimp_mesh->mNumVertices * vertex_float_count);
+        for (uint32_t i = 0; i < assimp_mesh->mNumVertices; ++i)
         {
-            sibling_scene_nodes.push_back(sibling);
+            float*           vertex    = geometry.Vertices.data() + (size_t) i * vertex_float_count;
+            const aiVector3D position  = assimp_mesh->mVertices[i];
+            const aiVector3D normal    = has_normals ? assimp_mesh->mNormals[i] : aiVector3D(0.0f);
+            const aiVector3D tex_coord = has_tex_coords ? assimp_mesh->mTextureCoords[0][i] : aiVector3D(0.0f);
+            vertex[0]                  = position.x;
+            vertex[1]                  = position.y;
+            vertex[2]                  = position.z;
+            vertex[3]                  = normal.x;
+            vertex[4]                  = normal.y;
+            vertex[5]                  = normal.z;
+            vertex[6]                  = tex_coord.x;
+            vertex[7]                  = tex_coord.y;
+            geometry.LocalBounds.Grow(glm::vec3(position.x, position.y, position.z));
         }
 
-        return sibling_scene_nodes;
-    }
-
-    std::string_view GraphicScene::GetSceneNodeName(int32_t node_identifier)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-        return s_raw_data->SceneNodeNameMap.contains(node_identifier) ? s_raw_data->SceneNodeNameMap[node_identifier] : std::string_view();
-    }
-
-    glm::mat4& GraphicScene::GetSceneNodeLocalTransform(int32_t node_identifier)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-        ZENGINE_VALIDATE_ASSERT((node_identifier > INVALID_SCENE_NODE_ID) && (node_identifier < s_raw_data->LocalTransformCollection.size()), "node identifier is invalid")
-        return s_raw_data->LocalTransformCollection[node_identifier];
-    }
-
-    glm::mat4& GraphicScene::GetSceneNodeGlobalTransform(int32_t node_identifier)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-        ZENGINE_VALIDATE_ASSERT(node_identifier > INVALID_SCENE_NODE_ID && node_identifier < s_raw_data->GlobalTransformCollection.size(), "node identifier is invalid")
-        return s_raw_data->GlobalTransformCollection[node_identifier];
-    }
-
-    const SceneNodeHierarchy& GraphicScene::GetSceneNodeHierarchy(int32_t node_identifier)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-        ZENGINE_VALIDATE_ASSERT(node_identifier > INVALID_SCENE_NODE_ID && node_identifier < s_raw_data->NodeHierarchyCollection.size(), "node identifier is invalid")
-        return s_raw_data->NodeHierarchyCollection[node_identifier];
-    }
-
-    GraphicSceneEntity GraphicScene::GetSceneNodeEntityWrapper(int32_t node_identifier)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-        ZENGINE_VALIDATE_ASSERT(s_raw_data->SceneNodeEntityMap.contains(node_identifier), "node identifier is invalid")
-        return GraphicSceneEntity::CreateWrapper(s_raw_data->EntityRegistry, s_raw_data->SceneNodeEntityMap[node_identifier]);
-    }
-
-    std::future<void> GraphicScene::SetSceneNodeNameAsync(int32_t node_identifier, std::string_view node_name)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-        ZENGINE_VALIDATE_ASSERT(node_identifier > INVALID_SCENE_NODE_ID, "node identifier is invalid")
-        s_raw_data->SceneNodeNameMap[node_identifier] = node_name;
-        co_return;
-    }
-
-    std::future<Meshes::MeshVNext> GraphicScene::GetSceneNodeMeshAsync(int32_t node_identifier)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-        ZENGINE_VALIDATE_ASSERT(s_raw_data->SceneNodeMeshMap.contains(node_identifier), "node identifier is invalid")
-        co_return s_raw_data->SceneNodeMeshMap[node_identifier];
-    }
-
-    std::future<void> GraphicScene::ImportAssetAsync(std::string_view asset_filename)
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-
-        if (!asset_filename.empty())
+        geometry.Indices.reserve((size_t) assimp_mesh->mNumFaces * 3);
+        for (uint32_t i = 0; i < assimp_mesh->mNumFaces; ++i)
         {
-            __ReadAssetFileAsync(asset_filename, [](bool success, const void* scene, std::string_view material_texture_parent_path) -> std::future<void> {
-                if (success && scene)
-                {
-                    auto    scene_ptr         = reinterpret_cast<const aiScene*>(scene);
-                    aiNode* root_node         = scene_ptr->mRootNode;
-                    bool    traverse_complete = co_await __TraverseAssetNodeAsync(scene_ptr, root_node, SCENE_ROOT_PARENT_ID, SCENE_ROOT_DEPTH_LEVEL, material_texture_parent_path);
-
-                    if (traverse_complete)
-                    {
-                        /*
-                         * Post-processing Material data
-                         */
-                        PostProcessMaterials();
-                    }
-                }
-            });
+            const aiFace& face = assimp_mesh->mFaces[i];
+            geometry.Indices.insert(geometry.Indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
         }
-        co_return;
-    }
-
-    Ref<SceneRawData> GraphicScene::GetRawData()
-    {
-        std::lock_guard lock(s_scene_node_mutex);
-        return s_raw_data;
-    }
-
-    bool GraphicScene::HasSceneNodes()
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-        return !s_raw_data->NodeHierarchyCollection.empty();
     }
 
-    std::vector<int32_t> GraphicScene::GetRootSceneNodes()
+    /*
+     * Each level halves the index count of the previous one, until the error budget is spent or a level no longer saves enough.
+     * Levels are simplified from the previous one, so their errors add up. They are appended after the full resolution indices
+     */
+    static void GenerateAssetMeshLods(AssetMeshGeometry& geometry, uint32_t vertex_count)
     {
-        std::unique_lock     lock(s_scene_node_mutex);
-        std::vector<int32_t> root_scene_nodes;
-
-        if (!HasSceneNodes())
-        {
-            return root_scene_nodes;
-        }
-
-        for (uint32_t i = 0; i < s_raw_data->NodeHierarchyCollection.size(); ++i)
+        const uint32_t        vertex_float_count = sizeof(Renderers::Storages::IVertex) / sizeof(float);
+        std::vector<uint32_t> level_indices      = geometry.Indices;
+        float                 level_error        = 0.0f;
+        while (geometry.Lods.Count < Meshes::MAX_MESH_LOD_COUNT)
         {
-            if (s_raw_data->NodeHierarchyCollection[i].Parent == SCENE_ROOT_PARENT_ID)
+            const size_t target_index_count = (level_indices.size() / 6) * 3;
+            if (target_index_count < MESH_LOD_MIN_INDEX_COUNT)
             {
-                root_scene_nodes.push_back(i);
+                break;
             }
-        }
-        return root_scene_nodes;
-    }
 
-    void GraphicScene::ComputeAllTransforms()
-    {
-        std::unique_lock lock(s_scene_node_mutex);
-        uint32_t         total_level = s_raw_data->LevelSceneNodeChangedMap.size();
-        for (int level = 0; level < total_level; ++level)
-        {
-            if (!s_raw_data->LevelSceneNodeChangedMap[level].empty())
+            float                 error      = 0.0f;
+            std::vector<uint32_t> simplified = Meshes::SimplifyMesh(
+                level_indices, geometry.Vertices.data(), vertex_count, vertex_float_count, target_index_count, std::max(MESH_LOD_MAX_ERROR - level_error, 0.0f), &error);
+            if (simplified.size() > (level_indices.size() * MESH_LOD_MIN_REDUCTION))
             {
-                auto& changed_scene_node_collection = s_raw_data->LevelSceneNodeChangedMap[level];
-                for (const int& node_identifier : changed_scene_node_collection)
-                {
-                    if (node_identifier != SCENE_ROOT_PARENT_ID)
-                    {
-                        int parent = s_raw_data->NodeHierarchyCollection[node_identifier].Parent;
-                        if (parent != SCENE_ROOT_PARENT_ID)
-                        {
-                            s_raw_data->GlobalTransformCollection[node_identifier] =
-                                s_raw_data->GlobalTransformCollection[parent] * s_raw_data->LocalTransformCollection[node_identifier];
-                        }
-                    }
-                }
-                s_raw_data->LevelSceneNodeChangedMap[level].clear();
+                break;
             }
+
+            level_indices = std::move(simplified);
+            level_error += error;
+            Meshes::OptimizeVertexCache(level_indices, vertex_count);
+
+            auto& level       = geometry.Lods.Levels[geometry.Lods.Count++];
+            level.IndexOffset = (uint32_t) geometry.Indices.size();
+            level.IndexCount  = (uint32_t) level_indices.size();
+            level.Error       = level_error;
+            geometry.Indices.insert(geometry.Indices.end(), level_indices.begin(), level_indices.end());
         }
     }
 
-    void GraphicScene::MarkSceneNodeAsChanged(int32_t node_identifier)
+    /*
+     * Triangles are ordered for the post-transform cache then for overdraw, and vertices are moved in the order the indices first use them :
+     * final_color.vert pulls vertices through the index buffer, so both orders matter. The LOD levels share the vertices of the full mesh,
+     * so they are generated before vertices move. Large meshes are then split into meshlets over the final order of their full resolution
+     * range, so that the renderer culls them cluster by cluster. Other primitive types are left as they are
+     */
+    static void OptimizeAssetMeshGeometry(const aiMesh* assimp_mesh, AssetMeshGeometry& geometry)
     {
-        std::unique_lock lock(s_scene_node_mutex);
-
-        if (s_raw_data->NodeHierarchyCollection.empty())
+        const uint32_t vertex_float_count = sizeof(Renderers::Storages::IVertex) / sizeof(float);
+        auto           vertex_count       = (uint32_t) (geometry.Vertices.size() / vertex_float_count);
+        geometry.IndexCount               = (uint32_t) geometry.Indices.size();
+        geometry.SourceCacheStatistics    = Meshes::AnalyzeVertexCache(geometry.Indices, vertex_count);
+        geometry.SourceFetchStatistics    = Meshes::AnalyzeVertexFetch(geometry.Indices, vertex_count, sizeof(Renderers::Storages::IVertex));
+        if (assimp_mesh->mPrimitiveTypes == aiPrimitiveType_TRIANGLE)
         {
-            return;
-        }
+            Meshes::OptimizeVertexCache(geometry.Indices, vertex_count);
+            Meshes::OptimizeOverdraw(geometry.Indices, geometry.Vertices.data(), vertex_count, vertex_float_count, MESH_OVERDRAW_THRESHOLD);
+            GenerateAssetMeshLods(geometry, vertex_count);
+            vertex_count = Meshes::OptimizeVertexFetch(geometry.Indices, geometry.Vertices, vertex_float_count);
 
-        auto node_level = s_raw_data->NodeHierarchyCollection[node_identifier].DepthLevel;
-        s_raw_data->LevelSceneNodeChangedMap[node_level].emplace(node_identifier);
-
-        auto first_child = s_raw_data->NodeHierarchyCollection[node_identifier].FirstChild;
-        if (first_child != INVALID_SCENE_NODE_ID)
-        {
-            auto sibling_collection = GetSceneNodeSiblingCollection(first_child);
-            s_raw_data->LevelSceneNodeChangedMap[node_level].emplace(first_child);
-            for (auto sibling : sibling_collection)
+            if ((geometry.IndexCount / 3) >= MESH_MESHLET_MIN_TRIANGLE_COUNT)
             {
-                s_raw_data->LevelSceneNodeChangedMap[node_level].emplace(sibling);
+                const auto start                  = std::chrono::steady_clock::now();
+                geometry.Meshlets                 = Meshes::BuildMeshlets(geometry.Indices.data(), geometry.IndexCount, geometry.Vertices.data(), vertex_count, vertex_float_count);
+                geometry.MeshletBuildMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
             }
         }
+
+        const std::vector<uint32_t> full_indices(geometry.Indices.begin(), geometry.Indices.begin() + geometry.IndexCount);
+        geometry.CacheStatistics = Meshes::AnalyzeVertexCache(full_indices, vertex_count);
+        geometry.FetchStatistics = Meshes::AnalyzeVertexFetch(full_indices, vertex_count, sizeof(Renderers::Storages::IVertex));
     }
 
-    std::future<bool> GraphicScene::__TraverseAssetNodeAsync(
-        const aiScene*   assimp_scene,
-        aiNode*          node,
-        int              parent_node,
-        int              depth_level,
-        std::string_view material_texture_parent_path)
+    /*
+     * Texture files are cooked as paths, the scene resolves them into its own texture indices when the asset is added
+     */
+    static uint32_t CookAssetTextureFile(std::string_view filename, CookedAssetData& cooked_asset, std::unordered_map<std::string, uint32_t>& texture_file_indices)
     {
-        std::unique_lock lock(s_scene_node_mutex);
-
-        bool result = true;
-        if (!assimp_scene && !node)
-        {
-            result = false;
-            co_return result;
-        }
-
-        auto scene_node_identifier                                  = co_await AddNodeAsync(parent_node, depth_level);
-        s_raw_data->SceneNodeNameMap[scene_node_identifier]         = node->mName.C_Str() ? std::string(node->mName.C_Str()) : std::string{"<unamed node>"};
-        s_raw_data->LocalTransformCollection[scene_node_identifier] = Helpers::ConvertToMat4(node->mTransformation);
-
-        for (uint32_t i = 0; i < node->mNumMeshes; ++i)
-        {
-            const SceneNodeHierarchy& hierarchy   = s_raw_data->NodeHierarchyCollection[scene_node_identifier];
-            int32_t                   sub_node_id = co_await AddNodeAsync(scene_node_identifier, hierarchy.DepthLevel + 1);
-            /*
-             * Processing Mesh data
-             */
-            uint32_t mesh_id   = node->mMeshes[i];
-            aiString mesh_name = assimp_scene->mMeshes[mesh_id]->mName;
-            s_raw_data->SceneNodeNameMap[sub_node_id] =
-                mesh_name.C_Str() ? std::string(mesh_name.C_Str()) : fmt::format("{0}_Mesh_{1}", s_raw_data->SceneNodeNameMap[scene_node_identifier].c_str(), i);
-            s_raw_data->SceneNodeMeshMap[sub_node_id] = co_await __ReadSceneNodeMeshDataAsync(assimp_scene, mesh_id);
-            /*
-             * Processing Material data
-             */
-            uint32_t material_id                              = assimp_scene->mMeshes[mesh_id]->mMaterialIndex;
-            aiString material_name                            = assimp_scene->mMaterials[material_id]->GetName();
-            s_raw_data->SceneNodeMaterialNameMap[sub_node_id] = material_name.C_Str() ? std::string(material_name.C_Str()) : std::string{};
-            s_raw_data->SceneNodeMaterialMap[sub_node_id]     = co_await __ReadSceneNodeMeshMaterialDataAsync(assimp_scene, material_id, material_texture_parent_path);
-        }
-
-        for (uint32_t i = 0; i < node->mNumChildren; ++i)
+        auto [texture_file, is_new_entry] = texture_file_indices.try_emplace(std::string(filename), (uint32_t) cooked_asset.TextureFiles.size());
+        if (is_new_entry)
         {
-            result = co_await __TraverseAssetNodeAsync(assimp_scene, node->mChildren[i], scene_node_identifier, depth_level + 1, material_texture_parent_path);
-            if (!result)
-            {
-                break;
-            }
+            cooked_asset.TextureFiles.push_back(cooked_asset.AddString(filename));
         }
-        co_return result;
+        return texture_file->second;
     }
 
-    std::future<Meshes::MeshMaterial> GraphicScene::__ReadSceneNodeMeshMaterialDataAsync(
-        const aiScene*   assimp_scene,
-        uint32_t         material_identifier,
-        std::string_view material_texture_parent_path)
+    static Meshes::MeshMaterial CookAssetMaterial(
+        const aiMaterial*                          assimp_material,
+        std::string_view                           material_texture_parent_path,
+        CookedAssetData&                           cooked_asset,
+        std::unordered_map<std::string, uint32_t>& texture_file_indices)
     {
-        std::unique_lock lock(s_scene_node_mutex);
-
         Meshes::MeshMaterial output_material = {};
 
-        aiMaterial* assimp_material = assimp_scene->mMaterials[material_identifier];
-        aiColor4D   ai_color;
+        aiColor4D ai_color;
 
         if (aiGetMaterialColor(assimp_material, AI_MATKEY_COLOR_AMBIENT, &ai_color) == AI_SUCCESS)
         {
@@ -508,7 +312,7 @@ namespace ZEngine::Rendering::Scenes
             AI_SUCCESS)
         {
             auto filename                      = fmt::format(texture_dir_fomart, material_texture_parent_path, texture_filename.C_Str());
-            output_material.EmissiveTextureMap = AddTexture(filename);
+            output_material.EmissiveTextureMap = CookAssetTextureFile(filename, cooked_asset, texture_file_indices);
         }
 
         if (aiGetMaterialTexture(
@@ -516,7 +320,7 @@ namespace ZEngine::Rendering::Scenes
             AI_SUCCESS)
         {
             auto filename                    = fmt::format(texture_dir_fomart, material_texture_parent_path, texture_filename.C_Str());
-            output_material.AlbedoTextureMap = AddTexture(filename);
+            output_material.AlbedoTextureMap = CookAssetTextureFile(filename, cooked_asset, texture_file_indices);
         }
 
         if (aiGetMaterialTexture(
@@ -524,7 +328,7 @@ namespace ZEngine::Rendering::Scenes
             AI_SUCCESS)
         {
             auto filename                    = fmt::format(texture_dir_fomart, material_texture_parent_path, texture_filename.C_Str());
-            output_material.NormalTextureMap = AddTexture(filename);
+            output_material.NormalTextureMap = CookAssetTextureFile(filename, cooked_asset, texture_file_indices);
         }
 
         if (output_material.NormalTextureMap == INVALID_TEXTURE_MAP)
@@ -534,7 +338,7 @@ namespace ZEngine::Rendering::Scenes
                 AI_SUCCESS)
             {
                 auto filename                    = fmt::format(texture_dir_fomart, material_texture_parent_path, texture_filename.C_Str());
-                output_material.NormalTextureMap = AddTexture(filename);
+                output_material.NormalTextureMap = CookAssetTextureFile(filename, cooked_asset, texture_file_indices);
             }
         }
 
@@ -543,169 +347,244 @@ namespace ZEngine::Rendering::Scenes
             AI_SUCCESS)
         {
             auto filename                     = fmt::format(texture_dir_fomart, material_texture_parent_path, texture_filename.C_Str());
-            output_material.OpacityTextureMap = AddTexture(filename);
+            output_material.OpacityTextureMap = CookAssetTextureFile(filename, cooked_asset, texture_file_indices);
             output_material.AlphaTest         = 0.5f;
         }
-        co_return output_material;
+        return output_material;
     }
-
-    std::future<Meshes::MeshVNext> GraphicScene::__ReadSceneNodeMeshDataAsync(const aiScene* assimp_scene, uint32_t mesh_identifier)
+    /*
+     * Each assimp material referenced by a mesh is cooked once. Returns the cooked material of each assimp material
+     */
+    static std::vector<uint32_t> CookAssetMaterials(const aiScene* assimp_scene, std::string_view material_texture_parent_path, CookedAssetData& cooked_asset)
     {
-        std::unique_lock lock(s_scene_node_mutex);
-
-        aiMesh* assimp_mesh = assimp_scene->mMeshes[mesh_identifier];
-
-        uint32_t               vertex_count{0};
-        std::vector<float>&    vertices = s_raw_data->Vertices;
-        std::vector<uint32_t>& indices  = s_raw_data->Indices;
-
-        /* Vertice processing */
-        for (int i = 0; i < assimp_mesh->mNumVertices; ++i)
+        std::unordered_map<std::string, uint32_t> texture_file_indices;
+        std::vector<uint32_t>                     cooked_material_indices(assimp_scene->mNumMaterials, 0xFFFFFFFF);
+        for (uint32_t mesh_id = 0; mesh_id < assimp_scene->mNumMeshes; ++mesh_id)
         {
-            const aiVector3D position = assimp_mesh->mVertices[i];
-            vertices.push_back(position.x);
-            vertices.push_back(position.y);
-            vertices.push_back(position.z);
-
-            const aiVector3D normal = assimp_mesh->mNormals[i];
-            vertices.push_back(normal.x);
-            vertices.push_back(normal.y);
-            vertices.push_back(normal.z);
-
-            if (assimp_mesh->HasTextureCoords(0))
-            {
-                const aiVector3D tex_coord = assimp_mesh->mTextureCoords[0][i];
-                vertices.push_back(tex_coord.x);
-                vertices.push_back(tex_coord.y);
-            }
-            else
+            const uint32_t material_id = assimp_scene->mMeshes[mesh_id]->mMaterialIndex;
+            if (cooked_material_indices[material_id] != 0xFFFFFFFF)
             {
-                vertices.push_back(0.0);
-                vertices.push_back(0.0);
+                continue;
             }
 
-            vertex_count++;
+            const aiMaterial* assimp_material    = assimp_scene->mMaterials[material_id];
+            cooked_material_indices[material_id] = (uint32_t) cooked_asset.Materials.size();
+            cooked_asset.Materials.push_back(CookAssetMaterial(assimp_material, material_texture_parent_path, cooked_asset, texture_file_indices));
+            cooked_asset.MaterialNames.push_back(cooked_asset.AddString(assimp_material->GetName().C_Str()));
         }
+        return cooked_material_indices;
+    }
 
-        /* Face and Indices processing */
-        uint32_t index_count{0};
-        for (int x = 0; x < assimp_mesh->mNumFaces; ++x)
-        {
-            aiFace assimp_mesh_face = assimp_mesh->mFaces[x];
+    /*
+     * Nodes referencing the same assimp mesh share a single geometry range, so only the referenced meshes are cooked, once each.
+     * Returns the cooked mesh of each assimp mesh, -1 for the meshes no node references
+     */
+    static std::vector<int32_t> CookAssetMeshes(
+        const aiScene* assimp_scene, const std::vector<uint32_t>& cooked_material_indices, Meshes::VertexFormat vertex_format, CookedAssetData& cooked_asset)
+    {
+        std::vector<uint32_t> mesh_id_collection;
+        CollectAssetMeshReferences(assimp_scene->mRootNode, mesh_id_collection);
 
-            for (int y = 0; y < assimp_mesh_face.mNumIndices; ++y)
+        std::vector<int32_t>  cooked_mesh_indices(assimp_scene->mNumMeshes, -1);
+        std::vector<uint32_t> unique_mesh_id_collection;
+        for (uint32_t mesh_id : mesh_id_collection)
+        {
+            if (cooked_mesh_indices[mesh_id] < 0)
             {
-                indices.push_back(assimp_mesh_face.mIndices[y]);
-
-                index_count++;
+                cooked_mesh_indices[mesh_id] = (int32_t) unique_mesh_id_collection.size();
+                unique_mesh_id_collection.push_back(mesh_id);
             }
         }
+        /*
+         * Each assimp mesh is extracted, optimized (and quantized against its bounds) into its own buffers on the thread pool.
+         * Meshes of at most MAX_UINT16_INDEX_VERTEX_COUNT vertices then pack their indices two per word
+         */
+        const auto                     unique_mesh_count = (uint32_t) unique_mesh_id_collection.size();
+        std::vector<AssetMeshGeometry> geometry_collection(unique_mesh_count);
+        Helpers::ThreadPoolHelper::ParallelFor(unique_mesh_count, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                const aiMesh* assimp_mesh = assimp_scene->mMeshes[unique_mesh_id_collection[i]];
+                auto&         geometry    = geometry_collection[i];
+                ExtractAssetMeshGeometry(assimp_mesh, geometry);
+                OptimizeAssetMeshGeometry(assimp_mesh, geometry);
+                if (vertex_format == Meshes::VertexFormat::QUANTIZED)
+                {
+                    Meshes::QuantizeVertices(geometry.Vertices, geometry.LocalBounds);
+                }
 
-        Meshes::MeshVNext mesh    = {};
-        mesh.VertexCount          = vertex_count;
-        mesh.VertexOffset         = s_raw_data->SVertexOffset;
-        mesh.VertexUnitStreamSize = sizeof(Renderers::Storages::IVertex);
-        mesh.StreamOffset         = (mesh.VertexUnitStreamSize * mesh.VertexOffset);
-        mesh.IndexOffset          = s_raw_data->SIndexOffset;
-        mesh.IndexCount           = index_count;
-        mesh.IndexUnitStreamSize  = sizeof(uint32_t);
-        mesh.IndexStreamOffset    = (mesh.IndexUnitStreamSize * mesh.IndexOffset);
-        mesh.TotalByteSize        = (mesh.VertexCount * mesh.VertexUnitStreamSize) + (mesh.IndexCount * mesh.IndexUnitStreamSize);
-
-        s_raw_data->SVertexOffset += assimp_mesh->mNumVertices;
-        s_raw_data->SIndexOffset += index_count;
-
-        co_return mesh;
+                geometry.IndexType = Meshes::SelectIndexFormat((uint32_t) (geometry.Vertices.size() / Meshes::GetVertexFloatCount(vertex_format)));
+                if (geometry.IndexType == Meshes::IndexFormat::UINT16)
+                {
+                    Meshes::PackIndices(geometry.Indices);
+                }
+            }
+        });
+        /*
+         * The exclusive prefix sum of the mesh sizes gives their ranges
+         */
+        std::vector<CookedMeshGeometry> packed_geometry_collection(unique_mesh_count);
+        cooked_asset.Meshes.resize(unique_mesh_count);
+        for (uint32_t i = 0; i < unique_mesh_count; ++i)
+        {
+            const auto& geometry          = geometry_collection[i];
+            auto&       mesh              = cooked_asset.Meshes[i];
+            mesh.IndexCount               = geometry.IndexCount;
+            mesh.Material                 = cooked_material_indices[assimp_scene->mMeshes[unique_mesh_id_collection[i]]->mMaterialIndex];
+            mesh.Format                   = vertex_format;
+            mesh.LocalBounds              = geometry.LocalBounds;
+            mesh.Lods                     = geometry.Lods;
+            mesh.IndexType                = geometry.IndexType;
+            packed_geometry_collection[i] = {.Vertices = geometry.Vertices, .Indices = geometry.Indices, .Meshlets = geometry.Meshlets};
+        }
+        PackCookedAssetMeshes(packed_geometry_collection, cooked_asset);
+
+        Meshes::VertexCacheStatistics source_cache_statistics;
+        Meshes::VertexCacheStatistics cache_statistics;
+        Meshes::VertexFetchStatistics source_fetch_statistics;
+        Meshes::VertexFetchStatistics fetch_statistics;
+        double                        meshlet_build_milliseconds = 0.0;
+        uint32_t                      uint16_index_mesh_count    = 0;
+        for (const auto& geometry : geometry_collection)
+        {
+            uint16_index_mesh_count += (geometry.IndexType == Meshes::IndexFormat::UINT16) ? 1 : 0;
+            source_cache_statistics += geometry.SourceCacheStatistics;
+            cache_statistics += geometry.CacheStatistics;
+            source_fetch_statistics += geometry.SourceFetchStatistics;
+            fetch_statistics += geometry.FetchStatistics;
+            meshlet_build_milliseconds += geometry.MeshletBuildMilliseconds;
+        }
+        ZENGINE_CORE_INFO(
+            "Asset import : mesh optimization ACMR {0:.3f} -> {1:.3f}, ATVR {2:.3f} -> {3:.3f}, vertex overfetch {4:.3f} -> {5:.3f}",
+            source_cache_statistics.GetACMR(),
+            cache_statistics.GetACMR(),
+            source_cache_statistics.GetATVR(),
+            cache_statistics.GetATVR(),
+            source_fetch_statistics.GetOverfetch(),
+            fetch_statistics.GetOverfetch())
+        if (!cooked_asset.Meshlets.empty())
+        {
+            ZENGINE_CORE_INFO("Asset import : {0} meshlets built in {1:.2f} ms (summed over the import workers)", cooked_asset.Meshlets.size(), meshlet_build_milliseconds)
+        }
+        ZENGINE_CORE_INFO(
+            "Asset import : {0} of {1} meshes use 16 bits indices, {2} KiB of indices",
+            uint16_index_mesh_count,
+            unique_mesh_count,
+            (cooked_asset.Indices.size() * sizeof(uint32_t)) / 1024)
+        return cooked_mesh_indices;
     }
 
-    int32_t GraphicScene::AddTexture(std::string_view filename)
+    /*
+     * Every assimp node becomes a scene node, with a child node for each of its mesh references. Nodes are cooked depth-first
+     */
+    static void CookAssetNode(
+        const aiScene*              assimp_scene,
+        const aiNode*               node,
+        int32_t                     parent_node,
+        int32_t                     depth_level,
+        const std::vector<int32_t>& cooked_mesh_indices,
+        CookedAssetData&            cooked_asset)
     {
-        std::unique_lock lock(s_scene_node_mutex);
+        const auto node_index = (int32_t) cooked_asset.Nodes.size();
+        const auto node_name  = node->mName.C_Str() ? std::string_view(node->mName.C_Str()) : std::string_view{"<unamed node>"};
+        cooked_asset.Nodes.push_back({.Parent = parent_node, .DepthLevel = depth_level, .Name = cooked_asset.AddString(node_name)});
+        cooked_asset.LocalTransforms.push_back(Helpers::ConvertToMat4(node->mTransformation));
 
-        if (filename.empty())
+        for (uint32_t i = 0; i < node->mNumMeshes; ++i)
         {
-            return -1;
+            uint32_t mesh_id   = node->mMeshes[i];
+            aiString mesh_name = assimp_scene->mMeshes[mesh_id]->mName;
+            auto     sub_node  = CookedAssetNode{.Parent = node_index, .DepthLevel = depth_level + 1, .Mesh = cooked_mesh_indices[mesh_id]};
+            sub_node.Name      = cooked_asset.AddString(mesh_name.C_Str() ? std::string(mesh_name.C_Str()) : fmt::format("{0}_Mesh_{1}", node_name, i));
+            cooked_asset.Nodes.push_back(sub_node);
+            cooked_asset.LocalTransforms.emplace_back(1.0f);
         }
 
-        if (!std::filesystem::exists(filename))
+        for (uint32_t i = 0; i < node->mNumChildren; ++i)
         {
-            return -1;
+            CookAssetNode(assimp_scene, node->mChildren[i], node_index, depth_level + 1, cooked_mesh_indices, cooked_asset);
         }
+    }
 
-        auto found = std::find(s_texture_file_collection.begin(), s_texture_file_collection.end(), std::string(filename));
-        if (found == std::end(s_texture_file_collection))
-        {
-            //s_raw_data->TextureCollection->Add(Textures::Texture2D::Read(filename));
+    static void CookAssimpScene(const aiScene* assimp_scene, std::string_view material_texture_parent_path, Meshes::VertexFormat vertex_format, CookedAssetData& cooked_asset)
+    {
+        const uint32_t node_count = CountAssetSceneNodes(assimp_scene->mRootNode);
+        cooked_asset.Nodes.reserve(node_count);
+        cooked_asset.LocalTransforms.reserve(node_count);
 
-            s_texture_file_collection.emplace_back(filename.data());
-            return (s_texture_file_collection.size() - 1);
-        }
+        auto cooked_material_indices = CookAssetMaterials(assimp_scene, material_texture_parent_path, cooked_asset);
+        auto cooked_mesh_indices     = CookAssetMeshes(assimp_scene, cooked_material_indices, vertex_format, cooked_asset);
+        CookAssetNode(assimp_scene, assimp_scene->mRootNode, -1, SCENE_ROOT_DEPTH_LEVEL, cooked_mesh_indices, cooked_asset);
+    }
 
-        return std::distance(std::begin(s_texture_file_collection), found);
+    /*
+     * Cooked assets are cached per source path and vertex format, the cache entry is only used when its key matches the current source content
+     */
+    static std::string GetCookedAssetFilename(const std::filesystem::path& asset_path, Meshes::VertexFormat vertex_format)
+    {
+        std::error_code error;
+        const auto      cache_directory = std::filesystem::current_path() / "__imported" / "cache";
+        std::filesystem::create_directories(cache_directory, error);
+
+        const auto absolute_path = std::filesystem::absolute(asset_path, error).string();
+        const auto format_suffix = (vertex_format == Meshes::VertexFormat::QUANTIZED) ? "_quantized" : "";
+        return (cache_directory / fmt::format("{0}_{1:016x}{2}.zasset", asset_path.filename().string(), (uint64_t) std::hash<std::string>{}(absolute_path), format_suffix))
+            .string();
     }
 
-    void GraphicScene::PostProcessMaterials()
+    /*
+     * Block copy spread over the thread pool, page faults of a mapped source are then served in parallel
+     */
+    static void ParallelCopy(void* destination, const void* source, size_t byte_size)
     {
-        std::unique_lock lock(s_scene_node_mutex);
+        const size_t block_size  = (size_t) COOKED_ASSET_COPY_BLOCK_SIZE;
+        const size_t block_count = (byte_size + block_size - 1) / block_size;
+        Helpers::ThreadPoolHelper::ParallelFor((uint32_t) block_count, [&](uint32_t begin, uint32_t end) {
+            const size_t offset = (size_t) begin * block_size;
+            std::memcpy(static_cast<uint8_t*>(destination) + offset, static_cast<const uint8_t*>(source) + offset, std::min((size_t) end * block_size, byte_size) - offset);
+        });
+    }
 
-        /*
-        * Ensuring output directory exist
-        */
-        const auto current_directoy = std::filesystem::current_path();
-        auto output_texture_dir = fmt::format("{0}\\{1}", current_directoy.string(), "__imported/out_textures/");
+    /*
+     * Downscales the texture file (combined with its opacity file when there is one) and writes it as a PNG in `output_directory`.
+     * Returns the written file, a missing texture is written as a black one
+     */
+    static std::string DownscaleTextureFile(const std::string& file, const std::string& opacity_file, std::string_view output_directory)
+    {
+        const int            max_width   = 512;
+        const int            max_height  = 512;
+        const uint32_t       max_channel = 4;
+        std::vector<uint8_t> temp_buffer(max_width * max_height * max_channel);
 
-        std::map<std::string_view, uint32_t> opacity_map_indices = {};
-        auto& material_map = s_raw_data->SceneNodeMaterialMap;
-        for (auto& material : material_map)
-        {
-            auto& material_data = material.second;
-            if ((material_data.OpacityTextureMap != INVALID_TEXTURE_MAP) && (material_data.AlbedoTextureMap != INVALID_TEXTURE_MAP))
-            {
-                opacity_map_indices[s_texture_file_collection[material_data.AlbedoTextureMap]] = material_data.OpacityTextureMap;
-            }
-        }
+        uint8_t* downscaled_texture_pixel = nullptr;
 
-        for (auto& file : s_texture_file_collection)
-        {
-            /*
-             * Downscaling textures
-             */
-            const int            max_width   = 512;
-            const int            max_height  = 512;
-            const uint32_t       max_channel = 4;
-            std::vector<uint8_t> temp_buffer(max_width * max_height * max_channel);
+        auto filename           = std::filesystem::path(file).filename();
+        auto downscaled_texture = fmt::format("{0}{1}__rescaled.png", output_directory, filename.string());
 
-            uint8_t* downscaled_texture_pixel = nullptr;
+        int      width, height, channel;
+        stbi_uc* file_pixel      = stbi_load(file.data(), &width, &height, &channel, STBI_rgb_alpha);
+        downscaled_texture_pixel = file_pixel;
+        channel                  = STBI_rgb_alpha; /*force channel to be RGBA*/
 
-            auto filename = std::filesystem::path(file).filename();
-            auto downscaled_texture = fmt::format("{0}{1}__rescaled.png", output_texture_dir, filename.string());
+        if (!downscaled_texture_pixel)
+        {
+            width                    = max_width;
+            height                   = max_height;
+            downscaled_texture_pixel = temp_buffer.data();
+        }
 
-            int      width, height, channel;
-            stbi_uc* file_pixel      = stbi_load(file.data(), &width, &height, &channel, STBI_rgb_alpha);
-            downscaled_texture_pixel = file_pixel;
-            channel                  = STBI_rgb_alpha; /*force channel to be RGBA*/
+        /*handling opacity combinaison with albedo*/
+        if (!opacity_file.empty())
+        {
+            int      opacity_width, opacity_height;
+            stbi_uc* opacity_pixel = stbi_load(opacity_file.data(), &opacity_width, &opacity_height, nullptr, 1);
 
-            if (!downscaled_texture_pixel)
+            if (!opacity_pixel)
             {
-                width                    = max_width;
-                height                   = max_height;
-                downscaled_texture_pixel = temp_buffer.data();
+                ZENGINE_CORE_ERROR("failed to load opacity file {0}", opacity_file)
             }
-
-            /*handling opacity combinaison with albedo*/
-            if (opacity_map_indices.contains(file))
+            else
             {
-                int      opacity_width, opacity_height;
-                auto     opacity_file  = s_texture_file_collection[opacity_map_indices[file]];
-                stbi_uc* opacity_pixel = stbi_load(opacity_file.data(), &opacity_width, &opacity_height, nullptr, 1);
-
-                if (!opacity_pixel)
-                {
-                    ZENGINE_CORE_ERROR("failed to load opacity file {0}", opacity_file)
-                    return;
-                }
-
-                ZENGINE_VALIDATE_ASSERT(opacity_pixel, "")
                 ZENGINE_VALIDATE_ASSERT(opacity_width == width, "")
                 ZENGINE_VALIDATE_ASSERT(opacity_height == height, "")
 
@@ -719,75 +598,2404 @@ namespace ZEngine::Rendering::Scenes
 
                 stbi_image_free(opacity_pixel);
             }
+        }
 
-            /*
-             * Writing out downscaled texture
+        /*
+         * Writing out downscaled texture
+         */
+        const uint32_t       output_size = width * height * channel;
+        std::vector<uint8_t> mip_buffer(output_size);
+        uint32_t             output_width  = std::min(width, max_width);
+        uint32_t             output_height = std::min(height, max_height);
+
+        stbir_resize_uint8(downscaled_texture_pixel, width, height, 0, mip_buffer.data(), output_width, output_height, 0, channel);
+        stbi_write_png(downscaled_texture.c_str(), output_width, output_height, channel, mip_buffer.data(), 0);
+
+        if (file_pixel)
+        {
+            stbi_image_free(file_pixel);
+        }
+        return downscaled_texture;
+    }
+
+    void Scene::Initialize()
+    {
+        m_raw_data->EntityRegistry = std::make_shared<entt::registry>();
+        /*
+         * Readers always get a snapshot, even before the first scene change
+         */
+        PublishSnapshot();
+        AcquireSnapshot();
+    }
+
+    void Scene::Deinitialize()
+    {
+        ReleaseSnapshots();
+        m_raw_data->TextureCollection->Dispose();
+    }
+
+    bool Scene::ReleaseSnapshots()
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        SceneSnapshot::DecrementRefCount(m_pending_snapshot.exchange(nullptr, std::memory_order_acq_rel));
+        m_front_snapshot     = nullptr;
+        m_published_snapshot = nullptr;
+        /*
+         * Published material snapshots reference the scene textures, and so does the renderer once it bound them : when the scene
+         * data is the last owner of every texture, no reader is left
+         */
+        const auto& texture_collection = m_raw_data->TextureCollection->Data();
+        return std::all_of(texture_collection.begin(), texture_collection.end(), [](const Ref<Textures::Texture>& texture) {
+            return texture->RefCount() == 1;
+        });
+    }
+
+    std::future<GraphicSceneEntity> Scene::CreateEntityAsync(std::string_view entity_name)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto scene_node_identifier = co_await AddNodeAsync(SCENE_ROOT_PARENT_ID, SCENE_ROOT_DEPTH_LEVEL);
+        __SetSceneNodeName(scene_node_identifier, entity_name);
+        co_return GraphicSceneEntity::CreateWrapper(m_raw_data->EntityRegistry, m_raw_data->SceneNodeEntityCollection[scene_node_identifier]);
+    }
+
+    std::future<GraphicSceneEntity> Scene::CreateEntityAsync(uuids::uuid uuid, std::string_view entity_name)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        auto             scene_entity = co_await CreateEntityAsync(entity_name);
+        __SetEntityUUID(scene_entity, uuid);
+        co_return scene_entity;
+    }
+
+    std::future<GraphicSceneEntity> Scene::CreateEntityAsync(std::string_view uuid_string, std::string_view entity_name)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        auto             scene_entity = co_await CreateEntityAsync(entity_name);
+        __SetEntityUUID(scene_entity, uuids::uuid::from_string(uuid_string).value());
+        co_return scene_entity;
+    }
+
+    std::future<Entities::GraphicSceneEntity> Scene::GetEntityAsync(std::string_view entity_name)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        entt::entity entity_handle{entt::null};
+        auto         found = m_raw_data->EntityNameIndex.find(entity_name);
+        if (found != m_raw_data->EntityNameIndex.end())
+        {
+            entity_handle = found->second.front();
+        }
+        else
+        {
+            ZENGINE_CORE_ERROR("An entity with name {0} deosn't exist", entity_name)
+        }
+
+        co_return GraphicSceneEntity::CreateWrapper(m_raw_data->EntityRegistry, entity_handle);
+    }
+
+    std::future<Entities::GraphicSceneEntity> Scene::GetEntityAsync(uuids::uuid uuid)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        entt::entity entity_handle{entt::null};
+        auto         found = m_raw_data->EntityUUIDIndex.find(uuid);
+        if (found != m_raw_data->EntityUUIDIndex.end())
+        {
+            entity_handle = found->second;
+        }
+        else
+        {
+            ZENGINE_CORE_ERROR("An entity with UUID {0} deosn't exist", uuids::to_string(uuid))
+        }
+
+        co_return GraphicSceneEntity::CreateWrapper(m_raw_data->EntityRegistry, entity_handle);
+    }
+
+    std::future<std::vector<Entities::GraphicSceneEntity>> Scene::GetEntitiesAsync(std::string_view entity_name)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        std::vector<GraphicSceneEntity> entities;
+        auto                            found = m_raw_data->EntityNameIndex.find(entity_name);
+        if (found != m_raw_data->EntityNameIndex.end())
+        {
+            entities.reserve(found->second.size());
+            for (auto entity : found->second)
+            {
+                entities.push_back(GraphicSceneEntity::CreateWrapper(m_raw_data->EntityRegistry, entity));
+            }
+        }
+        co_return entities;
+    }
+
+    std::future<bool> Scene::RenameEntityAsync(const Entities::GraphicSceneEntity& entity, std::string_view entity_name)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        if (!m_raw_data->EntityRegistry->valid(entity))
+        {
+            ZENGINE_CORE_ERROR("This entity is no longer valid")
+            co_return false;
+        }
+        /*
+         * Scene node entities also carry the name shown in the hierarchy
+         */
+        auto scene_node = m_raw_data->EntityNodeIndex.find((entt::entity) entity);
+        if (scene_node != m_raw_data->EntityNodeIndex.end())
+        {
+            __SetSceneNodeName(scene_node->second, entity_name);
+        }
+        else
+        {
+            __SetEntityName(entity, entity_name);
+        }
+        co_return true;
+    }
+
+    std::future<bool> Scene::RemoveEntityAsync(const Entities::GraphicSceneEntity& entity)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        if (!m_raw_data->EntityRegistry->valid(entity))
+        {
+            ZENGINE_CORE_ERROR("This entity is no longer valid")
+            co_return false;
+        }
+        /*
+         * A scene node entity is released with its node, which would otherwise keep referencing a destroyed entity
+         */
+        auto scene_node = m_raw_data->EntityNodeIndex.find((entt::entity) entity);
+        if (scene_node != m_raw_data->EntityNodeIndex.end())
+        {
+            co_return co_await RemoveNodeAsync(scene_node->second);
+        }
+        __RemoveEntityFromIndices(entity);
+        m_raw_data->EntityRegistry->destroy(entity);
+        co_return true;
+    }
+
+    void Scene::__SetSceneNodeName(int32_t node_identifier, std::string_view node_name)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        m_raw_data->SceneNodeNameCollection[node_identifier] = node_name;
+        m_raw_data->HierarchyRevision++;
+        __SetEntityName(m_raw_data->SceneNodeEntityCollection[node_identifier], node_name);
+    }
+
+    void Scene::__SetEntityName(entt::entity entity, std::string_view entity_name)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto& name_component = m_raw_data->EntityRegistry->get<NameComponent>(entity);
+        auto& name_index     = m_raw_data->EntityNameIndex;
+        if (!name_component.Name.empty())
+        {
+            /*
+             * Entities sharing a name are unordered, so the previous entry is swap-removed
+             */
+            auto found = name_index.find(name_component.Name);
+            if (found != name_index.end())
+            {
+                auto& entities = found->second;
+                auto  position = std::find(entities.begin(), entities.end(), entity);
+                if (position != entities.end())
+                {
+                    *position = entities.back();
+                    entities.pop_back();
+                }
+                if (entities.empty())
+                {
+                    name_index.erase(found);
+                }
+            }
+        }
+
+        name_component.Name = entity_name;
+        if (!entity_name.empty())
+        {
+            name_index[name_component.Name].push_back(entity);
+        }
+    }
+
+    void Scene::__SetEntityUUID(entt::entity entity, uuids::uuid uuid)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto& uuid_component = m_raw_data->EntityRegistry->get<UUIComponent>(entity);
+        m_raw_data->EntityUUIDIndex.erase(uuid_component.Identifier);
+        uuid_component.Identifier         = uuid;
+        m_raw_data->EntityUUIDIndex[uuid] = entity;
+    }
+
+    void Scene::__RemoveEntityFromIndices(entt::entity entity)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto& registry = *m_raw_data->EntityRegistry;
+        if (registry.all_of<NameComponent>(entity))
+        {
+            __SetEntityName(entity, {});
+        }
+        if (auto uuid_component = registry.try_get<UUIComponent>(entity))
+        {
+            auto found = m_raw_data->EntityUUIDIndex.find(uuid_component->Identifier);
+            if ((found != m_raw_data->EntityUUIDIndex.end()) && (found->second == entity))
+            {
+                m_raw_data->EntityUUIDIndex.erase(found);
+            }
+        }
+        m_raw_data->EntityNodeIndex.erase(entity);
+    }
+
+    std::shared_ptr<entt::registry> Scene::GetRegistry()
+    {
+        return m_raw_data->EntityRegistry;
+    }
+
+    std::future<int32_t> Scene::AddNodeAsync(int parent_node_id, int depth_level)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        co_return __AddNode(parent_node_id, depth_level);
+    }
+
+    std::future<int32_t> Scene::AddNodesAsync(int parent_node_id, int depth_level, uint32_t count)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        __ReserveSceneNodes(count);
+
+        /*
+         * Free slots are not reused here, so that the returned range stays contiguous
+         */
+        int32_t first_scene_node_identifier = (int32_t) m_raw_data->NodeHierarchyCollection.size();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            __AddNode(parent_node_id, depth_level, false);
+        }
+        co_return first_scene_node_identifier;
+    }
+
+    void Scene::__ReserveSceneNodes(uint32_t count)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        const size_t node_count = m_raw_data->NodeHierarchyCollection.size() + count;
+        m_raw_data->NodeHierarchyCollection.reserve(node_count);
+        m_raw_data->LocalTransformCollection.reserve(node_count);
+        m_raw_data->GlobalTransformCollection.reserve(node_count);
+        m_raw_data->SceneNodeNameCollection.reserve(node_count);
+        m_raw_data->SceneNodeMeshIndexCollection.reserve(node_count);
+        m_raw_data->SceneNodeEntityCollection.reserve(node_count);
+        m_raw_data->TransformDirtyTracker.DirtyBitset.reserve((node_count + 63) >> 6);
+    }
+
+    int32_t Scene::__AddNode(int parent_node_id, int depth_level, bool reuse_free_slot)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        int   scene_node_identifier = (int) m_raw_data->NodeHierarchyCollection.size();
+        auto& free_slot_collection  = m_raw_data->FreeSceneNodeCollection;
+        if (reuse_free_slot && !free_slot_collection.empty())
+        {
+            /*
+             * A released slot already holds identity transforms, an empty name and no mesh
+             */
+            scene_node_identifier = free_slot_collection.back();
+            free_slot_collection.pop_back();
+            m_raw_data->NodeHierarchyCollection[scene_node_identifier] = {.Parent = parent_node_id, .DepthLevel = depth_level};
+        }
+        else
+        {
+            m_raw_data->NodeHierarchyCollection.push_back({.Parent = parent_node_id, .DepthLevel = depth_level});
+            m_raw_data->LocalTransformCollection.emplace_back(1.0f);
+            m_raw_data->GlobalTransformCollection.emplace_back(1.0f);
+            m_raw_data->SceneNodeNameCollection.emplace_back();
+            m_raw_data->SceneNodeMeshIndexCollection.push_back(INVALID_SCENE_NODE_ID);
+            m_raw_data->SceneNodeEntityCollection.push_back(entt::null);
+        }
+        m_raw_data->HierarchyRevision++;
+        /*
+         * Appending to the parent children list is O(1) thanks to LastChild
+         */
+        if (parent_node_id > SCENE_ROOT_PARENT_ID)
+        {
+            auto& parent_hierarchy = m_raw_data->NodeHierarchyCollection[parent_node_id];
+            if (parent_hierarchy.FirstChild == INVALID_SCENE_NODE_ID)
+            {
+                parent_hierarchy.FirstChild = scene_node_identifier;
+            }
+            else
+            {
+                m_raw_data->NodeHierarchyCollection[parent_hierarchy.LastChild].RightSibling = scene_node_identifier;
+            }
+            parent_hierarchy.LastChild = scene_node_identifier;
+            parent_hierarchy.ChildCount++;
+        }
+        /*
+         * A new node changes the depth-sorted order and needs its global transform computed
+         */
+        auto& dirty_tracker                   = m_raw_data->TransformDirtyTracker;
+        dirty_tracker.IsDepthSortedOrderValid = false;
+        if (dirty_tracker.DirtyBitset.size() <= (scene_node_identifier >> 6))
+        {
+            dirty_tracker.DirtyBitset.resize((scene_node_identifier >> 6) + 1, 0);
+        }
+        SetSceneNodeDirty(dirty_tracker.DirtyBitset, scene_node_identifier);
+        /*
+         * Extra SceneEntity information for a SceneNode
+         */
+        m_raw_data->SceneNodeEntityCollection[scene_node_identifier] = m_raw_data->EntityRegistry->create();
+        auto entity_wrapper = GraphicSceneEntity::CreateWrapper(m_raw_data->EntityRegistry, m_raw_data->SceneNodeEntityCollection[scene_node_identifier]);
+        entity_wrapper.AddComponent<TransformComponent>(m_raw_data->LocalTransformCollection[scene_node_identifier]);
+        auto& uuid_component = entity_wrapper.AddComponent<UUIComponent>();
+        entity_wrapper.AddComponent<NameComponent>();
+        m_raw_data->EntityUUIDIndex[uuid_component.Identifier] = m_raw_data->SceneNodeEntityCollection[scene_node_identifier];
+        m_raw_data->EntityNodeIndex[m_raw_data->SceneNodeEntityCollection[scene_node_identifier]] = scene_node_identifier;
+
+        return scene_node_identifier;
+    }
+
+    std::future<bool> Scene::RemoveNodeAsync(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        if (!__IsSceneNodeAlive(node_identifier))
+        {
+            ZENGINE_CORE_ERROR("Scene node {0} doesn't exist", node_identifier)
+            co_return false;
+        }
+
+        auto& hierarchy_collection = m_raw_data->NodeHierarchyCollection;
+        /*
+         * Unlinking the node from its parent children list
+         */
+        int32_t parent_node_id = hierarchy_collection[node_identifier].Parent;
+        if (parent_node_id > SCENE_ROOT_PARENT_ID)
+        {
+            auto&   parent_hierarchy = hierarchy_collection[parent_node_id];
+            int32_t previous_sibling = INVALID_SCENE_NODE_ID;
+            for (int32_t child = parent_hierarchy.FirstChild; child != node_identifier; child = hierarchy_collection[child].RightSibling)
+            {
+                previous_sibling = child;
+            }
+
+            int32_t right_sibling = hierarchy_collection[node_identifier].RightSibling;
+            if (previous_sibling == INVALID_SCENE_NODE_ID)
+            {
+                parent_hierarchy.FirstChild = right_sibling;
+            }
+            else
+            {
+                hierarchy_collection[previous_sibling].RightSibling = right_sibling;
+            }
+
+            if (parent_hierarchy.LastChild == node_identifier)
+            {
+                parent_hierarchy.LastChild = previous_sibling;
+            }
+            parent_hierarchy.ChildCount--;
+        }
+        /*
+         * The whole subtree is collected before any slot gets released, since releasing resets the links
+         */
+        std::vector<int32_t> subtree_node_collection = {node_identifier};
+        for (uint32_t cursor = 0; cursor < subtree_node_collection.size(); ++cursor)
+        {
+            for (int32_t child = hierarchy_collection[subtree_node_collection[cursor]].FirstChild; child != INVALID_SCENE_NODE_ID;
+                 child         = hierarchy_collection[child].RightSibling)
+            {
+                subtree_node_collection.push_back(child);
+            }
+        }
+
+        for (int32_t node : subtree_node_collection)
+        {
+            __ReleaseSceneNode(node);
+        }
+
+        m_raw_data->TransformDirtyTracker.IsDepthSortedOrderValid = false;
+        m_raw_data->HierarchyRevision++;
+        co_return true;
+    }
+
+    bool Scene::__IsSceneNodeAlive(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        return (node_identifier > INVALID_SCENE_NODE_ID) && (node_identifier < m_raw_data->NodeHierarchyCollection.size()) &&
+               (m_raw_data->NodeHierarchyCollection[node_identifier].DepthLevel > INVALID_SCENE_NODE_ID);
+    }
+
+    void Scene::__ReleaseSceneNode(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto& entity = m_raw_data->SceneNodeEntityCollection[node_identifier];
+        if (m_raw_data->EntityRegistry->valid(entity))
+        {
+            __RemoveEntityFromIndices(entity);
+            m_raw_data->EntityRegistry->destroy(entity);
+        }
+        entity = entt::null;
+
+        int32_t mesh_index = m_raw_data->SceneNodeMeshIndexCollection[node_identifier];
+        if (mesh_index > INVALID_SCENE_NODE_ID)
+        {
+            __RemoveSceneNodeMesh(mesh_index);
+        }
+        /*
+         * A free slot is a default hierarchy entry, which DepthLevel (-1) keeps it out of every traversal
+         */
+        m_raw_data->NodeHierarchyCollection[node_identifier]      = {};
+        m_raw_data->LocalTransformCollection[node_identifier]     = glm::mat4(1.0f);
+        m_raw_data->GlobalTransformCollection[node_identifier]    = glm::mat4(1.0f);
+        m_raw_data->SceneNodeMeshIndexCollection[node_identifier] = INVALID_SCENE_NODE_ID;
+        m_raw_data->SceneNodeNameCollection[node_identifier].clear();
+        m_raw_data->TransformDirtyTracker.DirtyBitset[node_identifier >> 6] &= ~(1ull << (node_identifier & 63));
+        m_raw_data->FreeSceneNodeCollection.push_back(node_identifier);
+    }
+
+    void Scene::__RemoveSceneNodeMesh(uint32_t mesh_slot)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        /*
+         * Mesh slots stay packed by moving the last slot into the removed one.
+         * The geometry itself remains in Vertices/Indices until CompactScene() runs
+         */
+        auto&          raw_data       = *m_raw_data;
+        const uint32_t last_mesh_slot = raw_data.MeshNodeCollection.size() - 1;
+
+        raw_data.SceneNodeMeshIndexCollection[raw_data.MeshNodeCollection[mesh_slot]] = INVALID_SCENE_NODE_ID;
+        if (mesh_slot != last_mesh_slot)
+        {
+            raw_data.MeshNodeCollection[mesh_slot]              = raw_data.MeshNodeCollection[last_mesh_slot];
+            raw_data.MeshCollection[mesh_slot]                  = raw_data.MeshCollection[last_mesh_slot];
+            raw_data.MeshMaterialIndexCollection[mesh_slot]     = raw_data.MeshMaterialIndexCollection[last_mesh_slot];
+            raw_data.MeshWorldBoundCollection[mesh_slot]        = raw_data.MeshWorldBoundCollection[last_mesh_slot];
+            raw_data.MeshTriangleHierarchyCollection[mesh_slot] = std::move(raw_data.MeshTriangleHierarchyCollection[last_mesh_slot]);
+
+            raw_data.SceneNodeMeshIndexCollection[raw_data.MeshNodeCollection[mesh_slot]] = mesh_slot;
+        }
+
+        raw_data.MeshNodeCollection.pop_back();
+        raw_data.MeshCollection.pop_back();
+        raw_data.MeshMaterialIndexCollection.pop_back();
+        raw_data.MeshWorldBoundCollection.pop_back();
+        raw_data.MeshTriangleHierarchyCollection.pop_back();
+        raw_data.IsMeshBoundingVolumeHierarchyValid = false;
+        raw_data.GeometryRevision++;
+    }
+
+    int32_t Scene::GetSceneNodeParent(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        return (node_identifier < 0) ? INVALID_SCENE_NODE_ID : m_raw_data->NodeHierarchyCollection[node_identifier].Parent;
+    }
+
+    int32_t Scene::GetSceneNodeFirstChild(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        return (node_identifier < 0) ? INVALID_SCENE_NODE_ID : m_raw_data->NodeHierarchyCollection[node_identifier].FirstChild;
+    }
+
+    std::vector<int32_t> Scene::GetSceneNodeSiblingCollection(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        std::vector<int32_t> sibling_scene_nodes = {};
+        if (node_identifier < 0)
+        {
+            return sibling_scene_nodes;
+        }
+
+        for (auto sibling = m_raw_data->NodeHierarchyCollection[node_identifier].RightSibling; sibling != INVALID_SCENE_NODE_ID;
+             sibling      = m_raw_data->NodeHierarchyCollection[sibling].RightSibling)
+        {
+            sibling_scene_nodes.push_back(sibling);
+        }
+
+        return sibling_scene_nodes;
+    }
+
+    std::string_view Scene::GetSceneNodeName(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        return ((node_identifier > INVALID_SCENE_NODE_ID) && (node_identifier < m_raw_data->SceneNodeNameCollection.size())) ? m_raw_data->SceneNodeNameCollection[node_identifier]
+                                                                                                                           : std::string_view();
+    }
+
+    glm::mat4 Scene::GetSceneNodeLocalTransform(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        ZENGINE_VALIDATE_ASSERT((node_identifier > INVALID_SCENE_NODE_ID) && (node_identifier < m_raw_data->LocalTransformCollection.size()), "node identifier is invalid")
+        return m_raw_data->LocalTransformCollection[node_identifier];
+    }
+
+    glm::mat4 Scene::GetSceneNodeGlobalTransform(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        ZENGINE_VALIDATE_ASSERT(node_identifier > INVALID_SCENE_NODE_ID && node_identifier < m_raw_data->GlobalTransformCollection.size(), "node identifier is invalid")
+        return m_raw_data->GlobalTransformCollection[node_identifier];
+    }
+
+    SceneNodeHierarchy Scene::GetSceneNodeHierarchy(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        ZENGINE_VALIDATE_ASSERT(node_identifier > INVALID_SCENE_NODE_ID && node_identifier < m_raw_data->NodeHierarchyCollection.size(), "node identifier is invalid")
+        return m_raw_data->NodeHierarchyCollection[node_identifier];
+    }
+
+    GraphicSceneEntity Scene::GetSceneNodeEntityWrapper(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        ZENGINE_VALIDATE_ASSERT(node_identifier > INVALID_SCENE_NODE_ID && node_identifier < m_raw_data->SceneNodeEntityCollection.size(), "node identifier is invalid")
+        return GraphicSceneEntity::CreateWrapper(m_raw_data->EntityRegistry, m_raw_data->SceneNodeEntityCollection[node_identifier]);
+    }
+
+    void Scene::SetSceneNodeLocalTransform(int32_t node_identifier, const glm::mat4& transform)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        if (!__IsSceneNodeAlive(node_identifier))
+        {
+            return;
+        }
+
+        m_raw_data->LocalTransformCollection[node_identifier] = transform;
+        MarkSceneNodeAsChanged(node_identifier);
+    }
+
+    bool Scene::IsSceneNodeAlive(int32_t node_identifier)
+    {
+        return __IsSceneNodeAlive(node_identifier);
+    }
+
+    std::future<void> Scene::SetSceneNodeNameAsync(int32_t node_identifier, std::string_view node_name)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        ZENGINE_VALIDATE_ASSERT(node_identifier > INVALID_SCENE_NODE_ID && node_identifier < m_raw_data->SceneNodeNameCollection.size(), "node identifier is invalid")
+        __SetSceneNodeName(node_identifier, node_name);
+        co_return;
+    }
+
+    std::future<Meshes::MeshVNext> Scene::GetSceneNodeMeshAsync(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        ZENGINE_VALIDATE_ASSERT(node_identifier > INVALID_SCENE_NODE_ID && node_identifier < m_raw_data->SceneNodeMeshIndexCollection.size(), "node identifier is invalid")
+        int32_t mesh_index = m_raw_data->SceneNodeMeshIndexCollection[node_identifier];
+        ZENGINE_VALIDATE_ASSERT(mesh_index > INVALID_SCENE_NODE_ID, "node doesn't have mesh")
+        co_return m_raw_data->MeshCollection[mesh_index];
+    }
+
+    std::future<void> Scene::ImportAssetAsync(std::string_view asset_filename, Meshes::VertexFormat vertex_format)
+    {
+        /*
+         * The scene mutex isn't held here : this coroutine resumes on another thread once the import completes
+         */
+        if (!asset_filename.empty())
+        {
+            co_await __ReadAssetFileAsync(asset_filename, vertex_format, [this](bool success, const CookedAssetView& asset) -> std::future<void> {
+                if (success)
+                {
+                    ImportCookedAsset(asset);
+                }
+                co_return;
+            });
+        }
+        co_return;
+    }
+
+    void Scene::ImportCookedAsset(const CookedAssetView& asset)
+    {
+        __AddCookedAsset(asset);
+        /*
+         * Post-processing Material data
+         */
+        PostProcessMaterials();
+    }
+
+    void Scene::SetImportChunkNodeCount(uint32_t node_count)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        m_import_chunk_node_count = std::max(node_count, 1u);
+    }
+
+    Ref<SceneRawData> Scene::GetRawData()
+    {
+        std::lock_guard lock(m_scene_node_mutex);
+        return m_raw_data;
+    }
+
+    bool Scene::HasSceneNodes()
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        return m_raw_data->NodeHierarchyCollection.size() > m_raw_data->FreeSceneNodeCollection.size();
+    }
+
+    std::vector<int32_t> Scene::GetRootSceneNodes()
+    {
+        std::unique_lock     lock(m_scene_node_mutex);
+        std::vector<int32_t> root_scene_nodes;
+
+        if (!HasSceneNodes())
+        {
+            return root_scene_nodes;
+        }
+
+        for (uint32_t i = 0; i < m_raw_data->NodeHierarchyCollection.size(); ++i)
+        {
+            const auto& hierarchy = m_raw_data->NodeHierarchyCollection[i];
+            if ((hierarchy.Parent == SCENE_ROOT_PARENT_ID) && (hierarchy.DepthLevel > INVALID_SCENE_NODE_ID))
+            {
+                root_scene_nodes.push_back(i);
+            }
+        }
+        return root_scene_nodes;
+    }
+
+    void Scene::ComputeAllTransforms()
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto& dirty_tracker = m_raw_data->TransformDirtyTracker;
+        if (!dirty_tracker.IsDepthSortedOrderValid)
+        {
+            __RebuildDepthSortedOrder();
+        }
+
+        const auto& hierarchy_collection        = m_raw_data->NodeHierarchyCollection;
+        const auto& local_transform_collection  = m_raw_data->LocalTransformCollection;
+        auto&       global_transform_collection = m_raw_data->GlobalTransformCollection;
+        const auto& dirty_bitset                = dirty_tracker.DirtyBitset;
+
+        bool has_dirty_node = false;
+        for (auto& dirty_range : dirty_tracker.LevelDirtyRangeCollection)
+        {
+            if (dirty_range.Begin >= dirty_range.End)
+            {
+                continue;
+            }
+            /*
+             * Nodes of the same level only read transforms of previous levels, so the level range is split across the workers
+             * and ParallelFor acts as the barrier before the next level.
+             * Each worker compacts the dirty nodes of its sub range into the same positions of the scratch collections,
+             * so no allocation nor synchronization is needed
+             */
+            const uint32_t range_begin = dirty_range.Begin;
+            Helpers::ThreadPoolHelper::ParallelFor(
+                dirty_range.End - dirty_range.Begin,
+                [&](uint32_t begin, uint32_t end) {
+                    uint32_t* node_scratch   = dirty_tracker.NodeScratchCollection.data() + range_begin + begin;
+                    int32_t*  parent_scratch = dirty_tracker.ParentScratchCollection.data() + range_begin + begin;
+                    uint32_t  dirty_count    = 0;
+                    for (uint32_t position = range_begin + begin; position < (range_begin + end); ++position)
+                    {
+                        uint32_t node_identifier = dirty_tracker.DepthSortedNodeCollection[position];
+                        if (IsSceneNodeDirty(dirty_bitset, node_identifier))
+                        {
+                            node_scratch[dirty_count]   = node_identifier;
+                            parent_scratch[dirty_count] = hierarchy_collection[node_identifier].Parent;
+                            dirty_count++;
+                        }
+                    }
+                    Helpers::MultiplyHierarchyTransformBatch(
+                        parent_scratch, node_scratch, local_transform_collection.data(), global_transform_collection.data(), dirty_count);
+                },
+                m_transform_worker_count,
+                TRANSFORM_MIN_BATCH_SIZE);
+
+            dirty_range    = {};
+            has_dirty_node = true;
+        }
+
+        if (has_dirty_node)
+        {
+            __UpdateMeshWorldBounds();
+            std::fill(dirty_tracker.DirtyBitset.begin(), dirty_tracker.DirtyBitset.end(), 0);
+            m_raw_data->TransformRevision++;
+        }
+    }
+
+    void Scene::__UpdateMeshWorldBounds()
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto&       raw_data             = *m_raw_data;
+        auto&       dirty_mesh_slots     = raw_data.TransformDirtyTracker.MeshScratchCollection;
+        const auto& dirty_bitset         = raw_data.TransformDirtyTracker.DirtyBitset;
+        const auto& mesh_node_collection = raw_data.MeshNodeCollection;
+        /*
+         * Dirty bits are still set here : only mesh slots whose node moved get new world bounds
+         */
+        dirty_mesh_slots.clear();
+        for (uint32_t mesh_slot = 0; mesh_slot < mesh_node_collection.size(); ++mesh_slot)
+        {
+            if (IsSceneNodeDirty(dirty_bitset, mesh_node_collection[mesh_slot]))
+            {
+                dirty_mesh_slots.push_back(mesh_slot);
+            }
+        }
+
+        Helpers::ThreadPoolHelper::ParallelFor(
+            (uint32_t) dirty_mesh_slots.size(),
+            [&](uint32_t begin, uint32_t end) {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    uint32_t mesh_slot                           = dirty_mesh_slots[i];
+                    raw_data.MeshWorldBoundCollection[mesh_slot] = Helpers::TransformAABB(
+                        raw_data.MeshCollection[mesh_slot].LocalBounds, raw_data.GlobalTransformCollection[mesh_node_collection[mesh_slot]]);
+                }
+            },
+            m_transform_worker_count,
+            TRANSFORM_MIN_BATCH_SIZE);
+        /*
+         * A stale hierarchy is rebuilt by the next query instead. Refitting every node is cheaper than walking up from most leaves
+         */
+        if (!raw_data.IsMeshBoundingVolumeHierarchyValid || dirty_mesh_slots.empty())
+        {
+            return;
+        }
+
+        if ((dirty_mesh_slots.size() * 4) > mesh_node_collection.size())
+        {
+            raw_data.MeshBoundingVolumeHierarchy.Refit(raw_data.MeshWorldBoundCollection.data());
+        }
+        else
+        {
+            raw_data.MeshBoundingVolumeHierarchy.Refit(raw_data.MeshWorldBoundCollection.data(), dirty_mesh_slots.data(), (uint32_t) dirty_mesh_slots.size());
+        }
+    }
+
+    void Scene::__UpdateMeshBoundingVolumeHierarchy()
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto& raw_data = *m_raw_data;
+        if (raw_data.IsMeshBoundingVolumeHierarchyValid)
+        {
+            return;
+        }
+        raw_data.MeshBoundingVolumeHierarchy.Build(raw_data.MeshWorldBoundCollection.data(), (uint32_t) raw_data.MeshWorldBoundCollection.size());
+        raw_data.IsMeshBoundingVolumeHierarchyValid = true;
+    }
+
+    std::vector<int32_t> Scene::QuerySceneNodesInBounds(const Helpers::AABB& bounds)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        __UpdateMeshBoundingVolumeHierarchy();
+
+        std::vector<uint32_t> mesh_slots;
+        m_raw_data->MeshBoundingVolumeHierarchy.QueryOverlap(bounds, m_raw_data->MeshWorldBoundCollection.data(), mesh_slots);
+
+        std::vector<int32_t> scene_nodes;
+        scene_nodes.reserve(mesh_slots.size());
+        for (uint32_t mesh_slot : mesh_slots)
+        {
+            scene_nodes.push_back(m_raw_data->MeshNodeCollection[mesh_slot]);
+        }
+        return scene_nodes;
+    }
+
+    SceneRaycastHit Scene::RaycastSceneNodes(const Helpers::Ray& ray)
+    {
+        SceneRaycastHit hit = {};
+        RaycastSceneNodes(&ray, 1, &hit);
+        return hit;
+    }
+
+    void Scene::RaycastSceneNodes(const Helpers::Ray* rays, uint32_t ray_count, SceneRaycastHit* hits)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        __UpdateMeshBoundingVolumeHierarchy();
+        /*
+         * Workers only read the scene while the calling thread holds the lock. Triangle hierarchies are built on the calling thread :
+         * rays reaching a mesh without one flag it and are cast again once the flagged hierarchies are built
+         */
+        const auto& hierarchy_collection  = m_raw_data->MeshTriangleHierarchyCollection;
+        const auto  mesh_count            = (uint32_t) hierarchy_collection.size();
+        const bool  has_missing_hierarchy = std::any_of(hierarchy_collection.begin(), hierarchy_collection.end(), [](const auto& hierarchy) {
+            return !hierarchy;
+        });
+
+        std::vector<std::atomic<uint8_t>> missing_hierarchies(has_missing_hierarchy ? mesh_count : 0);
+        std::vector<uint8_t>              incomplete_rays(has_missing_hierarchy ? ray_count : 0);
+        Helpers::ThreadPoolHelper::ParallelFor(
+            ray_count,
+            [&](uint32_t begin, uint32_t end) {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    hits[i]           = {};
+                    const bool result = __RaycastMeshes(rays[i], hits[i], has_missing_hierarchy ? missing_hierarchies.data() : nullptr);
+                    if (has_missing_hierarchy)
+                    {
+                        incomplete_rays[i] = !result;
+                    }
+                }
+            },
+            m_spatial_query_worker_count,
+            SPATIAL_QUERY_MIN_BATCH_SIZE);
+
+        if (!has_missing_hierarchy)
+        {
+            return;
+        }
+
+        std::vector<uint32_t> pending_rays;
+        for (uint32_t mesh_slot = 0; mesh_slot < mesh_count; ++mesh_slot)
+        {
+            if (missing_hierarchies[mesh_slot].load(std::memory_order_relaxed))
+            {
+                __GetMeshTriangleHierarchy(mesh_slot);
+            }
+        }
+        for (uint32_t i = 0; i < ray_count; ++i)
+        {
+            if (incomplete_rays[i])
+            {
+                pending_rays.push_back(i);
+            }
+        }
+        /*
+         * A ray cast again visits a subset of the meshes it visited before, as its hit distance can only get closer, so every hierarchy it needs is built now
+         */
+        Helpers::ThreadPoolHelper::ParallelFor(
+            (uint32_t) pending_rays.size(),
+            [&](uint32_t begin, uint32_t end) {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    const uint32_t ray_index = pending_rays[i];
+                    hits[ray_index]          = {};
+                    __RaycastMeshes(rays[ray_index], hits[ray_index], nullptr);
+                }
+            },
+            m_spatial_query_worker_count,
+            SPATIAL_QUERY_MIN_BATCH_SIZE);
+    }
+
+    SceneOverlapQueryResult Scene::QuerySceneNodesInBounds(const Helpers::AABB* bounds, uint32_t bounds_count)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        __UpdateMeshBoundingVolumeHierarchy();
+        /*
+         * Each worker appends the scene nodes of its contiguous query range to its own collection, stored at the first query of the range.
+         * Ranges are then copied after each other, following the query offsets
+         */
+        const auto&                       raw_data = *m_raw_data;
+        SceneOverlapQueryResult           result   = {};
+        std::vector<std::vector<int32_t>> range_scene_nodes(bounds_count);
+        result.QueryOffsets.resize(bounds_count + 1, 0);
+        Helpers::ThreadPoolHelper::ParallelFor(
+            bounds_count,
+            [&](uint32_t begin, uint32_t end) {
+                std::vector<uint32_t> mesh_slots;
+                auto&                 scene_nodes = range_scene_nodes[begin];
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    mesh_slots.clear();
+                    raw_data.MeshBoundingVolumeHierarchy.QueryOverlap(bounds[i], raw_data.MeshWorldBoundCollection.data(), mesh_slots);
+                    for (uint32_t mesh_slot : mesh_slots)
+                    {
+                        scene_nodes.push_back(raw_data.MeshNodeCollection[mesh_slot]);
+                    }
+                    result.QueryOffsets[i + 1] = (uint32_t) mesh_slots.size();
+                }
+            },
+            m_spatial_query_worker_count,
+            SPATIAL_QUERY_MIN_BATCH_SIZE);
+
+        std::inclusive_scan(result.QueryOffsets.begin(), result.QueryOffsets.end(), result.QueryOffsets.begin());
+        result.SceneNodes.resize(result.QueryOffsets.back());
+        for (uint32_t i = 0; i < bounds_count; ++i)
+        {
+            const auto& scene_nodes = range_scene_nodes[i];
+            if (!scene_nodes.empty())
+            {
+                std::copy(scene_nodes.begin(), scene_nodes.end(), result.SceneNodes.begin() + result.QueryOffsets[i]);
+            }
+        }
+        return result;
+    }
+
+    void Scene::QueryNearestSceneNodes(const glm::vec3* points, uint32_t point_count, float max_distance, SceneNearestHit* hits)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        __UpdateMeshBoundingVolumeHierarchy();
+
+        const auto& raw_data = *m_raw_data;
+        Helpers::ThreadPoolHelper::ParallelFor(
+            point_count,
+            [&](uint32_t begin, uint32_t end) {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    uint32_t mesh_slot = 0;
+                    hits[i]            = {};
+                    if (raw_data.MeshBoundingVolumeHierarchy.QueryNearest(points[i], raw_data.MeshWorldBoundCollection.data(), max_distance, mesh_slot, hits[i].Distance))
+                    {
+                        hits[i].SceneNode = raw_data.MeshNodeCollection[mesh_slot];
+                    }
+                }
+            },
+            m_spatial_query_worker_count,
+            SPATIAL_QUERY_MIN_BATCH_SIZE);
+    }
+
+    void Scene::SetSpatialQueryWorkerCount(uint32_t worker_count)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        m_spatial_query_worker_count = std::max(worker_count, 1u);
+    }
+
+    bool Scene::__RaycastMeshes(const Helpers::Ray& ray, SceneRaycastHit& hit, std::atomic<uint8_t>* missing_hierarchies) const
+    {
+        const auto&     raw_data                   = *m_raw_data;
+        const auto&     primitive_index_collection = raw_data.MeshBoundingVolumeHierarchy.GetPrimitiveIndices();
+        const glm::vec3 inverse_direction          = 1.0f / ray.Direction;
+        bool            is_complete                = true;
+        Helpers::TraverseRay(raw_data.MeshBoundingVolumeHierarchy, ray, hit.Distance, [&](uint32_t first, uint32_t count) {
+            for (uint32_t i = first; i < (first + count); ++i)
+            {
+                const uint32_t mesh_slot       = primitive_index_collection[i];
+                float          bounds_distance = 0.0f;
+                if (!Helpers::IntersectRayAABB(ray, inverse_direction, raw_data.MeshWorldBoundCollection[mesh_slot], hit.Distance, bounds_distance))
+                {
+                    continue;
+                }
+
+                const auto& triangle_hierarchy = raw_data.MeshTriangleHierarchyCollection[mesh_slot];
+                if (!triangle_hierarchy)
+                {
+                    if (missing_hierarchies)
+                    {
+                        missing_hierarchies[mesh_slot].store(1, std::memory_order_relaxed);
+                    }
+                    is_complete = false;
+                    continue;
+                }
+                /*
+                 * The object space direction isn't normalized again, so that hit distances of different meshes stay comparable
+                 */
+                const int32_t      node_identifier   = raw_data.MeshNodeCollection[mesh_slot];
+                const glm::mat4    inverse_transform = glm::inverse(raw_data.GlobalTransformCollection[node_identifier]);
+                const Helpers::Ray object_ray        = {.Origin = glm::vec3(inverse_transform * glm::vec4(ray.Origin, 1.0f)), .Direction = glm::vec3(inverse_transform * glm::vec4(ray.Direction, 0.0f))};
+                Helpers::RayHit    mesh_hit          = {};
+                if (triangle_hierarchy->Raycast(object_ray, hit.Distance, mesh_hit))
+                {
+                    hit.SceneNode = node_identifier;
+                    hit.Triangle  = mesh_hit.Primitive;
+                    hit.Distance  = mesh_hit.Distance;
+                }
+            }
+        });
+        return is_complete;
+    }
+
+    const TriangleHierarchyRef& Scene::__GetMeshTriangleHierarchy(uint32_t mesh_slot)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto& raw_data           = *m_raw_data;
+        auto& triangle_hierarchy = raw_data.MeshTriangleHierarchyCollection[mesh_slot];
+        if (triangle_hierarchy)
+        {
+            return triangle_hierarchy;
+        }
+        /*
+         * Mesh slots sharing a geometry range (instances of the same imported mesh) share its hierarchy
+         */
+        const auto& mesh             = raw_data.MeshCollection[mesh_slot];
+        auto&       shared_hierarchy = raw_data.MeshTriangleHierarchyIndex[{mesh.VertexOffset, mesh.IndexOffset, mesh.IndexCount}];
+        if (shared_hierarchy)
+        {
+            triangle_hierarchy = shared_hierarchy;
+            return triangle_hierarchy;
+        }
+
+        triangle_hierarchy = CreateRef<Helpers::TriangleBoundingVolumeHierarchy>();
+        shared_hierarchy   = triangle_hierarchy;
+        std::vector<uint32_t> decoded_indices;
+        const uint32_t*       indices = raw_data.Indices.data() + mesh.IndexOffset;
+        if (mesh.IndexType != Meshes::IndexFormat::UINT32)
+        {
+            decoded_indices = Meshes::DecodeIndices(indices, mesh.IndexCount, mesh.IndexType);
+            indices         = decoded_indices.data();
+        }
+
+        if (mesh.Format == Meshes::VertexFormat::QUANTIZED)
+        {
+            const auto positions = Meshes::DecodeVertexPositions(raw_data.Vertices.data() + mesh.VertexOffset, mesh.VertexCount, mesh.Format, mesh.LocalBounds);
+            triangle_hierarchy->Build(positions.data(), 3, indices, mesh.IndexCount);
+        }
+        else
+        {
+            triangle_hierarchy->Build(raw_data.Vertices.data() + mesh.VertexOffset, Meshes::GetVertexFloatCount(mesh.Format), indices, mesh.IndexCount);
+        }
+        return triangle_hierarchy;
+    }
+
+    void Scene::SetTransformWorkerCount(uint32_t worker_count)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        m_transform_worker_count = std::max(worker_count, 1u);
+    }
+
+    void Scene::PublishSnapshot()
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        const auto& raw_data = *m_raw_data;
+        auto        snapshot = CreateRef<SceneSnapshot>();
+        /*
+         * Geometry, materials and hierarchy are only copied when their revision moved since the last publication
+         */
+        if (m_published_snapshot && (m_published_snapshot->Geometry->Revision == raw_data.GeometryRevision))
+        {
+            snapshot->Geometry = m_published_snapshot->Geometry;
+        }
+        else
+        {
+            auto geometry                         = CreateRef<SceneGeometrySnapshot>();
+            geometry->Revision                    = raw_data.GeometryRevision;
+            geometry->BufferRevision              = raw_data.GeometryBufferRevision;
+            geometry->VertexFloatCount            = (uint32_t) raw_data.Vertices.size();
+            geometry->IndexCount                  = (uint32_t) raw_data.Indices.size();
+            geometry->MeshCollection              = raw_data.MeshCollection;
+            geometry->MeshMaterialIndexCollection = raw_data.MeshMaterialIndexCollection;
+            geometry->MeshletCollection           = raw_data.Meshlets;
+            /*
+             * While the buffers only grew, the previous blocks still hold their ranges and only the tail is copied.
+             * Blocks are merged back into one once there are too many of them
+             */
+            const auto* previous_geometry = m_published_snapshot ? m_published_snapshot->Geometry.get() : nullptr;
+            uint32_t    first_vertex      = 0;
+            uint32_t    first_index       = 0;
+            if (previous_geometry && (previous_geometry->BufferRevision == geometry->BufferRevision) && (previous_geometry->VertexFloatCount <= geometry->VertexFloatCount) &&
+                (previous_geometry->IndexCount <= geometry->IndexCount) && (previous_geometry->BlockCollection.size() < SNAPSHOT_MAX_GEOMETRY_BLOCK_COUNT))
+            {
+                geometry->BlockCollection = previous_geometry->BlockCollection;
+                first_vertex              = previous_geometry->VertexFloatCount;
+                first_index               = previous_geometry->IndexCount;
+            }
+
+            if ((first_vertex < geometry->VertexFloatCount) || (first_index < geometry->IndexCount))
+            {
+                auto block          = CreateRef<SceneGeometryBlock>();
+                block->VertexOffset = first_vertex;
+                block->IndexOffset  = first_index;
+                block->Vertices.assign(raw_data.Vertices.begin() + first_vertex, raw_data.Vertices.end());
+                block->Indices.assign(raw_data.Indices.begin() + first_index, raw_data.Indices.end());
+                geometry->BlockCollection.push_back(block);
+            }
+            snapshot->Geometry = geometry;
+        }
+        /*
+         * Materials are published again once more textures got loaded, see SceneMaterialSnapshot
+         */
+        const auto texture_count = (uint32_t) raw_data.TextureCollection->Size();
+        if (m_published_snapshot && (m_published_snapshot->Materials->Revision == raw_data.MaterialRevision) && (m_published_snapshot->Materials->TextureCount == texture_count))
+        {
+            snapshot->Materials = m_published_snapshot->Materials;
+        }
+        else
+        {
+            auto materials                = CreateRef<SceneMaterialSnapshot>();
+            materials->Revision           = raw_data.MaterialRevision;
+            materials->TextureCount       = texture_count;
+            materials->MaterialCollection = raw_data.MaterialCollection;
+            materials->TextureCollection  = CreateRef<Textures::TextureArray>();
+            materials->TextureCollection->Data().assign(raw_data.TextureCollection->Data().begin(), raw_data.TextureCollection->Data().begin() + texture_count);
+            for (auto& material : materials->MaterialCollection)
+            {
+                for (uint32_t* texture_map : {&material.EmissiveTextureMap, &material.AlbedoTextureMap, &material.NormalTextureMap, &material.OpacityTextureMap})
+                {
+                    *texture_map = (*texture_map < texture_count) ? *texture_map : INVALID_TEXTURE_MAP;
+                }
+            }
+            snapshot->Materials = materials;
+        }
+
+        if (m_published_snapshot && (m_published_snapshot->Hierarchy->Revision == raw_data.HierarchyRevision))
+        {
+            snapshot->Hierarchy = m_published_snapshot->Hierarchy;
+        }
+        else
+        {
+            auto hierarchy                     = CreateRef<SceneHierarchySnapshot>();
+            hierarchy->Revision                = raw_data.HierarchyRevision;
+            hierarchy->NodeHierarchyCollection = raw_data.NodeHierarchyCollection;
+            hierarchy->SceneNodeNameCollection = raw_data.SceneNodeNameCollection;
+            hierarchy->RootSceneNodeCollection = GetRootSceneNodes();
+            snapshot->Hierarchy                = hierarchy;
+        }
+
+        snapshot->MeshTransformCollection.resize(raw_data.MeshNodeCollection.size());
+        for (uint32_t i = 0; i < raw_data.MeshNodeCollection.size(); ++i)
+        {
+            snapshot->MeshTransformCollection[i] = raw_data.GlobalTransformCollection[raw_data.MeshNodeCollection[i]];
+        }
+        snapshot->MeshWorldBoundCollection = raw_data.MeshWorldBoundCollection;
+        snapshot->TransformRevision        = raw_data.TransformRevision;
+
+        m_published_snapshot = snapshot;
+        /*
+         * The pending slot owns one reference. A snapshot that was never acquired gets replaced and released here
+         */
+        SceneSnapshot* unconsumed_snapshot = m_pending_snapshot.exchange(snapshot.detach(), std::memory_order_acq_rel);
+        SceneSnapshot::DecrementRefCount(unconsumed_snapshot);
+    }
+
+    bool Scene::TryPublishSnapshot()
+    {
+        std::unique_lock lock(m_scene_node_mutex, std::try_to_lock);
+        if (!lock.owns_lock())
+        {
+            /*
+             * A writer (e.g the asset importer) owns the scene, readers keep the last published snapshot instead of stalling the frame
+             */
+            return false;
+        }
+
+        ComputeAllTransforms();
+
+        const auto& raw_data = *m_raw_data;
+        bool        has_changed =
+            !m_published_snapshot || (m_published_snapshot->Geometry->Revision != raw_data.GeometryRevision) ||
+            (m_published_snapshot->Materials->Revision != raw_data.MaterialRevision) || (m_published_snapshot->Hierarchy->Revision != raw_data.HierarchyRevision) ||
+            (m_published_snapshot->TransformRevision != raw_data.TransformRevision) || (m_published_snapshot->Materials->TextureCount != raw_data.TextureCollection->Size());
+        if (has_changed)
+        {
+            PublishSnapshot();
+        }
+        return true;
+    }
+
+    Ref<SceneSnapshot> Scene::AcquireSnapshot()
+    {
+        if (SceneSnapshot* next_snapshot = m_pending_snapshot.exchange(nullptr, std::memory_order_acq_rel))
+        {
+            /*
+             * Adopting the reference owned by the pending slot
+             */
+            m_front_snapshot.attach(next_snapshot);
+        }
+        return m_front_snapshot;
+    }
+
+    Ref<SceneSnapshot> Scene::GetSnapshot()
+    {
+        return m_front_snapshot;
+    }
+
+    void Scene::MarkSceneNodeAsChanged(int32_t node_identifier)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        if (!__IsSceneNodeAlive(node_identifier))
+        {
+            return;
+        }
+
+        auto&       dirty_tracker        = m_raw_data->TransformDirtyTracker;
+        const auto& hierarchy_collection = m_raw_data->NodeHierarchyCollection;
+
+        auto mark_as_dirty = [&dirty_tracker, &hierarchy_collection](uint32_t node) {
+            SetSceneNodeDirty(dirty_tracker.DirtyBitset, node);
+            /*
+             * Without a valid order, ranges are recomputed from the bitset when the order gets rebuilt
+             */
+            if (dirty_tracker.IsDepthSortedOrderValid)
+            {
+                uint32_t position    = dirty_tracker.SortedPositionCollection[node];
+                auto&    dirty_range = dirty_tracker.LevelDirtyRangeCollection[hierarchy_collection[node].DepthLevel];
+                dirty_range.Begin    = std::min(dirty_range.Begin, position);
+                dirty_range.End      = std::max(dirty_range.End, position + 1);
+            }
+        };
+        /*
+         * A dirty node always has a dirty subtree, so already dirty nodes are not walked again.
+         * The subtree is walked in pre-order through the FirstChild/RightSibling/Parent links, without any stack
+         */
+        if (IsSceneNodeDirty(dirty_tracker.DirtyBitset, node_identifier))
+        {
+            return;
+        }
+        mark_as_dirty(node_identifier);
+
+        int32_t current = hierarchy_collection[node_identifier].FirstChild;
+        while (current != INVALID_SCENE_NODE_ID)
+        {
+            bool visit_children = !IsSceneNodeDirty(dirty_tracker.DirtyBitset, current);
+            if (visit_children)
+            {
+                mark_as_dirty(current);
+            }
+
+            if (visit_children && (hierarchy_collection[current].FirstChild != INVALID_SCENE_NODE_ID))
+            {
+                current = hierarchy_collection[current].FirstChild;
+                continue;
+            }
+
+            while ((current != node_identifier) && (hierarchy_collection[current].RightSibling == INVALID_SCENE_NODE_ID))
+            {
+                current = hierarchy_collection[current].Parent;
+            }
+            current = (current == node_identifier) ? INVALID_SCENE_NODE_ID : hierarchy_collection[current].RightSibling;
+        }
+    }
+
+    void Scene::__RebuildDepthSortedOrder()
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto&          dirty_tracker        = m_raw_data->TransformDirtyTracker;
+        const auto&    hierarchy_collection = m_raw_data->NodeHierarchyCollection;
+        const uint32_t node_count           = hierarchy_collection.size();
+        /*
+         * Counting sort of the nodes by depth level, free slots (DepthLevel == -1) are left out
+         */
+        uint32_t level_count = 0;
+        for (const auto& hierarchy : hierarchy_collection)
+        {
+            level_count = std::max(level_count, static_cast<uint32_t>(hierarchy.DepthLevel + 1));
+        }
+
+        dirty_tracker.LevelOffsetCollection.assign(level_count + 1, 0);
+        for (const auto& hierarchy : hierarchy_collection)
+        {
+            if (hierarchy.DepthLevel > INVALID_SCENE_NODE_ID)
+            {
+                dirty_tracker.LevelOffsetCollection[hierarchy.DepthLevel + 1]++;
+            }
+        }
+        for (uint32_t level = 0; level < level_count; ++level)
+        {
+            dirty_tracker.LevelOffsetCollection[level + 1] += dirty_tracker.LevelOffsetCollection[level];
+        }
+
+        std::vector<uint32_t> level_cursor(dirty_tracker.LevelOffsetCollection.begin(), dirty_tracker.LevelOffsetCollection.end() - 1);
+        dirty_tracker.DepthSortedNodeCollection.resize(dirty_tracker.LevelOffsetCollection.back());
+        dirty_tracker.SortedPositionCollection.resize(node_count);
+        for (uint32_t node = 0; node < node_count; ++node)
+        {
+            if (hierarchy_collection[node].DepthLevel <= INVALID_SCENE_NODE_ID)
+            {
+                continue;
+            }
+            uint32_t position                                 = level_cursor[hierarchy_collection[node].DepthLevel]++;
+            dirty_tracker.DepthSortedNodeCollection[position] = node;
+            dirty_tracker.SortedPositionCollection[node]      = position;
+        }
+
+        dirty_tracker.NodeScratchCollection.resize(node_count);
+        dirty_tracker.ParentScratchCollection.resize(node_count);
+        dirty_tracker.DirtyBitset.resize((node_count + 63) >> 6, 0);
+        /*
+         * Dirty ranges are recovered from the bitset, which is the only state kept while the order is invalid
+         */
+        dirty_tracker.LevelDirtyRangeCollection.assign(level_count, SceneNodeDirtyRange{});
+        for (uint32_t level = 0; level < level_count; ++level)
+        {
+            auto& dirty_range = dirty_tracker.LevelDirtyRangeCollection[level];
+            for (uint32_t position = dirty_tracker.LevelOffsetCollection[level]; position < dirty_tracker.LevelOffsetCollection[level + 1]; ++position)
+            {
+                if (IsSceneNodeDirty(dirty_tracker.DirtyBitset, dirty_tracker.DepthSortedNodeCollection[position]))
+                {
+                    dirty_range.Begin = std::min(dirty_range.Begin, position);
+                    dirty_range.End   = position + 1;
+                }
+            }
+        }
+
+        dirty_tracker.IsDepthSortedOrderValid = true;
+    }
+
+    std::vector<int32_t> Scene::ReorderSceneNodesBreadthFirst()
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        const auto&          hierarchy_collection = m_raw_data->NodeHierarchyCollection;
+        std::vector<int32_t> breadth_first_order  = {};
+        breadth_first_order.reserve(hierarchy_collection.size());
+
+        for (int32_t node = 0; node < hierarchy_collection.size(); ++node)
+        {
+            if ((hierarchy_collection[node].Parent == SCENE_ROOT_PARENT_ID) && (hierarchy_collection[node].DepthLevel > INVALID_SCENE_NODE_ID))
+            {
+                breadth_first_order.push_back(node);
+            }
+        }
+        /*
+         * The order collection is its own queue
+         */
+        for (uint32_t cursor = 0; cursor < breadth_first_order.size(); ++cursor)
+        {
+            for (int32_t child = hierarchy_collection[breadth_first_order[cursor]].FirstChild; child != INVALID_SCENE_NODE_ID;
+                 child         = hierarchy_collection[child].RightSibling)
+            {
+                breadth_first_order.push_back(child);
+            }
+        }
+
+        std::vector<int32_t> node_remap(hierarchy_collection.size(), INVALID_SCENE_NODE_ID);
+        for (int32_t position = 0; position < breadth_first_order.size(); ++position)
+        {
+            node_remap[breadth_first_order[position]] = position;
+        }
+
+        __RemapSceneNodes(node_remap);
+        return node_remap;
+    }
+
+    void Scene::__ReorderSceneNodesBreadthFirst(const std::vector<int32_t>& node_collection)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        const auto&          hierarchy_collection = m_raw_data->NodeHierarchyCollection;
+        std::vector<uint8_t> is_reordered(hierarchy_collection.size(), 0);
+        std::vector<int32_t> slot_collection = {};
+        slot_collection.reserve(node_collection.size());
+        for (int32_t node : node_collection)
+        {
+            if (__IsSceneNodeAlive(node) && !is_reordered[node])
+            {
+                is_reordered[node] = 1;
+                slot_collection.push_back(node);
+            }
+        }
+        /*
+         * The walk starts from the nodes whose parent is outside of the collection and only follows children within it,
+         * so nodes added meanwhile under the collection keep their identifiers
+         */
+        std::vector<int32_t> breadth_first_order = {};
+        breadth_first_order.reserve(slot_collection.size());
+        for (int32_t node : slot_collection)
+        {
+            const int32_t parent = hierarchy_collection[node].Parent;
+            if ((parent == SCENE_ROOT_PARENT_ID) || !is_reordered[parent])
+            {
+                breadth_first_order.push_back(node);
+            }
+        }
+
+        for (uint32_t cursor = 0; cursor < breadth_first_order.size(); ++cursor)
+        {
+            for (int32_t child = hierarchy_collection[breadth_first_order[cursor]].FirstChild; child != INVALID_SCENE_NODE_ID;
+                 child         = hierarchy_collection[child].RightSibling)
+            {
+                if (is_reordered[child])
+                {
+                    breadth_first_order.push_back(child);
+                }
+            }
+        }
+        /*
+         * The collection nodes are dealt their own slots again in breadth-first order, every other node maps to itself
+         */
+        std::sort(slot_collection.begin(), slot_collection.end());
+
+        std::vector<int32_t> node_remap(hierarchy_collection.size());
+        std::iota(node_remap.begin(), node_remap.end(), 0);
+        for (uint32_t position = 0; position < breadth_first_order.size(); ++position)
+        {
+            node_remap[breadth_first_order[position]] = slot_collection[position];
+        }
+
+        __RemapSceneNodes(node_remap);
+    }
+
+    void Scene::__RemapSceneNodes(const std::vector<int32_t>& node_remap)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto&          raw_data       = *m_raw_data;
+        const uint32_t old_node_count = raw_data.NodeHierarchyCollection.size();
+        const uint32_t new_node_count = std::count_if(node_remap.begin(), node_remap.end(), [](int32_t node) {
+            return node != INVALID_SCENE_NODE_ID;
+        });
+
+        auto remap_node = [&node_remap](int32_t node) {
+            return (node == INVALID_SCENE_NODE_ID) ? INVALID_SCENE_NODE_ID : node_remap[node];
+        };
+
+        std::vector<SceneNodeHierarchy> hierarchy_collection(new_node_count);
+        std::vector<glm::mat4>          local_transform_collection(new_node_count);
+        std::vector<glm::mat4>          global_transform_collection(new_node_count);
+        std::vector<entt::entity>       entity_collection(new_node_count);
+        std::vector<std::string>        name_collection(new_node_count);
+        std::vector<int32_t>            mesh_index_collection(new_node_count);
+        std::vector<uint64_t>           dirty_bitset((new_node_count + 63) >> 6, 0);
+
+        for (uint32_t old_node = 0; old_node < old_node_count; ++old_node)
+        {
+            int32_t new_node = node_remap[old_node];
+            if (new_node == INVALID_SCENE_NODE_ID)
+            {
+                continue;
+            }
+
+            SceneNodeHierarchy hierarchy = raw_data.NodeHierarchyCollection[old_node];
+            hierarchy.Parent             = remap_node(hierarchy.Parent);
+            hierarchy.FirstChild         = remap_node(hierarchy.FirstChild);
+            hierarchy.LastChild          = remap_node(hierarchy.LastChild);
+            hierarchy.RightSibling       = remap_node(hierarchy.RightSibling);
+
+            hierarchy_collection[new_node]        = hierarchy;
+            local_transform_collection[new_node]  = raw_data.LocalTransformCollection[old_node];
+            global_transform_collection[new_node] = raw_data.GlobalTransformCollection[old_node];
+            entity_collection[new_node]           = raw_data.SceneNodeEntityCollection[old_node];
+            name_collection[new_node]             = std::move(raw_data.SceneNodeNameCollection[old_node]);
+            mesh_index_collection[new_node]       = raw_data.SceneNodeMeshIndexCollection[old_node];
+
+            if ((new_node != old_node) && (entity_collection[new_node] != entt::null))
+            {
+                raw_data.EntityNodeIndex[entity_collection[new_node]] = new_node;
+            }
+
+            if (IsSceneNodeDirty(raw_data.TransformDirtyTracker.DirtyBitset, old_node))
+            {
+                SetSceneNodeDirty(dirty_bitset, new_node);
+            }
+        }
+
+        for (auto& mesh_node : raw_data.MeshNodeCollection)
+        {
+            mesh_node = remap_node(mesh_node);
+        }
+
+        for (auto* streamed_node_identifiers : m_streamed_node_identifier_collection)
+        {
+            for (auto& node : *streamed_node_identifiers)
+            {
+                node = remap_node(node);
+            }
+        }
+
+        raw_data.NodeHierarchyCollection.swap(hierarchy_collection);
+        raw_data.LocalTransformCollection.swap(local_transform_collection);
+        raw_data.GlobalTransformCollection.swap(global_transform_collection);
+        raw_data.SceneNodeEntityCollection.swap(entity_collection);
+        raw_data.SceneNodeNameCollection.swap(name_collection);
+        raw_data.SceneNodeMeshIndexCollection.swap(mesh_index_collection);
+        raw_data.TransformDirtyTracker.DirtyBitset.swap(dirty_bitset);
+        raw_data.TransformDirtyTracker.IsDepthSortedOrderValid = false;
+        raw_data.HierarchyRevision++;
+        /*
+         * Free slots the remap drops are forgotten, the other ones follow their node
+         */
+        auto& free_slot_collection = raw_data.FreeSceneNodeCollection;
+        for (auto& free_slot : free_slot_collection)
+        {
+            free_slot = remap_node(free_slot);
+        }
+        std::erase(free_slot_collection, INVALID_SCENE_NODE_ID);
+    }
+
+    std::vector<int32_t> Scene::CompactScene()
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        std::vector<int32_t> node_remap = ReorderSceneNodesBreadthFirst();
+        __CompactSceneGeometry();
+        __CompactMaterials();
+
+        auto& raw_data = *m_raw_data;
+        raw_data.NodeHierarchyCollection.shrink_to_fit();
+        raw_data.LocalTransformCollection.shrink_to_fit();
+        raw_data.GlobalTransformCollection.shrink_to_fit();
+        raw_data.SceneNodeEntityCollection.shrink_to_fit();
+        raw_data.SceneNodeNameCollection.shrink_to_fit();
+        raw_data.SceneNodeMeshIndexCollection.shrink_to_fit();
+        raw_data.FreeSceneNodeCollection.shrink_to_fit();
+        raw_data.MeshNodeCollection.shrink_to_fit();
+        raw_data.MeshCollection.shrink_to_fit();
+        raw_data.MeshMaterialIndexCollection.shrink_to_fit();
+        raw_data.MeshWorldBoundCollection.shrink_to_fit();
+        raw_data.MeshTriangleHierarchyCollection.shrink_to_fit();
+        return node_remap;
+    }
+
+    void Scene::__CompactSceneGeometry()
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto& raw_data = *m_raw_data;
+        /*
+         * Ranges are packed in their current order, so that each copy moves data towards the front.
+         * Meshes sharing a range keep sharing it. Vertex offsets are in floats, whatever the mesh vertex format
+         */
+        std::vector<uint32_t> mesh_order(raw_data.MeshCollection.size());
+        std::iota(mesh_order.begin(), mesh_order.end(), 0);
+        std::sort(mesh_order.begin(), mesh_order.end(), [&raw_data](uint32_t lhs, uint32_t rhs) {
+            return raw_data.MeshCollection[lhs].VertexOffset < raw_data.MeshCollection[rhs].VertexOffset;
+        });
+
+        std::unordered_map<uint32_t, uint32_t> vertex_offset_remap = {};
+        uint32_t                               vertex_offset       = 0;
+        for (uint32_t mesh_slot : mesh_order)
+        {
+            auto& mesh              = raw_data.MeshCollection[mesh_slot];
+            auto [it, is_new_range] = vertex_offset_remap.try_emplace(mesh.VertexOffset, vertex_offset);
+            if (is_new_range)
+            {
+                const uint32_t range_float_count = mesh.VertexCount * Meshes::GetVertexFloatCount(mesh.Format);
+                auto           source            = raw_data.Vertices.begin() + mesh.VertexOffset;
+                std::copy(source, source + range_float_count, raw_data.Vertices.begin() + vertex_offset);
+                vertex_offset += range_float_count;
+            }
+            mesh.VertexOffset = it->second;
+            mesh.StreamOffset = mesh.VertexOffset * sizeof(float);
+        }
+
+        std::sort(mesh_order.begin(), mesh_order.end(), [&raw_data](uint32_t lhs, uint32_t rhs) {
+            return raw_data.MeshCollection[lhs].IndexOffset < raw_data.MeshCollection[rhs].IndexOffset;
+        });
+
+        std::unordered_map<uint32_t, uint32_t> index_offset_remap = {};
+        uint32_t                               index_offset       = 0;
+        for (uint32_t mesh_slot : mesh_order)
+        {
+            auto& mesh              = raw_data.MeshCollection[mesh_slot];
+            auto [it, is_new_range] = index_offset_remap.try_emplace(mesh.IndexOffset, index_offset);
+            if (is_new_range)
+            {
+                const uint32_t range_word_count = Meshes::GetIndexWordCount(Meshes::GetMeshIndexRangeCount(mesh.IndexCount, mesh.Lods), mesh.IndexType);
+                auto           source           = raw_data.Indices.begin() + mesh.IndexOffset;
+                std::copy(source, source + range_word_count, raw_data.Indices.begin() + index_offset);
+                index_offset += range_word_count;
+            }
+            mesh.IndexOffset       = it->second;
+            mesh.IndexStreamOffset = mesh.IndexOffset * sizeof(uint32_t);
+        }
+
+        std::sort(mesh_order.begin(), mesh_order.end(), [&raw_data](uint32_t lhs, uint32_t rhs) {
+            return raw_data.MeshCollection[lhs].MeshletOffset < raw_data.MeshCollection[rhs].MeshletOffset;
+        });
+
+        std::unordered_map<uint32_t, uint32_t> meshlet_offset_remap = {};
+        uint32_t                               meshlet_offset       = 0;
+        for (uint32_t mesh_slot : mesh_order)
+        {
+            auto& mesh = raw_data.MeshCollection[mesh_slot];
+            if (mesh.MeshletCount == 0)
+            {
+                continue;
+            }
+
+            auto [it, is_new_range] = meshlet_offset_remap.try_emplace(mesh.MeshletOffset, meshlet_offset);
+            if (is_new_range)
+            {
+                auto source = raw_data.Meshlets.begin() + mesh.MeshletOffset;
+                std::copy(source, source + mesh.MeshletCount, raw_data.Meshlets.begin() + meshlet_offset);
+                meshlet_offset += mesh.MeshletCount;
+            }
+            mesh.MeshletOffset = it->second;
+        }
+
+        raw_data.Vertices.resize(vertex_offset);
+        raw_data.Indices.resize(index_offset);
+        raw_data.Meshlets.resize(meshlet_offset);
+        raw_data.Vertices.shrink_to_fit();
+        raw_data.Indices.shrink_to_fit();
+        raw_data.Meshlets.shrink_to_fit();
+        raw_data.SVertexOffset = vertex_offset;
+        raw_data.SIndexOffset  = index_offset;
+        /*
+         * Ranges moved : the hierarchy index is rebuilt from the mesh slots, which also drops the hierarchies of removed meshes
+         */
+        raw_data.MeshTriangleHierarchyIndex.clear();
+        for (uint32_t mesh_slot = 0; mesh_slot < raw_data.MeshCollection.size(); ++mesh_slot)
+        {
+            const auto& mesh = raw_data.MeshCollection[mesh_slot];
+            if (raw_data.MeshTriangleHierarchyCollection[mesh_slot])
+            {
+                raw_data.MeshTriangleHierarchyIndex.try_emplace({mesh.VertexOffset, mesh.IndexOffset, mesh.IndexCount}, raw_data.MeshTriangleHierarchyCollection[mesh_slot]);
+            }
+        }
+        raw_data.GeometryRevision++;
+        raw_data.GeometryBufferRevision++;
+    }
+
+    uint32_t Scene::__AddSceneNodeMesh(int32_t node_identifier, const Meshes::MeshVNext& mesh)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        uint32_t mesh_slot = m_raw_data->MeshNodeCollection.size();
+        m_raw_data->MeshNodeCollection.push_back(node_identifier);
+        m_raw_data->MeshCollection.push_back(mesh);
+        m_raw_data->MeshMaterialIndexCollection.push_back(__AddMaterial({}, {}));
+        m_raw_data->MeshWorldBoundCollection.push_back(Helpers::TransformAABB(mesh.LocalBounds, m_raw_data->GlobalTransformCollection[node_identifier]));
+        m_raw_data->MeshTriangleHierarchyCollection.emplace_back();
+        m_raw_data->SceneNodeMeshIndexCollection[node_identifier] = mesh_slot;
+        m_raw_data->IsMeshBoundingVolumeHierarchyValid            = false;
+        m_raw_data->GeometryRevision++;
+        return mesh_slot;
+    }
+
+    uint32_t Scene::__AddMaterial(const Meshes::MeshMaterial& material, std::string_view material_name)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        auto& raw_data                      = *m_raw_data;
+        auto [material_index, is_new_entry] = raw_data.MaterialIndex.try_emplace(material, (uint32_t) raw_data.MaterialCollection.size());
+        if (is_new_entry)
+        {
+            raw_data.MaterialCollection.push_back(material);
+            raw_data.MaterialNameCollection.emplace_back(material_name);
+            raw_data.MaterialRevision++;
+        }
+        return material_index->second;
+    }
+
+    void Scene::__CompactMaterials()
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+        /*
+         * Palette entries no longer referenced by a mesh slot are dropped, the remaining ones keep their relative order
+         */
+        auto&                 raw_data = *m_raw_data;
+        std::vector<uint32_t> material_remap(raw_data.MaterialCollection.size(), 0xFFFFFFFF);
+        for (uint32_t material_index : raw_data.MeshMaterialIndexCollection)
+        {
+            material_remap[material_index] = 0;
+        }
+
+        uint32_t material_count = 0;
+        for (uint32_t material_index = 0; material_index < material_remap.size(); ++material_index)
+        {
+            if (material_remap[material_index] == 0xFFFFFFFF)
+            {
+                continue;
+            }
+            material_remap[material_index]                  = material_count;
+            raw_data.MaterialCollection[material_count]     = raw_data.MaterialCollection[material_index];
+            raw_data.MaterialNameCollection[material_count] = std::move(raw_data.MaterialNameCollection[material_index]);
+            material_count++;
+        }
+
+        if (material_count == material_remap.size())
+        {
+            return;
+        }
+
+        for (uint32_t& material_index : raw_data.MeshMaterialIndexCollection)
+        {
+            material_index = material_remap[material_index];
+        }
+        raw_data.MaterialCollection.resize(material_count);
+        raw_data.MaterialNameCollection.resize(material_count);
+        raw_data.MaterialCollection.shrink_to_fit();
+        raw_data.MaterialNameCollection.shrink_to_fit();
+        raw_data.MaterialIndex.clear();
+        for (uint32_t material_index = 0; material_index < material_count; ++material_index)
+        {
+            raw_data.MaterialIndex.emplace(raw_data.MaterialCollection[material_index], material_index);
+        }
+        raw_data.MaterialRevision++;
+        raw_data.GeometryRevision++;
+    }
+
+    void Scene::__AddCookedAsset(const CookedAssetView& asset)
+    {
+        auto&                 raw_data = *m_raw_data;
+        std::vector<uint32_t> material_indices(asset.Materials.size());
+        std::vector<int32_t>  node_identifiers(asset.Nodes.size(), INVALID_SCENE_NODE_ID);
+        {
+            std::unique_lock lock(m_scene_node_mutex);
+            /*
+             * Cooked texture maps index the asset texture files, they are remapped to the scene textures before the materials join the palette.
+             * Textures are only loaded by PostProcessMaterials(), until then snapshots publish the materials untextured
+             */
+            std::vector<uint32_t> texture_indices(asset.TextureFiles.size());
+            for (uint32_t i = 0; i < texture_indices.size(); ++i)
+            {
+                texture_indices[i] = (uint32_t) AddTexture(std::string(asset.GetString(asset.TextureFiles[i])));
+            }
+
+            for (uint32_t i = 0; i < material_indices.size(); ++i)
+            {
+                auto material = asset.Materials[i];
+                for (uint32_t* texture_map : {&material.EmissiveTextureMap, &material.AlbedoTextureMap, &material.NormalTextureMap, &material.OpacityTextureMap})
+                {
+                    *texture_map = (*texture_map != INVALID_TEXTURE_MAP) ? texture_indices[*texture_map] : INVALID_TEXTURE_MAP;
+                }
+                material_indices[i] = __AddMaterial(material, asset.GetString(asset.MaterialNames[i]));
+            }
+            /*
+             * Storage is reserved for the whole asset, so the chunks below append without reallocating the scene arrays
+             */
+            raw_data.Vertices.reserve(raw_data.Vertices.size() + asset.Vertices.size());
+            raw_data.Indices.reserve(raw_data.Indices.size() + asset.Indices.size());
+            __ReserveSceneNodes((uint32_t) asset.Nodes.size());
+            m_streamed_node_identifier_collection.push_back(&node_identifiers);
+        }
+        /*
+         * Nodes are added in chunks, each chunk takes the scene lock once and is published right after. The first nodes show up within a
+         * few milliseconds and chunks double in size, so that publishing (which copies the hierarchy) stays proportional to the asset size.
+         * A chunk only appends the geometry of the meshes its nodes reference first
+         */
+        const auto                     node_count           = (uint32_t) asset.Nodes.size();
+        uint32_t                       chunk_begin          = 0;
+        uint32_t                       chunk_size           = m_import_chunk_node_count;
+        uint32_t                       appended_mesh_count  = 0;
+        size_t                         mesh_reference_count = 0;
+        size_t                         shared_byte_size     = 0;
+        std::vector<uint8_t>           is_mesh_referenced(asset.Meshes.size(), 0);
+        std::vector<Meshes::MeshVNext> mesh_collection(asset.Meshes.size());
+        while (chunk_begin < node_count)
+        {
+            const uint32_t chunk_end        = std::min(chunk_begin + chunk_size, node_count);
+            uint32_t       chunk_mesh_count = appended_mesh_count;
+            for (uint32_t i = chunk_begin; i < chunk_end; ++i)
+            {
+                chunk_mesh_count = std::max(chunk_mesh_count, (uint32_t) (asset.Nodes[i].Mesh + 1));
+            }
+
+            {
+                std::unique_lock lock(m_scene_node_mutex);
+
+                if (chunk_mesh_count > appended_mesh_count)
+                {
+                    uint32_t vertex_begin = UINT32_MAX;
+                    uint32_t vertex_end   = 0;
+                    uint32_t index_begin   = UINT32_MAX;
+                    uint32_t index_end     = 0;
+                    uint32_t meshlet_begin = UINT32_MAX;
+                    uint32_t meshlet_end   = 0;
+                    for (uint32_t i = appended_mesh_count; i < chunk_mesh_count; ++i)
+                    {
+                        const auto& cooked_mesh = asset.Meshes[i];
+                        vertex_begin            = std::min(vertex_begin, cooked_mesh.VertexOffset);
+                        vertex_end              = std::max(vertex_end, cooked_mesh.VertexOffset + cooked_mesh.VertexCount * Meshes::GetVertexFloatCount(cooked_mesh.Format));
+                        index_begin             = std::min(index_begin, cooked_mesh.IndexOffset);
+                        index_end               = std::max(
+                            index_end, cooked_mesh.IndexOffset + Meshes::GetIndexWordCount(Meshes::GetMeshIndexRangeCount(cooked_mesh.IndexCount, cooked_mesh.Lods), cooked_mesh.IndexType));
+                        meshlet_begin           = std::min(meshlet_begin, cooked_mesh.MeshletOffset);
+                        meshlet_end             = std::max(meshlet_end, cooked_mesh.MeshletOffset + cooked_mesh.MeshletCount);
+                    }
+                    /*
+                     * The range is appended at the current end of the scene geometry, cooked mesh ranges only need that offset added.
+                     * Vertex ranges are in floats and index ranges in words, so meshes of every vertex and index format are copied as they are
+                     */
+                    const uint32_t first_vertex = raw_data.SVertexOffset;
+                    const uint32_t first_index  = raw_data.SIndexOffset;
+                    raw_data.Vertices.resize((size_t) first_vertex + vertex_end - vertex_begin);
+                    raw_data.Indices.resize((size_t) first_index + index_end - index_begin);
+                    ParallelCopy(raw_data.Vertices.data() + first_vertex, asset.Vertices.data() + vertex_begin, (size_t) (vertex_end - vertex_begin) * sizeof(float));
+                    ParallelCopy(raw_data.Indices.data() + first_index, asset.Indices.data() + index_begin, (size_t) (index_end - index_begin) * sizeof(uint32_t));
+                    raw_data.SVertexOffset = first_vertex + vertex_end - vertex_begin;
+                    raw_data.SIndexOffset  = first_index + index_end - index_begin;
+                    /*
+                     * Meshlets are small and stay on the CPU, they are appended as they are
+                     */
+                    const auto first_meshlet = (uint32_t) raw_data.Meshlets.size();
+                    raw_data.Meshlets.insert(raw_data.Meshlets.end(), asset.Meshlets.begin() + meshlet_begin, asset.Meshlets.begin() + meshlet_end);
+
+                    for (uint32_t i = appended_mesh_count; i < chunk_mesh_count; ++i)
+                    {
+                        const auto& cooked_mesh   = asset.Meshes[i];
+                        auto&       mesh          = mesh_collection[i];
+                        mesh.VertexCount          = cooked_mesh.VertexCount;
+                        mesh.VertexOffset         = first_vertex + cooked_mesh.VertexOffset - vertex_begin;
+                        mesh.VertexUnitStreamSize = Meshes::GetVertexFloatCount(cooked_mesh.Format) * sizeof(float);
+                        mesh.StreamOffset         = (mesh.VertexOffset * sizeof(float));
+                        mesh.IndexOffset          = first_index + cooked_mesh.IndexOffset - index_begin;
+                        mesh.IndexCount           = cooked_mesh.IndexCount;
+                        mesh.IndexType            = cooked_mesh.IndexType;
+                        mesh.IndexUnitStreamSize  = (cooked_mesh.IndexType == Meshes::IndexFormat::UINT16) ? sizeof(uint16_t) : sizeof(uint32_t);
+                        mesh.IndexStreamOffset    = (mesh.IndexOffset * sizeof(uint32_t));
+                        mesh.Format               = cooked_mesh.Format;
+                        mesh.LocalBounds          = cooked_mesh.LocalBounds;
+                        mesh.Lods                 = cooked_mesh.Lods;
+                        mesh.MeshletOffset        = first_meshlet + cooked_mesh.MeshletOffset - meshlet_begin;
+                        mesh.MeshletCount         = cooked_mesh.MeshletCount;
+
+                        const uint32_t index_word_count = Meshes::GetIndexWordCount(Meshes::GetMeshIndexRangeCount(mesh.IndexCount, mesh.Lods), mesh.IndexType);
+                        mesh.TotalByteSize              = (mesh.VertexCount * mesh.VertexUnitStreamSize) + (index_word_count * sizeof(uint32_t));
+                    }
+                    appended_mesh_count = chunk_mesh_count;
+                }
+                /*
+                 * Cooked parents precede their children, so their scene identifiers are known when a node is added.
+                 * A parent removed while the asset streams in drops its remaining descendants
+                 */
+                for (uint32_t i = chunk_begin; i < chunk_end; ++i)
+                {
+                    const auto&   node              = asset.Nodes[i];
+                    const int32_t parent_identifier = (node.Parent < 0) ? SCENE_ROOT_PARENT_ID : node_identifiers[node.Parent];
+                    if ((node.Parent >= 0) && !__IsSceneNodeAlive(parent_identifier))
+                    {
+                        continue;
+                    }
+
+                    const int32_t scene_node_identifier = __AddNode(parent_identifier, node.DepthLevel);
+                    node_identifiers[i]                 = scene_node_identifier;
+                    __SetSceneNodeName(scene_node_identifier, asset.GetString(node.Name));
+                    raw_data.LocalTransformCollection[scene_node_identifier] = asset.LocalTransforms[i];
+
+                    if (node.Mesh < 0)
+                    {
+                        continue;
+                    }
+
+                    uint32_t mesh_slot                              = __AddSceneNodeMesh(scene_node_identifier, mesh_collection[node.Mesh]);
+                    raw_data.MeshMaterialIndexCollection[mesh_slot] = material_indices[asset.Meshes[node.Mesh].Material];
+
+                    mesh_reference_count++;
+                    if (is_mesh_referenced[node.Mesh])
+                    {
+                        shared_byte_size += mesh_collection[node.Mesh].TotalByteSize;
+                    }
+                    is_mesh_referenced[node.Mesh] = 1;
+                }
+            }
+            /*
+             * The render thread rarely wins the scene lock between two chunks, so the importer publishes them itself
+             */
+            TryPublishSnapshot();
+
+            chunk_begin = chunk_end;
+            chunk_size  = chunk_size * 2;
+        }
+
+        {
+            std::unique_lock lock(m_scene_node_mutex);
+            std::erase(m_streamed_node_identifier_collection, &node_identifiers);
+            /*
+             * Nodes are added in depth-first order while transform sweeps want parents before children. Only the asset nodes are
+             * renumbered, identifiers held on the other nodes of the scene stay valid
              */
-            const uint32_t       output_size = width * height * channel;
-            std::vector<uint8_t> mip_buffer(output_size);
-            uint32_t             output_width  = std::min(width, max_width);
-            uint32_t             output_height = std::min(height, max_height);
+            __ReorderSceneNodesBreadthFirst(node_identifiers);
+        }
+
+        if (shared_byte_size > 0)
+        {
+            ZENGINE_CORE_INFO(
+                "Asset import : {0} mesh references share {1} meshes, {2:.2f} MB of geometry not duplicated",
+                mesh_reference_count,
+                mesh_collection.size(),
+                shared_byte_size / (1024.0 * 1024.0))
+        }
+    }
+
+    int32_t Scene::AddTexture(std::string_view filename)
+    {
+        std::unique_lock lock(m_scene_node_mutex);
+
+        if (filename.empty())
+        {
+            return -1;
+        }
+
+        if (!std::filesystem::exists(filename))
+        {
+            return -1;
+        }
+
+        auto found = std::find(m_texture_file_collection.begin(), m_texture_file_collection.end(), std::string(filename));
+        if (found == std::end(m_texture_file_collection))
+        {
+            //m_raw_data->TextureCollection->Add(Textures::Texture2D::Read(filename));
+
+            m_texture_file_collection.emplace_back(filename.data());
+            return (m_texture_file_collection.size() - 1);
+        }
 
-            stbir_resize_uint8(downscaled_texture_pixel, width, height, 0, mip_buffer.data(), output_width, output_height, 0, channel);
-            stbi_write_png(downscaled_texture.c_str(), output_width, output_height, channel, mip_buffer.data(), 0);
+        return std::distance(std::begin(m_texture_file_collection), found);
+    }
 
-            /*
-            * Override filename
-            */
-            file = downscaled_texture;
+    void Scene::PostProcessMaterials()
+    {
+        /*
+         * Concurrent imports post-process their textures one after the other, texture files and loaded textures share their indices
+         */
+        std::unique_lock texture_lock(m_texture_mutex);
 
-            if (file_pixel)
+        std::vector<std::string> texture_files;
+        std::vector<std::string> opacity_files;
+        uint32_t                 first_texture = 0;
+        {
+            std::unique_lock lock(m_scene_node_mutex);
+            /*
+             * Only the texture files added since the last call are processed
+             */
+            first_texture = m_raw_data->TextureCollection->Size();
+            texture_files.assign(m_texture_file_collection.begin() + first_texture, m_texture_file_collection.end());
+            opacity_files.resize(texture_files.size());
+            for (const auto& material_data : m_raw_data->MaterialCollection)
             {
-                stbi_image_free(file_pixel);
+                if ((material_data.OpacityTextureMap != INVALID_TEXTURE_MAP) && (material_data.AlbedoTextureMap != INVALID_TEXTURE_MAP) &&
+                    (material_data.AlbedoTextureMap >= first_texture) && (material_data.AlbedoTextureMap < m_texture_file_collection.size()))
+                {
+                    opacity_files[material_data.AlbedoTextureMap - first_texture] = m_texture_file_collection[material_data.OpacityTextureMap];
+                }
             }
         }
-
-        for (std::string_view file : s_texture_file_collection)
+        /*
+         * Ensuring output directory exist
+         */
+        const auto current_directoy   = std::filesystem::current_path();
+        const auto output_texture_dir = fmt::format("{0}\\{1}", current_directoy.string(), "__imported/out_textures/");
+        /*
+         * Textures are decoded and downscaled on the thread pool without the scene lock, then join the scene batch after batch : each
+         * batch is published, so materials get their textures progressively
+         */
+        std::vector<std::string> output_files(texture_files.size());
+        for (uint32_t batch_begin = 0; batch_begin < texture_files.size(); batch_begin += TEXTURE_IMPORT_BATCH_SIZE)
         {
-            s_raw_data->TextureCollection->Add(Textures::Texture2D::Read(file));
+            const uint32_t batch_end = std::min(batch_begin + TEXTURE_IMPORT_BATCH_SIZE, (uint32_t) texture_files.size());
+            Helpers::ThreadPoolHelper::ParallelFor(batch_end - batch_begin, [&](uint32_t begin, uint32_t end) {
+                for (uint32_t i = batch_begin + begin; i < batch_begin + end; ++i)
+                {
+                    output_files[i] = DownscaleTextureFile(texture_files[i], opacity_files[i], output_texture_dir);
+                }
+            });
+
+            std::vector<Ref<Textures::Texture>> textures;
+            for (uint32_t i = batch_begin; i < batch_end; ++i)
+            {
+                textures.push_back(Textures::Texture2D::Read(output_files[i]));
+            }
+
+            {
+                std::unique_lock lock(m_scene_node_mutex);
+                for (uint32_t i = batch_begin; i < batch_end; ++i)
+                {
+                    /*
+                     * Override filename
+                     */
+                    m_texture_file_collection[first_texture + i] = output_files[i];
+                    m_raw_data->TextureCollection->Add(textures[i - batch_begin]);
+                }
+            }
+            TryPublishSnapshot();
         }
     }
 
-    void GraphicScene::__ReadAssetFileAsync(std::string_view filename, ReadCallback callback)
+    std::future<void> Scene::__ReadAssetFileAsync(std::string_view filename, Meshes::VertexFormat vertex_format, ReadCallback callback)
     {
-        std::thread([path = std::string(filename.data()), callback] {
+        auto completion        = std::make_shared<std::promise<void>>();
+        auto completion_future = completion->get_future();
+        /*
+         * The worker thread keeps the scene alive until the import is over
+         */
+        std::thread([scene = Ref<Scene>(this), path = std::string(filename), vertex_format, callback, completion] {
             std::filesystem::path asset_path(path);
             auto                  parent_directory = asset_path.parent_path();
 
-            Assimp::Importer importer = {};
-            uint32_t         read_flags = aiProcess_JoinIdenticalVertices | aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_SplitLargeMeshes |
-                                  aiProcess_ImproveCacheLocality | aiProcess_RemoveRedundantMaterials | aiProcess_GenUVCoords | aiProcess_FlipUVs |
-                                  aiProcess_ValidateDataStructure | aiProcess_FindDegenerates | aiProcess_FindInvalidData | aiProcess_LimitBoneWeights;
+            /*
+             * Meshes are optimized for the vertex cache when cooked (see OptimizeAssetMeshGeometry()), aiProcess_ImproveCacheLocality would be redundant
+             */
+            uint32_t read_flags = aiProcess_JoinIdenticalVertices | aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_SplitLargeMeshes |
+                                  aiProcess_RemoveRedundantMaterials | aiProcess_GenUVCoords | aiProcess_FlipUVs | aiProcess_ValidateDataStructure |
+                                  aiProcess_FindDegenerates | aiProcess_FindInvalidData | aiProcess_LimitBoneWeights;
+            /*
+             * The cooked asset is keyed by the source content, the import flags and the vertex format. Files the source refers to (material
+             * libraries, textures) are not part of the key, textures being read again at each import anyway
+             */
+            CookedAssetKey            cooked_asset_key = {};
+            Helpers::MemoryMappedFile source_file;
+            if (source_file.Open(path))
+            {
+                cooked_asset_key = {
+                    .SourceHash   = ComputeContentHash(source_file.GetData(), source_file.GetSize()),
+                    .SourceSize   = source_file.GetSize(),
+                    .ImportFlags  = read_flags,
+                    .VertexFormat = (uint32_t) vertex_format};
+                source_file.Close();
+            }
+
+            const auto      cooked_asset_filename = GetCookedAssetFilename(asset_path, vertex_format);
+            CookedAssetFile cooked_asset_file;
+            if ((cooked_asset_key.SourceSize > 0) && cooked_asset_file.Open(cooked_asset_filename, cooked_asset_key))
+            {
+                ZENGINE_CORE_INFO("Asset import : {0} loaded from the cooked asset {1}", path, cooked_asset_filename)
+                if (callback)
+                {
+                    callback(true, cooked_asset_file.GetView()).wait();
+                }
+                completion->set_value();
+                return;
+            }
 
-            bool           result    = true;
-            const aiScene* scene_ptr = importer.ReadFile(path, read_flags);
+            Assimp::Importer importer = {};
+            bool             result    = true;
+            const aiScene*   scene_ptr = importer.ReadFile(path, read_flags);
             if ((!scene_ptr) || scene_ptr->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene_ptr->mRootNode)
             {
                 result = false;
             }
 
-            if (callback)
+            CookedAssetData cooked_asset;
+            if (result)
             {
-                callback(result, scene_ptr, parent_directory.string());
+                CookAssimpScene(scene_ptr, parent_directory.string(), vertex_format, cooked_asset);
+                if ((cooked_asset_key.SourceSize > 0) && !WriteCookedAsset(cooked_asset_filename, cooked_asset_key, cooked_asset.GetView()))
+                {
+                    ZENGINE_CORE_WARN("Asset import : failed to write the cooked asset {0}", cooked_asset_filename)
+                }
             }
             importer.FreeScene();
+
+            if (callback)
+            {
+                callback(result, cooked_asset.GetView()).wait();
+            }
+            completion->set_value();
         }).detach();
+
+        return completion_future;
     }
 
-    GraphicSceneEntity GraphicScene::GetPrimariyCameraEntity()
+    GraphicSceneEntity Scene::GetPrimariyCameraEntity()
     {
         GraphicSceneEntity camera_entity;
 
-        auto view_cameras = s_raw_data->EntityRegistry->view<CameraComponent>();
+        auto view_cameras = m_raw_data->EntityRegistry->view<CameraComponent>();
         for (auto entity : view_cameras)
         {
             auto& component = view_cameras.get<CameraComponent>(entity);
             if (component.IsPrimaryCamera)
             {
-                camera_entity = GraphicSceneEntity::CreateWrapper(s_raw_data->EntityRegistry, entity);
+                camera_entity = GraphicSceneEntity::CreateWrapper(m_raw_data->EntityRegistry, entity);
                 break;
             }
         }
         return camera_entity;
     }
+
+
+    /*
+     * GraphicScene facade
+     */
+    std::mutex              GraphicScene::s_scene_instance_mutex;
+    Ref<Scene>              GraphicScene::s_active_scene             = nullptr;
+    Ref<Scene>              GraphicScene::s_pending_scene            = nullptr;
+    std::vector<Ref<Scene>> GraphicScene::s_retired_scene_collection = {};
+
+    void GraphicScene::Initialize()
+    {
+        auto scene = CreateRef<Scene>();
+        scene->Initialize();
+
+        std::lock_guard lock(s_scene_instance_mutex);
+        s_active_scene  = scene;
+        s_pending_scene = nullptr;
+    }
+
+    void GraphicScene::Deinitialize()
+    {
+        std::lock_guard lock(s_scene_instance_mutex);
+        for (auto& scene : {s_active_scene, s_pending_scene})
+        {
+            if (scene)
+            {
+                scene->Deinitialize();
+            }
+        }
+        for (auto& scene : s_retired_scene_collection)
+        {
+            scene->Deinitialize();
+        }
+        s_active_scene  = nullptr;
+        s_pending_scene = nullptr;
+        s_retired_scene_collection.clear();
+    }
+
+    Ref<Scene> GraphicScene::GetActiveScene()
+    {
+        std::lock_guard lock(s_scene_instance_mutex);
+        return s_active_scene;
+    }
+
+    void GraphicScene::SetPendingScene(const Ref<Scene>& scene)
+    {
+        std::lock_guard lock(s_scene_instance_mutex);
+        s_pending_scene = scene;
+    }
+
+    std::future<Ref<Scene>> GraphicScene::LoadSceneAsync(std::string_view asset_filename, Meshes::VertexFormat vertex_format)
+    {
+        auto scene = CreateRef<Scene>();
+        scene->Initialize();
+        /*
+         * The import runs on its own worker thread and only touches the new scene, the active one is never locked
+         */
+        co_await scene->ImportAssetAsync(asset_filename, vertex_format);
+
+        scene->ComputeAllTransforms();
+        scene->PublishSnapshot();
+        SetPendingScene(scene);
+        co_return scene;
+    }
+
+    bool GraphicScene::ActivatePendingScene()
+    {
+        std::lock_guard lock(s_scene_instance_mutex);
+        /*
+         * Replaced scenes are deinitialized at a later frame boundary, once the renderer dropped the last snapshot referencing their data
+         */
+        std::erase_if(s_retired_scene_collection, [](const Ref<Scene>& scene) {
+            if (!scene->ReleaseSnapshots())
+            {
+                return false;
+            }
+            scene->Deinitialize();
+            return true;
+        });
+
+        if (!s_pending_scene)
+        {
+            return false;
+        }
+
+        if (s_active_scene)
+        {
+            s_retired_scene_collection.push_back(s_active_scene);
+        }
+        s_active_scene  = s_pending_scene;
+        s_pending_scene = nullptr;
+        return true;
+    }
+
+    GraphicSceneEntity GraphicScene::GetPrimariyCameraEntity()
+    {
+        return GetActiveScene()->GetPrimariyCameraEntity();
+    }
+
+    std::future<GraphicSceneEntity> GraphicScene::CreateEntityAsync(std::string_view entity_name)
+    {
+        return GetActiveScene()->CreateEntityAsync(entity_name);
+    }
+
+    std::future<GraphicSceneEntity> GraphicScene::CreateEntityAsync(uuids::uuid uuid, std::string_view entity_name)
+    {
+        return GetActiveScene()->CreateEntityAsync(uuid, entity_name);
+    }
+
+    std::future<GraphicSceneEntity> GraphicScene::CreateEntityAsync(std::string_view uuid_string, std::string_view entity_name)
+    {
+        return GetActiveScene()->CreateEntityAsync(uuid_string, entity_name);
+    }
+
+    std::future<GraphicSceneEntity> GraphicScene::GetEntityAsync(std::string_view entity_name)
+    {
+        return GetActiveScene()->GetEntityAsync(entity_name);
+    }
+
+    std::future<GraphicSceneEntity> GraphicScene::GetEntityAsync(uuids::uuid uuid)
+    {
+        return GetActiveScene()->GetEntityAsync(uuid);
+    }
+
+    std::future<std::vector<GraphicSceneEntity>> GraphicScene::GetEntitiesAsync(std::string_view entity_name)
+    {
+        return GetActiveScene()->GetEntitiesAsync(entity_name);
+    }
+
+    std::future<bool> GraphicScene::RenameEntityAsync(const GraphicSceneEntity& entity, std::string_view entity_name)
+    {
+        return GetActiveScene()->RenameEntityAsync(entity, entity_name);
+    }
+
+    std::future<bool> GraphicScene::RemoveEntityAsync(const GraphicSceneEntity& entity)
+    {
+        return GetActiveScene()->RemoveEntityAsync(entity);
+    }
+
+    std::shared_ptr<entt::registry> GraphicScene::GetRegistry()
+    {
+        return GetActiveScene()->GetRegistry();
+    }
+
+    std::future<int32_t> GraphicScene::AddNodeAsync(int parent_node, int depth_level)
+    {
+        return GetActiveScene()->AddNodeAsync(parent_node, depth_level);
+    }
+
+    std::future<int32_t> GraphicScene::AddNodesAsync(int parent_node, int depth_level, uint32_t count)
+    {
+        return GetActiveScene()->AddNodesAsync(parent_node, depth_level, count);
+    }
+
+    std::future<bool> GraphicScene::RemoveNodeAsync(int32_t node_identifier)
+    {
+        return GetActiveScene()->RemoveNodeAsync(node_identifier);
+    }
+
+    int32_t GraphicScene::GetSceneNodeParent(int32_t node_identifier)
+    {
+        return GetActiveScene()->GetSceneNodeParent(node_identifier);
+    }
+
+    int32_t GraphicScene::GetSceneNodeFirstChild(int32_t node_identifier)
+    {
+        return GetActiveScene()->GetSceneNodeFirstChild(node_identifier);
+    }
+
+    std::vector<int32_t> GraphicScene::GetSceneNodeSiblingCollection(int32_t node_identifier)
+    {
+        return GetActiveScene()->GetSceneNodeSiblingCollection(node_identifier);
+    }
+
+    std::string_view GraphicScene::GetSceneNodeName(int32_t node_identifier)
+    {
+        return GetActiveScene()->GetSceneNodeName(node_identifier);
+    }
+
+    glm::mat4 GraphicScene::GetSceneNodeLocalTransform(int32_t node_identifier)
+    {
+        return GetActiveScene()->GetSceneNodeLocalTransform(node_identifier);
+    }
+
+    glm::mat4 GraphicScene::GetSceneNodeGlobalTransform(int32_t node_identifier)
+    {
+        return GetActiveScene()->GetSceneNodeGlobalTransform(node_identifier);
+    }
+
+    SceneNodeHierarchy GraphicScene::GetSceneNodeHierarchy(int32_t node_identifier)
+    {
+        return GetActiveScene()->GetSceneNodeHierarchy(node_identifier);
+    }
+
+    GraphicSceneEntity GraphicScene::GetSceneNodeEntityWrapper(int32_t node_identifier)
+    {
+        return GetActiveScene()->GetSceneNodeEntityWrapper(node_identifier);
+    }
+
+    void GraphicScene::SetSceneNodeLocalTransform(int32_t node_identifier, const glm::mat4& transform)
+    {
+        GetActiveScene()->SetSceneNodeLocalTransform(node_identifier, transform);
+    }
+
+    bool GraphicScene::IsSceneNodeAlive(int32_t node_identifier)
+    {
+        return GetActiveScene()->IsSceneNodeAlive(node_identifier);
+    }
+
+    std::future<void> GraphicScene::SetSceneNodeNameAsync(int32_t node_identifier, std::string_view node_name)
+    {
+        return GetActiveScene()->SetSceneNodeNameAsync(node_identifier, node_name);
+    }
+
+    std::future<Meshes::MeshVNext> GraphicScene::GetSceneNodeMeshAsync(int32_t node_identifier)
+    {
+        return GetActiveScene()->GetSceneNodeMeshAsync(node_identifier);
+    }
+
+    void GraphicScene::MarkSceneNodeAsChanged(int32_t node_identifier)
+    {
+        GetActiveScene()->MarkSceneNodeAsChanged(node_identifier);
+    }
+
+    bool GraphicScene::HasSceneNodes()
+    {
+        return GetActiveScene()->HasSceneNodes();
+    }
+
+    std::vector<int32_t> GraphicScene::GetRootSceneNodes()
+    {
+        return GetActiveScene()->GetRootSceneNodes();
+    }
+
+    std::future<void> GraphicScene::ImportAssetAsync(std::string_view asset_filename, Meshes::VertexFormat vertex_format)
+    {
+        return GetActiveScene()->ImportAssetAsync(asset_filename, vertex_format);
+    }
+
+    Ref<SceneRawData> GraphicScene::GetRawData()
+    {
+        return GetActiveScene()->GetRawData();
+    }
+
+    void GraphicScene::ComputeAllTransforms()
+    {
+        GetActiveScene()->ComputeAllTransforms();
+    }
+
+    void GraphicScene::ImportCookedAsset(const CookedAssetView& asset)
+    {
+        GetActiveScene()->ImportCookedAsset(asset);
+    }
+
+    void GraphicScene::SetImportChunkNodeCount(uint32_t node_count)
+    {
+        GetActiveScene()->SetImportChunkNodeCount(node_count);
+    }
+
+    std::vector<int32_t> GraphicScene::ReorderSceneNodesBreadthFirst()
+    {
+        return GetActiveScene()->ReorderSceneNodesBreadthFirst();
+    }
+
+    std::vector<int32_t> GraphicScene::CompactScene()
+    {
+        return GetActiveScene()->CompactScene();
+    }
+
+    void GraphicScene::SetTransformWorkerCount(uint32_t worker_count)
+    {
+        GetActiveScene()->SetTransformWorkerCount(worker_count);
+    }
+
+    std::vector<int32_t> GraphicScene::QuerySceneNodesInBounds(const Helpers::AABB& bounds)
+    {
+        return GetActiveScene()->QuerySceneNodesInBounds(bounds);
+    }
+
+    SceneRaycastHit GraphicScene::RaycastSceneNodes(const Helpers::Ray& ray)
+    {
+        return GetActiveScene()->RaycastSceneNodes(ray);
+    }
+
+    void GraphicScene::RaycastSceneNodes(const Helpers::Ray* rays, uint32_t ray_count, SceneRaycastHit* hits)
+    {
+        GetActiveScene()->RaycastSceneNodes(rays, ray_count, hits);
+    }
+
+    SceneOverlapQueryResult GraphicScene::QuerySceneNodesInBounds(const Helpers::AABB* bounds, uint32_t bounds_count)
+    {
+        return GetActiveScene()->QuerySceneNodesInBounds(bounds, bounds_count);
+    }
+
+    void GraphicScene::QueryNearestSceneNodes(const glm::vec3* points, uint32_t point_count, float max_distance, SceneNearestHit* hits)
+    {
+        GetActiveScene()->QueryNearestSceneNodes(points, point_count, max_distance, hits);
+    }
+
+    void GraphicScene::SetSpatialQueryWorkerCount(uint32_t worker_count)
+    {
+        GetActiveScene()->SetSpatialQueryWorkerCount(worker_count);
+    }
+
+    void GraphicScene::PublishSnapshot()
+    {
+        GetActiveScene()->PublishSnapshot();
+    }
+
+    bool GraphicScene::TryPublishSnapshot()
+    {
+        return GetActiveScene()->TryPublishSnapshot();
+    }
+
+    Ref<SceneSnapshot> GraphicScene::AcquireSnapshot()
+    {
+        return GetActiveScene()->AcquireSnapshot();
+    }
+
+    Ref<SceneSnapshot> GraphicScene::GetSnapshot()
+    {
+        return GetActiveScene()->GetSnapshot();
+    }
+
+    int32_t GraphicScene::AddTexture(std::string_view filename)
+    {
+        return GetActiveScene()->AddTexture(filename);
+    }
+
+    void GraphicScene::PostProcessMaterials()
+    {
+        GetActiveScene()->PostProcessMaterials();
+    }
 } // namespace ZEngine::Rendering::Scenes
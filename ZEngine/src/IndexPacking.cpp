@@ -0,0 +1,39 @@
+#include <pch.h>
+#include <Rendering/Meshes/IndexPacking.h>
+
+namespace ZEngine::Rendering::Meshes
+{
+    IndexFormat SelectIndexFormat(uint32_t vertex_count)
+    {
+        return (vertex_count <= MAX_UINT16_INDEX_VERTEX_COUNT) ? IndexFormat::UINT16 : IndexFormat::UINT32;
+    }
+
+    uint32_t GetIndexWordCount(uint32_t index_count, IndexFormat format)
+    {
+        return (format == IndexFormat::UINT16) ? ((index_count + 1) / 2) : index_count;
+    }
+
+    void PackIndices(std::vector<uint32_t>& indices)
+    {
+        const auto index_count = (uint32_t) indices.size();
+        /*
+         * Word k is written from indices 2k and 2k + 1, which are never before it : the stream can be rewritten front to back
+         */
+        for (uint32_t i = 0; i < index_count; i += 2)
+        {
+            const uint32_t upper = ((i + 1) < index_count) ? indices[i + 1] : 0;
+            indices[i / 2]       = (indices[i] & 0xFFFF) | (upper << 16);
+        }
+        indices.resize(GetIndexWordCount(index_count, IndexFormat::UINT16));
+    }
+
+    std::vector<uint32_t> DecodeIndices(const uint32_t* words, uint32_t index_count, IndexFormat format)
+    {
+        std::vector<uint32_t> indices(index_count);
+        for (uint32_t i = 0; i < index_count; ++i)
+        {
+            indices[i] = ReadIndex(words, i, format);
+        }
+        return indices;
+    }
+} // namespace ZEngine::Rendering::Meshes
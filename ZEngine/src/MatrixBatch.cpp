@@ -0,0 +1,162 @@
+#include <pch.h>
+#include <Helpers/MatrixBatch.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define ZENGINE_MATRIX_BATCH_X86 1
+#include <immintrin.h>
+#else
+#define ZENGINE_MATRIX_BATCH_X86 0
+#endif
+
+#if ZENGINE_MATRIX_BATCH_X86 && (defined(__GNUC__) || defined(__clang__))
+#define ZENGINE_TARGET_SSE4 __attribute__((target("sse4.1")))
+#define ZENGINE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define ZENGINE_TARGET_SSE4
+#define ZENGINE_TARGET_AVX2
+#endif
+
+static_assert(sizeof(glm::mat4) == (16 * sizeof(float)), "glm::mat4 is expected to be 16 tightly packed floats");
+
+namespace ZEngine::Helpers
+{
+    /*
+     * Matrices are column major : column c of the result is the sum over k of parent.column[k] * local[c][k]
+     */
+    static void MultiplyScalar(const float* parent, const float* local, float* output)
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            for (int row = 0; row < 4; ++row)
+            {
+                float value = parent[row] * local[column * 4];
+                value       = value + parent[4 + row] * local[column * 4 + 1];
+                value       = value + parent[8 + row] * local[column * 4 + 2];
+                value       = value + parent[12 + row] * local[column * 4 + 3];
+
+                output[column * 4 + row] = value;
+            }
+        }
+    }
+
+#if ZENGINE_MATRIX_BATCH_X86
+    ZENGINE_TARGET_SSE4 static void MultiplySSE4(const float* parent, const float* local, float* output)
+    {
+        const __m128 parent_column_0 = _mm_loadu_ps(parent);
+        const __m128 parent_column_1 = _mm_loadu_ps(parent + 4);
+        const __m128 parent_column_2 = _mm_loadu_ps(parent + 8);
+        const __m128 parent_column_3 = _mm_loadu_ps(parent + 12);
+
+        for (int column = 0; column < 4; ++column)
+        {
+            const __m128 local_column = _mm_loadu_ps(local + column * 4);
+
+            __m128 result = _mm_mul_ps(parent_column_0, _mm_shuffle_ps(local_column, local_column, _MM_SHUFFLE(0, 0, 0, 0)));
+            result        = _mm_add_ps(result, _mm_mul_ps(parent_column_1, _mm_shuffle_ps(local_column, local_column, _MM_SHUFFLE(1, 1, 1, 1))));
+            result        = _mm_add_ps(result, _mm_mul_ps(parent_column_2, _mm_shuffle_ps(local_column, local_column, _MM_SHUFFLE(2, 2, 2, 2))));
+            result        = _mm_add_ps(result, _mm_mul_ps(parent_column_3, _mm_shuffle_ps(local_column, local_column, _MM_SHUFFLE(3, 3, 3, 3))));
+            _mm_storeu_ps(output + column * 4, result);
+        }
+    }
+
+    /*
+     * Two result columns are computed per 256-bit register : each parent column is duplicated in both 128-bit lanes
+     * and the matching local coefficients are splatted per lane
+     */
+    ZENGINE_TARGET_AVX2 static void MultiplyAVX2(const float* parent, const float* local, float* output)
+    {
+        const __m256 parent_column_0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(parent));
+        const __m256 parent_column_1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(parent + 4));
+        const __m256 parent_column_2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(parent + 8));
+        const __m256 parent_column_3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(parent + 12));
+
+        for (int column = 0; column < 4; column += 2)
+        {
+            const __m256 local_columns = _mm256_loadu_ps(local + column * 4);
+
+            __m256 result = _mm256_mul_ps(parent_column_0, _mm256_permute_ps(local_columns, 0x00));
+            result        = _mm256_fmadd_ps(parent_column_1, _mm256_permute_ps(local_columns, 0x55), result);
+            result        = _mm256_fmadd_ps(parent_column_2, _mm256_permute_ps(local_columns, 0xAA), result);
+            result        = _mm256_fmadd_ps(parent_column_3, _mm256_permute_ps(local_columns, 0xFF), result);
+            _mm256_storeu_ps(output + column * 4, result);
+        }
+    }
+
+    ZENGINE_TARGET_SSE4 static void MultiplyBatchSSE4(const int32_t* parent_indices, const uint32_t* node_indices, const float* local, float* global, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const uint32_t node   = node_indices[i];
+            const int32_t  parent = parent_indices[i];
+            if (parent < 0)
+            {
+                _mm_storeu_ps(global + node * 16, _mm_loadu_ps(local + node * 16));
+                _mm_storeu_ps(global + node * 16 + 4, _mm_loadu_ps(local + node * 16 + 4));
+                _mm_storeu_ps(global + node * 16 + 8, _mm_loadu_ps(local + node * 16 + 8));
+                _mm_storeu_ps(global + node * 16 + 12, _mm_loadu_ps(local + node * 16 + 12));
+                continue;
+            }
+            MultiplySSE4(global + parent * 16, local + node * 16, global + node * 16);
+        }
+    }
+
+    ZENGINE_TARGET_AVX2 static void MultiplyBatchAVX2(const int32_t* parent_indices, const uint32_t* node_indices, const float* local, float* global, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const uint32_t node   = node_indices[i];
+            const int32_t  parent = parent_indices[i];
+            if (parent < 0)
+            {
+                _mm256_storeu_ps(global + node * 16, _mm256_loadu_ps(local + node * 16));
+                _mm256_storeu_ps(global + node * 16 + 8, _mm256_loadu_ps(local + node * 16 + 8));
+                continue;
+            }
+            MultiplyAVX2(global + parent * 16, local + node * 16, global + node * 16);
+        }
+    }
+#endif
+
+    void MultiplyHierarchyTransformBatch(const int32_t* parent_indices, const uint32_t* node_indices, const glm::mat4* local, glm::mat4* global, uint32_t count)
+    {
+        MultiplyHierarchyTransformBatch(GetSimdBackend(), parent_indices, node_indices, local, global, count);
+    }
+
+    void MultiplyHierarchyTransformBatch(
+        SimdBackend      backend,
+        const int32_t*   parent_indices,
+        const uint32_t*  node_indices,
+        const glm::mat4* local,
+        glm::mat4*       global,
+        uint32_t         count)
+    {
+        const float* local_data  = reinterpret_cast<const float*>(local);
+        float*       global_data = reinterpret_cast<float*>(global);
+
+        switch (backend)
+        {
+#if ZENGINE_MATRIX_BATCH_X86
+            case SimdBackend::AVX2:
+                MultiplyBatchAVX2(parent_indices, node_indices, local_data, global_data, count);
+                return;
+            case SimdBackend::SSE4:
+                MultiplyBatchSSE4(parent_indices, node_indices, local_data, global_data, count);
+                return;
+#endif
+            default:
+                break;
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const uint32_t node   = node_indices[i];
+            const int32_t  parent = parent_indices[i];
+            if (parent < 0)
+            {
+                global[node] = local[node];
+                continue;
+            }
+            MultiplyScalar(global_data + parent * 16, local_data + node * 16, global_data + node * 16);
+        }
+    }
+} // namespace ZEngine::Helpers
@@ -0,0 +1,130 @@
+#include <pch.h>
+#include <Helpers/MemoryMappedFile.h>
+#include <string>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ZEngine::Helpers
+{
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Close();
+    }
+
+    bool MemoryMappedFile::Open(std::string_view filename)
+    {
+        Close();
+        const std::string path(filename);
+#ifdef _WIN32
+        HANDLE file_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_handle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+        m_file_handle = file_handle;
+
+        LARGE_INTEGER file_size = {};
+        if (!GetFileSizeEx(file_handle, &file_size) || (file_size.QuadPart == 0))
+        {
+            Close();
+            return false;
+        }
+
+        m_mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_mapping_handle)
+        {
+            Close();
+            return false;
+        }
+
+        m_data = reinterpret_cast<const uint8_t*>(MapViewOfFile(m_mapping_handle, FILE_MAP_READ, 0, 0, 0));
+        m_size = (size_t) file_size.QuadPart;
+#else
+        m_file_descriptor = open(path.c_str(), O_RDONLY);
+        if (m_file_descriptor < 0)
+        {
+            return false;
+        }
+
+        struct stat file_status = {};
+        if ((fstat(m_file_descriptor, &file_status) != 0) || (file_status.st_size == 0))
+        {
+            Close();
+            return false;
+        }
+
+        void* view = mmap(nullptr, (size_t) file_status.st_size, PROT_READ, MAP_PRIVATE, m_file_descriptor, 0);
+        if (view != MAP_FAILED)
+        {
+            m_data = reinterpret_cast<const uint8_t*>(view);
+            m_size = (size_t) file_status.st_size;
+        }
+#endif
+        if (!m_data)
+        {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void MemoryMappedFile::Close()
+    {
+#ifdef _WIN32
+        if (m_data)
+        {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mapping_handle)
+        {
+            CloseHandle(m_mapping_handle);
+        }
+        if (m_file_handle)
+        {
+            CloseHandle(m_file_handle);
+        }
+        m_mapping_handle = nullptr;
+        m_file_handle    = nullptr;
+#else
+        if (m_data)
+        {
+            munmap(const_cast<uint8_t*>(m_data), m_size);
+        }
+        if (m_file_descriptor >= 0)
+        {
+            close(m_file_descriptor);
+        }
+        m_file_descriptor = -1;
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    bool MemoryMappedFile::IsOpen() const
+    {
+        return m_data != nullptr;
+    }
+
+    const uint8_t* MemoryMappedFile::GetData() const
+    {
+        return m_data;
+    }
+
+    size_t MemoryMappedFile::GetSize() const
+    {
+        return m_size;
+    }
+} // namespace ZEngine::Helpers
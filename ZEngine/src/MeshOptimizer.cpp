@@ -0,0 +1,425 @@
+#include <pch.h>
+#include <Rendering/Meshes/MeshOptimizer.h>
+#include <glm/glm.hpp>
+#include <array>
+#include <numeric>
+
+#define VERTEX_CACHE_OPTIMIZER_CACHE_SIZE 16
+#define VERTEX_CACHE_DECAY_POWER 1.5f
+#define VERTEX_CACHE_LAST_TRIANGLE_SCORE 0.75f
+#define VERTEX_VALENCE_BOOST_SCALE 2.0f
+#define VERTEX_VALENCE_BOOST_POWER 0.5f
+#define VERTEX_VALENCE_SCORE_TABLE_SIZE 32
+#define OVERDRAW_CLUSTER_CACHE_SIZE 16
+#define VERTEX_FETCH_CACHE_LINE_SIZE 64
+#define VERTEX_FETCH_CACHE_LINE_COUNT 128
+#define INVALID_VERTEX_INDEX 0xFFFFFFFF
+
+namespace ZEngine::Rendering::Meshes
+{
+    /*
+     * FIFO cache simulated with access timestamps : an entry is cached while fewer than `size` entries were inserted after it
+     */
+    struct FifoCache
+    {
+        std::vector<uint32_t> Timestamps;
+        uint32_t              Size{0};
+        uint32_t              Timestamp{0};
+
+        FifoCache(size_t entry_count, uint32_t size) : Timestamps(entry_count, 0), Size(size), Timestamp(size + 1) {}
+
+        bool Access(uint32_t entry)
+        {
+            if ((Timestamp - Timestamps[entry]) > Size)
+            {
+                Timestamps[entry] = Timestamp++;
+                return true;
+            }
+            return false;
+        }
+
+        void Flush()
+        {
+            Timestamp += Size + 1;
+        }
+    };
+
+    static uint64_t CountReferencedVertices(const std::vector<uint32_t>& indices, uint32_t vertex_count)
+    {
+        std::vector<uint8_t> referenced(vertex_count, 0);
+        uint64_t             referenced_count = 0;
+        for (uint32_t index : indices)
+        {
+            referenced_count += (referenced[index] == 0);
+            referenced[index] = 1;
+        }
+        return referenced_count;
+    }
+
+    float VertexCacheStatistics::GetACMR() const
+    {
+        return (TriangleCount > 0) ? (float) ((double) TransformedVertexCount / (double) TriangleCount) : 0.0f;
+    }
+
+    float VertexCacheStatistics::GetATVR() const
+    {
+        return (VertexCount > 0) ? (float) ((double) TransformedVertexCount / (double) VertexCount) : 0.0f;
+    }
+
+    VertexCacheStatistics& VertexCacheStatistics::operator+=(const VertexCacheStatistics& statistics)
+    {
+        TransformedVertexCount += statistics.TransformedVertexCount;
+        TriangleCount += statistics.TriangleCount;
+        VertexCount += statistics.VertexCount;
+        return *this;
+    }
+
+    float VertexFetchStatistics::GetOverfetch() const
+    {
+        return (VertexByteCount > 0) ? (float) ((double) FetchedByteCount / (double) VertexByteCount) : 0.0f;
+    }
+
+    VertexFetchStatistics& VertexFetchStatistics::operator+=(const VertexFetchStatistics& statistics)
+    {
+        FetchedByteCount += statistics.FetchedByteCount;
+        VertexByteCount += statistics.VertexByteCount;
+        return *this;
+    }
+
+    VertexCacheStatistics AnalyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertex_count, uint32_t cache_size)
+    {
+        VertexCacheStatistics statistics = {};
+        statistics.TriangleCount         = indices.size() / 3;
+        statistics.VertexCount           = CountReferencedVertices(indices, vertex_count);
+
+        FifoCache cache(vertex_count, cache_size);
+        for (uint32_t index : indices)
+        {
+            statistics.TransformedVertexCount += cache.Access(index);
+        }
+        return statistics;
+    }
+
+    VertexFetchStatistics AnalyzeVertexFetch(const std::vector<uint32_t>& indices, uint32_t vertex_count, uint32_t vertex_byte_size)
+    {
+        VertexFetchStatistics statistics = {};
+        statistics.VertexByteCount       = CountReferencedVertices(indices, vertex_count) * vertex_byte_size;
+
+        const size_t line_count = (((size_t) vertex_count * vertex_byte_size) + VERTEX_FETCH_CACHE_LINE_SIZE - 1) / VERTEX_FETCH_CACHE_LINE_SIZE;
+        FifoCache    cache(line_count, VERTEX_FETCH_CACHE_LINE_COUNT);
+        for (uint32_t index : indices)
+        {
+            const size_t first_line = ((size_t) index * vertex_byte_size) / VERTEX_FETCH_CACHE_LINE_SIZE;
+            const size_t last_line  = (((size_t) index + 1) * vertex_byte_size - 1) / VERTEX_FETCH_CACHE_LINE_SIZE;
+            for (size_t line = first_line; line <= last_line; ++line)
+            {
+                statistics.FetchedByteCount += cache.Access((uint32_t) line) ? VERTEX_FETCH_CACHE_LINE_SIZE : 0;
+            }
+        }
+        return statistics;
+    }
+
+    /*
+     * Vertices recently used score higher (the three of the last triangle get a fixed score so that strips are not favoured), and
+     * vertices with few remaining triangles get a boost so that they are finished off instead of being left behind.
+     * Both terms are tabulated, the optimizer scores vertices again after each emitted triangle
+     */
+    struct VertexScoreTable
+    {
+        std::array<float, VERTEX_CACHE_OPTIMIZER_CACHE_SIZE + 1> CacheScores;
+        std::array<float, VERTEX_VALENCE_SCORE_TABLE_SIZE>       ValenceScores;
+
+        VertexScoreTable()
+        {
+            CacheScores[0] = 0.0f;
+            for (uint32_t i = 0; i < VERTEX_CACHE_OPTIMIZER_CACHE_SIZE; ++i)
+            {
+                const float scaler = 1.0f / (VERTEX_CACHE_OPTIMIZER_CACHE_SIZE - 3);
+                CacheScores[i + 1] = (i < 3) ? VERTEX_CACHE_LAST_TRIANGLE_SCORE : std::pow(1.0f - (float) (i - 3) * scaler, VERTEX_CACHE_DECAY_POWER);
+            }
+
+            ValenceScores[0] = 0.0f;
+            for (uint32_t i = 1; i < VERTEX_VALENCE_SCORE_TABLE_SIZE; ++i)
+            {
+                ValenceScores[i] = VERTEX_VALENCE_BOOST_SCALE * std::pow((float) i, -VERTEX_VALENCE_BOOST_POWER);
+            }
+        }
+
+        float GetScore(int32_t cache_position, uint32_t remaining_valence) const
+        {
+            if (remaining_valence == 0)
+            {
+                return -1.0f;
+            }
+
+            const float valence_score = (remaining_valence < VERTEX_VALENCE_SCORE_TABLE_SIZE)
+                                            ? ValenceScores[remaining_valence]
+                                            : VERTEX_VALENCE_BOOST_SCALE * std::pow((float) remaining_valence, -VERTEX_VALENCE_BOOST_POWER);
+            return CacheScores[cache_position + 1] + valence_score;
+        }
+    };
+
+    void OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertex_count)
+    {
+        const size_t triangle_count = indices.size() / 3;
+        if (triangle_count == 0)
+        {
+            return;
+        }
+        /*
+         * Triangles of each vertex, the first `valence` entries of a vertex range are the triangles not emitted yet
+         */
+        std::vector<uint32_t> valence(vertex_count, 0);
+        for (uint32_t index : indices)
+        {
+            valence[index]++;
+        }
+
+        std::vector<uint32_t> adjacency_offset(vertex_count + 1, 0);
+        for (uint32_t i = 0; i < vertex_count; ++i)
+        {
+            adjacency_offset[i + 1] = adjacency_offset[i] + valence[i];
+        }
+
+        std::vector<uint32_t> adjacency(indices.size());
+        std::vector<uint32_t> adjacency_fill(adjacency_offset.begin(), adjacency_offset.end() - 1);
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            adjacency[adjacency_fill[indices[i]]++] = (uint32_t) (i / 3);
+        }
+
+        static const VertexScoreTable score_table;
+        std::vector<int32_t>          cache_position(vertex_count, -1);
+        std::vector<float>            vertex_score(vertex_count);
+        for (uint32_t i = 0; i < vertex_count; ++i)
+        {
+            vertex_score[i] = score_table.GetScore(-1, valence[i]);
+        }
+
+        std::vector<float>   triangle_score(triangle_count);
+        std::vector<uint8_t> emitted(triangle_count, 0);
+        uint32_t             best_triangle = 0;
+        for (size_t i = 0; i < triangle_count; ++i)
+        {
+            triangle_score[i] = vertex_score[indices[i * 3]] + vertex_score[indices[i * 3 + 1]] + vertex_score[indices[i * 3 + 2]];
+            if (triangle_score[i] > triangle_score[best_triangle])
+            {
+                best_triangle = (uint32_t) i;
+            }
+        }
+
+        std::vector<uint32_t>                                       output;
+        std::array<uint32_t, VERTEX_CACHE_OPTIMIZER_CACHE_SIZE>     cache;
+        std::array<uint32_t, VERTEX_CACHE_OPTIMIZER_CACHE_SIZE + 3> next_cache;
+        uint32_t                                                    cache_count       = 0;
+        size_t                                                      next_unemitted    = 0;
+        bool                                                        has_best_triangle = true;
+        output.reserve(indices.size());
+        while (has_best_triangle)
+        {
+            emitted[best_triangle]   = 1;
+            const uint32_t* triangle = indices.data() + (size_t) best_triangle * 3;
+            output.insert(output.end(), triangle, triangle + 3);
+            /*
+             * The emitted triangle leaves the remaining triangles of its vertices, and its vertices move to the front of the cache
+             */
+            uint32_t next_cache_count = 0;
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                const uint32_t vertex = triangle[k];
+                auto           first  = adjacency.begin() + adjacency_offset[vertex];
+                auto           last   = first + valence[vertex];
+
+                *std::find(first, last, best_triangle) = *(last - 1);
+                valence[vertex]--;
+                if (std::find(next_cache.begin(), next_cache.begin() + next_cache_count, vertex) == (next_cache.begin() + next_cache_count))
+                {
+                    next_cache[next_cache_count++] = vertex;
+                }
+            }
+
+            for (uint32_t i = 0; i < cache_count; ++i)
+            {
+                if ((cache[i] != triangle[0]) && (cache[i] != triangle[1]) && (cache[i] != triangle[2]))
+                {
+                    next_cache[next_cache_count++] = cache[i];
+                }
+            }
+            /*
+             * Vertices pushed out of the cache are scored again too, then the best candidate is searched among the triangles of the cached vertices
+             */
+            for (uint32_t i = 0; i < next_cache_count; ++i)
+            {
+                const uint32_t vertex  = next_cache[i];
+                cache_position[vertex] = (i < VERTEX_CACHE_OPTIMIZER_CACHE_SIZE) ? (int32_t) i : -1;
+                vertex_score[vertex]   = score_table.GetScore(cache_position[vertex], valence[vertex]);
+            }
+
+            float best_score  = -1.0f;
+            has_best_triangle = false;
+            for (uint32_t i = 0; i < next_cache_count; ++i)
+            {
+                const uint32_t vertex = next_cache[i];
+                for (uint32_t j = adjacency_offset[vertex]; j < adjacency_offset[vertex] + valence[vertex]; ++j)
+                {
+                    const uint32_t  candidate          = adjacency[j];
+                    const uint32_t* candidate_triangle = indices.data() + (size_t) candidate * 3;
+                    triangle_score[candidate]          = vertex_score[candidate_triangle[0]] + vertex_score[candidate_triangle[1]] + vertex_score[candidate_triangle[2]];
+                    if (triangle_score[candidate] > best_score)
+                    {
+                        best_score        = triangle_score[candidate];
+                        best_triangle     = candidate;
+                        has_best_triangle = true;
+                    }
+                }
+            }
+
+            cache_count = std::min<uint32_t>(next_cache_count, VERTEX_CACHE_OPTIMIZER_CACHE_SIZE);
+            std::copy_n(next_cache.begin(), cache_count, cache.begin());
+            /*
+             * No cached vertex has triangles left, the next triangle in input order starts over
+             */
+            if (!has_best_triangle)
+            {
+                while ((next_unemitted < triangle_count) && emitted[next_unemitted])
+                {
+                    next_unemitted++;
+                }
+
+                if (next_unemitted < triangle_count)
+                {
+                    best_triangle     = (uint32_t) next_unemitted;
+                    has_best_triangle = true;
+                }
+            }
+        }
+        indices.swap(output);
+    }
+
+    void OptimizeOverdraw(std::vector<uint32_t>& indices, const float* vertices, uint32_t vertex_count, uint32_t vertex_float_count, float threshold)
+    {
+        const uint32_t triangle_count = (uint32_t) (indices.size() / 3);
+        if (triangle_count == 0)
+        {
+            return;
+        }
+        /*
+         * Hard boundaries are the triangles missing the cache on their three vertices : the cache starts over there anyway
+         */
+        FifoCache             cache(vertex_count, OVERDRAW_CLUSTER_CACHE_SIZE);
+        std::vector<uint32_t> hard_cluster_offsets;
+        std::vector<uint8_t>  triangle_misses(triangle_count);
+        for (uint32_t i = 0; i < triangle_count; ++i)
+        {
+            triangle_misses[i] = cache.Access(indices[i * 3]) + cache.Access(indices[i * 3 + 1]) + cache.Access(indices[i * 3 + 2]);
+            if ((i == 0) || (triangle_misses[i] == 3))
+            {
+                hard_cluster_offsets.push_back(i);
+            }
+        }
+        hard_cluster_offsets.push_back(triangle_count);
+        /*
+         * Soft boundaries split a cluster as soon as the ACMR of the part being built, with a flushed cache, is within the threshold of the cluster ACMR
+         */
+        std::vector<uint32_t> cluster_offsets;
+        for (size_t c = 0; c + 1 < hard_cluster_offsets.size(); ++c)
+        {
+            const uint32_t first_triangle = hard_cluster_offsets[c];
+            const uint32_t last_triangle  = hard_cluster_offsets[c + 1];
+            uint32_t       cluster_misses = 0;
+            for (uint32_t i = first_triangle; i < last_triangle; ++i)
+            {
+                cluster_misses += triangle_misses[i];
+            }
+
+            const float cluster_threshold = threshold * ((float) cluster_misses / (float) (last_triangle - first_triangle));
+            uint32_t    part_misses       = 0;
+            uint32_t    part_triangles    = 0;
+            cache.Flush();
+            cluster_offsets.push_back(first_triangle);
+            for (uint32_t i = first_triangle; i < last_triangle; ++i)
+            {
+                part_misses += cache.Access(indices[i * 3]) + cache.Access(indices[i * 3 + 1]) + cache.Access(indices[i * 3 + 2]);
+                part_triangles++;
+                if (((i + 1) < last_triangle) && (((float) part_misses / (float) part_triangles) <= cluster_threshold))
+                {
+                    cluster_offsets.push_back(i + 1);
+                    part_misses    = 0;
+                    part_triangles = 0;
+                    cache.Flush();
+                }
+            }
+        }
+        cluster_offsets.push_back(triangle_count);
+        /*
+         * Clusters far from the mesh center and facing away from it are likely to occlude the others, they are sorted first
+         */
+        auto get_position = [vertices, vertex_float_count](uint32_t vertex) {
+            const float* position = vertices + (size_t) vertex * vertex_float_count;
+            return glm::vec3(position[0], position[1], position[2]);
+        };
+
+        glm::vec3 mesh_centroid(0.0f);
+        for (uint32_t i = 0; i < vertex_count; ++i)
+        {
+            mesh_centroid += get_position(i);
+        }
+        mesh_centroid /= (float) std::max(vertex_count, 1u);
+
+        const auto         cluster_count = (uint32_t) (cluster_offsets.size() - 1);
+        std::vector<float> cluster_keys(cluster_count);
+        for (uint32_t c = 0; c < cluster_count; ++c)
+        {
+            glm::vec3 centroid(0.0f);
+            glm::vec3 normal(0.0f);
+            float     area = 0.0f;
+            for (uint32_t i = cluster_offsets[c]; i < cluster_offsets[c + 1]; ++i)
+            {
+                const glm::vec3 p0              = get_position(indices[i * 3]);
+                const glm::vec3 p1              = get_position(indices[i * 3 + 1]);
+                const glm::vec3 p2              = get_position(indices[i * 3 + 2]);
+                const glm::vec3 triangle_normal = glm::cross(p1 - p0, p2 - p0);
+                const float     triangle_area   = glm::length(triangle_normal);
+                centroid += (p0 + p1 + p2) * (triangle_area / 3.0f);
+                normal += triangle_normal;
+                area += triangle_area;
+            }
+
+            const float normal_length = glm::length(normal);
+            cluster_keys[c]           = ((area > 0.0f) && (normal_length > 0.0f)) ? glm::dot((centroid / area) - mesh_centroid, normal / normal_length) : 0.0f;
+        }
+
+        std::vector<uint32_t> cluster_order(cluster_count);
+        std::iota(cluster_order.begin(), cluster_order.end(), 0);
+        std::stable_sort(cluster_order.begin(), cluster_order.end(), [&cluster_keys](uint32_t lhs, uint32_t rhs) { return cluster_keys[lhs] > cluster_keys[rhs]; });
+
+        std::vector<uint32_t> output;
+        output.reserve(indices.size());
+        for (uint32_t cluster : cluster_order)
+        {
+            output.insert(output.end(), indices.begin() + (size_t) cluster_offsets[cluster] * 3, indices.begin() + (size_t) cluster_offsets[cluster + 1] * 3);
+        }
+        indices.swap(output);
+    }
+
+    uint32_t OptimizeVertexFetch(std::vector<uint32_t>& indices, std::vector<float>& vertices, uint32_t vertex_float_count)
+    {
+        const auto            vertex_count = (uint32_t) (vertices.size() / vertex_float_count);
+        std::vector<uint32_t> remap(vertex_count, INVALID_VERTEX_INDEX);
+        std::vector<float>    output(vertices.size());
+        uint32_t              output_vertex_count = 0;
+        for (uint32_t& index : indices)
+        {
+            if (remap[index] == INVALID_VERTEX_INDEX)
+            {
+                remap[index] = output_vertex_count++;
+                std::copy_n(vertices.begin() + (size_t) index * vertex_float_count, vertex_float_count, output.begin() + (size_t) remap[index] * vertex_float_count);
+            }
+            index = remap[index];
+        }
+
+        output.resize((size_t) output_vertex_count * vertex_float_count);
+        vertices.swap(output);
+        return output_vertex_count;
+    }
+} // namespace ZEngine::Rendering::Meshes
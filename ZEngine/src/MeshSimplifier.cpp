@@ -0,0 +1,318 @@
+#include <pch.h>
+#include <Rendering/Meshes/MeshSimplifier.h>
+#include <glm/glm.hpp>
+#include <numeric>
+
+#define SIMPLIFIER_MAX_PASS_COUNT 64
+#define SIMPLIFIER_MIN_NORMAL_COSINE 0.25f
+#define SIMPLIFIER_MIN_AREA_RATIO 0.001f
+
+namespace ZEngine::Rendering::Meshes
+{
+    /*
+     * Symmetric 4x4 quadric of the squared distance to a set of planes, weighted by triangle area. Its evaluation is divided by the total
+     * weight, so that the error is a mean squared distance whatever the number of merged planes
+     */
+    struct Quadric
+    {
+        double A00{0.0}, A01{0.0}, A02{0.0}, A03{0.0};
+        double A11{0.0}, A12{0.0}, A13{0.0};
+        double A22{0.0}, A23{0.0};
+        double A33{0.0};
+        double Weight{0.0};
+
+        void AddPlane(const glm::vec3& normal, float distance, float weight)
+        {
+            const double a = normal.x, b = normal.y, c = normal.z, d = distance;
+            A00 += weight * a * a;
+            A01 += weight * a * b;
+            A02 += weight * a * c;
+            A03 += weight * a * d;
+            A11 += weight * b * b;
+            A12 += weight * b * c;
+            A13 += weight * b * d;
+            A22 += weight * c * c;
+            A23 += weight * c * d;
+            A33 += weight * d * d;
+            Weight += weight;
+        }
+
+        void Add(const Quadric& quadric)
+        {
+            A00 += quadric.A00;
+            A01 += quadric.A01;
+            A02 += quadric.A02;
+            A03 += quadric.A03;
+            A11 += quadric.A11;
+            A12 += quadric.A12;
+            A13 += quadric.A13;
+            A22 += quadric.A22;
+            A23 += quadric.A23;
+            A33 += quadric.A33;
+            Weight += quadric.Weight;
+        }
+
+        float Evaluate(const glm::vec3& position) const
+        {
+            const double x = position.x, y = position.y, z = position.z;
+            const double error = (A00 * x * x) + (2.0 * A01 * x * y) + (2.0 * A02 * x * z) + (2.0 * A03 * x) + (A11 * y * y) + (2.0 * A12 * y * z) + (2.0 * A13 * y) +
+                                 (A22 * z * z) + (2.0 * A23 * z) + A33;
+            return (Weight > 0.0) ? (float) std::max(error / Weight, 0.0) : 0.0f;
+        }
+    };
+
+    struct EdgeCollapse
+    {
+        uint32_t Source;
+        uint32_t Target;
+        float    Error;
+    };
+
+    /*
+     * An edge used by a single triangle, in either direction, is on a border. Vertices duplicated along attribute seams (same position,
+     * other normal or texture coordinates) don't share their edges, so seams are borders too
+     */
+    static std::vector<uint8_t> FindLockedVertices(const std::vector<uint32_t>& indices, uint32_t vertex_count)
+    {
+        std::vector<uint64_t> edges;
+        edges.reserve(indices.size());
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                edges.push_back(((uint64_t) indices[i + k] << 32) | indices[i + ((k + 1) % 3)]);
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+
+        std::vector<uint8_t> locked(vertex_count, 0);
+        for (uint64_t edge : edges)
+        {
+            const auto     source  = (uint32_t) (edge >> 32);
+            const auto     target  = (uint32_t) edge;
+            const uint64_t reverse = ((uint64_t) target << 32) | source;
+            if (!std::binary_search(edges.begin(), edges.end(), reverse))
+            {
+                locked[source] = 1;
+                locked[target] = 1;
+            }
+        }
+        return locked;
+    }
+
+    /*
+     * Moving the source onto the target must not turn any remaining triangle of the source over, nor flatten it into a sliver
+     */
+    static bool IsCollapseFlipping(
+        const std::vector<uint32_t>&  indices,
+        const std::vector<uint32_t>&  adjacency,
+        const std::vector<uint32_t>&  adjacency_offset,
+        const std::vector<glm::vec3>& positions,
+        const EdgeCollapse&           collapse)
+    {
+        for (uint32_t j = adjacency_offset[collapse.Source]; j < adjacency_offset[collapse.Source + 1]; ++j)
+        {
+            const uint32_t* triangle = indices.data() + (size_t) adjacency[j] * 3;
+            if ((triangle[0] == collapse.Target) || (triangle[1] == collapse.Target) || (triangle[2] == collapse.Target))
+            {
+                continue;
+            }
+
+            glm::vec3 moved[3];
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                moved[k] = positions[(triangle[k] == collapse.Source) ? collapse.Target : triangle[k]];
+            }
+
+            const glm::vec3 normal       = glm::cross(positions[triangle[1]] - positions[triangle[0]], positions[triangle[2]] - positions[triangle[0]]);
+            const glm::vec3 moved_normal = glm::cross(moved[1] - moved[0], moved[2] - moved[0]);
+            const float     length       = glm::length(normal);
+            const float     moved_length = glm::length(moved_normal);
+            if ((moved_length <= (SIMPLIFIER_MIN_AREA_RATIO * length)) || (glm::dot(normal, moved_normal) < (SIMPLIFIER_MIN_NORMAL_COSINE * length * moved_length)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<uint32_t> SimplifyMesh(
+        const std::vector<uint32_t>& indices,
+        const float*                 vertices,
+        uint32_t                     vertex_count,
+        uint32_t                     vertex_float_count,
+        size_t                       target_index_count,
+        float                        target_error,
+        float*                       result_error)
+    {
+        if (result_error)
+        {
+            *result_error = 0.0f;
+        }
+        /*
+         * Positions are brought into the unit sphere of the mesh bounds, so that errors are relative to its radius
+         */
+        glm::vec3 bound_min(FLT_MAX);
+        glm::vec3 bound_max(-FLT_MAX);
+        for (uint32_t i = 0; i < vertex_count; ++i)
+        {
+            const float*    vertex = vertices + (size_t) i * vertex_float_count;
+            const glm::vec3 position(vertex[0], vertex[1], vertex[2]);
+            bound_min = glm::min(bound_min, position);
+            bound_max = glm::max(bound_max, position);
+        }
+
+        const float radius = (vertex_count > 0) ? (glm::length(bound_max - bound_min) * 0.5f) : 0.0f;
+        if ((radius <= 0.0f) || (indices.size() <= target_index_count))
+        {
+            return indices;
+        }
+
+        const glm::vec3        center = (bound_min + bound_max) * 0.5f;
+        std::vector<glm::vec3> positions(vertex_count);
+        for (uint32_t i = 0; i < vertex_count; ++i)
+        {
+            const float* vertex = vertices + (size_t) i * vertex_float_count;
+            positions[i]        = (glm::vec3(vertex[0], vertex[1], vertex[2]) - center) * (1.0f / radius);
+        }
+
+        std::vector<Quadric> quadrics(vertex_count);
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            const glm::vec3& p0     = positions[indices[i]];
+            const glm::vec3  normal = glm::cross(positions[indices[i + 1]] - p0, positions[indices[i + 2]] - p0);
+            const float      length = glm::length(normal);
+            if (length <= 0.0f)
+            {
+                continue;
+            }
+
+            const glm::vec3 unit_normal = normal / length;
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                quadrics[indices[i + k]].AddPlane(unit_normal, -glm::dot(unit_normal, p0), length * 0.5f);
+            }
+        }
+
+        const std::vector<uint8_t> locked      = FindLockedVertices(indices, vertex_count);
+        const float                error_limit = target_error * target_error;
+        float                      max_error   = 0.0f;
+
+        std::vector<uint32_t>     current = indices;
+        std::vector<uint32_t>     adjacency_offset(vertex_count + 1);
+        std::vector<uint32_t>     adjacency;
+        std::vector<uint32_t>     remap(vertex_count);
+        std::vector<uint8_t>      touched(vertex_count);
+        std::vector<EdgeCollapse> collapses;
+        for (uint32_t pass = 0; (pass < SIMPLIFIER_MAX_PASS_COUNT) && (current.size() > target_index_count); ++pass)
+        {
+            /*
+             * Triangles of each vertex for the flip test
+             */
+            std::fill(adjacency_offset.begin(), adjacency_offset.end(), 0);
+            for (uint32_t index : current)
+            {
+                adjacency_offset[index + 1]++;
+            }
+            std::partial_sum(adjacency_offset.begin(), adjacency_offset.end(), adjacency_offset.begin());
+
+            adjacency.resize(current.size());
+            std::vector<uint32_t> adjacency_fill(adjacency_offset.begin(), adjacency_offset.end() - 1);
+            for (size_t i = 0; i < current.size(); ++i)
+            {
+                adjacency[adjacency_fill[current[i]]++] = (uint32_t) (i / 3);
+            }
+            /*
+             * Every edge can collapse in both directions, the cost of moving the source onto the target is the source quadric at the target.
+             * Interior edges are shared by two triangles and only visited from the one where they go up, border edges have no free vertex
+             */
+            collapses.clear();
+            for (size_t i = 0; i < current.size(); i += 3)
+            {
+                for (uint32_t k = 0; k < 3; ++k)
+                {
+                    const uint32_t a = current[i + k];
+                    const uint32_t b = current[i + ((k + 1) % 3)];
+                    if (a > b)
+                    {
+                        continue;
+                    }
+
+                    const float a_error = locked[a] ? FLT_MAX : quadrics[a].Evaluate(positions[b]);
+                    const float b_error = locked[b] ? FLT_MAX : quadrics[b].Evaluate(positions[a]);
+                    if (a_error <= error_limit)
+                    {
+                        collapses.push_back({.Source = a, .Target = b, .Error = a_error});
+                    }
+                    if (b_error <= error_limit)
+                    {
+                        collapses.push_back({.Source = b, .Target = a, .Error = b_error});
+                    }
+                }
+            }
+            std::sort(collapses.begin(), collapses.end(), [](const EdgeCollapse& lhs, const EdgeCollapse& rhs) { return lhs.Error < rhs.Error; });
+            /*
+             * The cheapest collapses are applied first. A collapse freezes the neighbourhood of its source for the rest of the pass, so that the
+             * flip tests stay valid, and each collapse removes about two triangles
+             */
+            const size_t triangle_count        = current.size() / 3;
+            const size_t target_triangle_count = target_index_count / 3;
+            const size_t collapse_budget       = std::max<size_t>((triangle_count - target_triangle_count) / 2, 1);
+            size_t       collapse_count        = 0;
+            std::iota(remap.begin(), remap.end(), 0);
+            std::fill(touched.begin(), touched.end(), 0);
+            for (const auto& collapse : collapses)
+            {
+                if (collapse_count >= collapse_budget)
+                {
+                    break;
+                }
+
+                if (touched[collapse.Source] || touched[collapse.Target] || IsCollapseFlipping(current, adjacency, adjacency_offset, positions, collapse))
+                {
+                    continue;
+                }
+
+                remap[collapse.Source] = collapse.Target;
+                quadrics[collapse.Target].Add(quadrics[collapse.Source]);
+                max_error = std::max(max_error, collapse.Error);
+                collapse_count++;
+
+                touched[collapse.Target] = 1;
+                for (uint32_t j = adjacency_offset[collapse.Source]; j < adjacency_offset[collapse.Source + 1]; ++j)
+                {
+                    const uint32_t* triangle = current.data() + (size_t) adjacency[j] * 3;
+                    touched[triangle[0]]     = 1;
+                    touched[triangle[1]]     = 1;
+                    touched[triangle[2]]     = 1;
+                }
+            }
+
+            if (collapse_count == 0)
+            {
+                break;
+            }
+
+            size_t write_offset = 0;
+            for (size_t i = 0; i < current.size(); i += 3)
+            {
+                const uint32_t a = remap[current[i]];
+                const uint32_t b = remap[current[i + 1]];
+                const uint32_t c = remap[current[i + 2]];
+                if ((a != b) && (b != c) && (a != c))
+                {
+                    current[write_offset++] = a;
+                    current[write_offset++] = b;
+                    current[write_offset++] = c;
+                }
+            }
+            current.resize(write_offset);
+        }
+
+        if (result_error)
+        {
+            *result_error = std::sqrt(max_error);
+        }
+        return current;
+    }
+} // namespace ZEngine::Rendering::Meshes
@@ -0,0 +1,114 @@
+#include <pch.h>
+#include <Rendering/Meshes/MeshletBuilder.h>
+
+#define MESHLET_MIN_CONE_DOT 0.1f
+
+namespace ZEngine::Rendering::Meshes
+{
+    /*
+     * The sphere is centered on the bounding box of the meshlet vertices. The cone axis is the mean triangle normal, its cutoff the sine of
+     * the widest angle between the axis and a triangle normal : the cone of the normals widened by 90 degrees on each side and inverted
+     * gives the directions every triangle faces away from. Meshlets whose normals spread too much are never back facing
+     */
+    static void ComputeMeshletBounds(Meshlet& meshlet, const uint32_t* indices, const float* vertices, uint32_t vertex_float_count)
+    {
+        auto position = [&](uint32_t index) {
+            const float* vertex = vertices + (size_t) index * vertex_float_count;
+            return glm::vec3(vertex[0], vertex[1], vertex[2]);
+        };
+
+        Helpers::AABB bounds;
+        for (uint32_t i = 0; i < meshlet.IndexCount; ++i)
+        {
+            bounds.Grow(position(indices[meshlet.IndexOffset + i]));
+        }
+
+        meshlet.Center = bounds.GetCenter();
+        meshlet.Radius = 0.0f;
+        for (uint32_t i = 0; i < meshlet.IndexCount; ++i)
+        {
+            meshlet.Radius = std::max(meshlet.Radius, glm::length(position(indices[meshlet.IndexOffset + i]) - meshlet.Center));
+        }
+
+        std::vector<glm::vec3> normals;
+        normals.reserve(meshlet.IndexCount / 3);
+        glm::vec3 normal_sum(0.0f);
+        for (uint32_t i = 0; i < meshlet.IndexCount; i += 3)
+        {
+            const uint32_t* triangle = indices + meshlet.IndexOffset + i;
+            const glm::vec3 p0       = position(triangle[0]);
+            const glm::vec3 normal   = glm::cross(position(triangle[1]) - p0, position(triangle[2]) - p0);
+            const float     length   = glm::length(normal);
+            if (length > 0.0f)
+            {
+                normals.push_back(normal / length);
+                normal_sum += normals.back();
+            }
+        }
+
+        meshlet.ConeAxis   = glm::vec3(0.0f, 0.0f, 1.0f);
+        meshlet.ConeCutoff = 1.0f;
+
+        const float sum_length = glm::length(normal_sum);
+        if (sum_length <= 0.0f)
+        {
+            return;
+        }
+
+        const glm::vec3 axis    = normal_sum / sum_length;
+        float           min_dot = 1.0f;
+        for (const auto& normal : normals)
+        {
+            min_dot = std::min(min_dot, glm::dot(normal, axis));
+        }
+
+        if (min_dot > MESHLET_MIN_CONE_DOT)
+        {
+            meshlet.ConeAxis   = axis;
+            meshlet.ConeCutoff = std::sqrt(1.0f - (min_dot * min_dot));
+        }
+    }
+
+    std::vector<Meshlet> BuildMeshlets(const uint32_t* indices, uint32_t index_count, const float* vertices, uint32_t vertex_count, uint32_t vertex_float_count)
+    {
+        std::vector<Meshlet>  meshlets;
+        std::vector<uint32_t> vertex_meshlet(vertex_count, UINT32_MAX);
+        Meshlet               meshlet = {};
+        for (uint32_t i = 0; (i + 2) < index_count; i += 3)
+        {
+            const uint32_t a = indices[i];
+            const uint32_t b = indices[i + 1];
+            const uint32_t c = indices[i + 2];
+
+            auto new_vertex_count = [&](uint32_t meshlet_index) {
+                return (uint32_t) (vertex_meshlet[a] != meshlet_index) + (uint32_t) ((vertex_meshlet[b] != meshlet_index) && (b != a)) +
+                       (uint32_t) ((vertex_meshlet[c] != meshlet_index) && (c != a) && (c != b));
+            };
+
+            auto meshlet_index = (uint32_t) meshlets.size();
+            if (((meshlet.VertexCount + new_vertex_count(meshlet_index)) > MESHLET_MAX_VERTEX_COUNT) || ((meshlet.IndexCount / 3) == MESHLET_MAX_TRIANGLE_COUNT))
+            {
+                meshlets.push_back(meshlet);
+                meshlet = {.IndexOffset = i};
+                meshlet_index++;
+            }
+
+            meshlet.VertexCount += new_vertex_count(meshlet_index);
+            meshlet.IndexCount += 3;
+            vertex_meshlet[a] = meshlet_index;
+            vertex_meshlet[b] = meshlet_index;
+            vertex_meshlet[c] = meshlet_index;
+        }
+
+        if (meshlet.IndexCount > 0)
+        {
+            meshlets.push_back(meshlet);
+        }
+
+        for (auto& output_meshlet : meshlets)
+        {
+            ComputeMeshletBounds(output_meshlet, indices, vertices, vertex_float_count);
+        }
+        return meshlets;
+    }
+} // namespace ZEngine::Rendering::Meshes
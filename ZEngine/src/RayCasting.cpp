@@ -0,0 +1,386 @@
+#include <pch.h>
+#include <Helpers/RayCasting.h>
+#include <Helpers/ThreadPool.h>
+#include <bit>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define ZENGINE_RAY_CASTING_X86 1
+#include <immintrin.h>
+#else
+#define ZENGINE_RAY_CASTING_X86 0
+#endif
+
+#if ZENGINE_RAY_CASTING_X86 && (defined(__GNUC__) || defined(__clang__))
+#define ZENGINE_TARGET_SSE4 __attribute__((target("sse4.1")))
+#define ZENGINE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define ZENGINE_TARGET_SSE4
+#define ZENGINE_TARGET_AVX2
+#endif
+
+#define RAY_CASTING_INVALID_PRIMITIVE 0xFFFFFFFF
+#define RAY_CASTING_DETERMINANT_EPSILON 1e-12f
+#define RAY_CASTING_LEAF_TRIANGLE_COUNT 8u
+#define RAY_CASTING_TRIANGLE_PADDING 8u
+
+namespace ZEngine::Helpers
+{
+    Ray UnprojectViewportPosition(const glm::vec2& viewport_position, const glm::vec2& viewport_size, const glm::mat4& view, const glm::mat4& projection)
+    {
+        /*
+         * The scene texture is displayed flipped vertically, so the top of the viewport is the top of the view space
+         */
+        const float     ndc_x                   = ((2.0f * viewport_position.x) / viewport_size.x) - 1.0f;
+        const float     ndc_y                   = 1.0f - ((2.0f * viewport_position.y) / viewport_size.y);
+        const glm::mat4 inverse_view_projection = glm::inverse(projection * view);
+
+        glm::vec4 near_point = inverse_view_projection * glm::vec4(ndc_x, ndc_y, 0.0f, 1.0f);
+        glm::vec4 far_point  = inverse_view_projection * glm::vec4(ndc_x, ndc_y, 1.0f, 1.0f);
+        near_point /= near_point.w;
+        far_point /= far_point.w;
+        return {.Origin = glm::vec3(near_point), .Direction = glm::normalize(glm::vec3(far_point - near_point))};
+    }
+
+    bool IntersectRayAABB(const Ray& ray, const glm::vec3& inverse_direction, const AABB& bounds, float max_distance, float& distance)
+    {
+        const glm::vec3 t0    = (bounds.Min - ray.Origin) * inverse_direction;
+        const glm::vec3 t1    = (bounds.Max - ray.Origin) * inverse_direction;
+        const glm::vec3 t_min = glm::min(t0, t1);
+        const glm::vec3 t_max = glm::max(t0, t1);
+        const float     enter = std::max(std::max(t_min.x, t_min.y), std::max(t_min.z, 0.0f));
+        const float     exit  = std::min(std::min(t_max.x, t_max.y), std::min(t_max.z, max_distance));
+
+        distance = enter;
+        return enter <= exit;
+    }
+
+    void TriangleCollection::Resize(uint32_t count)
+    {
+        /*
+         * Padding triangles are zeroed : a null edge gives a null determinant, which never hits
+         */
+        const size_t size = (size_t) count + RAY_CASTING_TRIANGLE_PADDING;
+        for (auto* component : {&V0X, &V0Y, &V0Z, &Edge1X, &Edge1Y, &Edge1Z, &Edge2X, &Edge2Y, &Edge2Z})
+        {
+            component->assign(size, 0.0f);
+        }
+        Count = count;
+    }
+
+    void TriangleCollection::Set(uint32_t index, const glm::vec3& v0, const glm::vec3& v1, const glm::vec3& v2)
+    {
+        const glm::vec3 edge1 = v1 - v0;
+        const glm::vec3 edge2 = v2 - v0;
+        V0X[index]            = v0.x;
+        V0Y[index]            = v0.y;
+        V0Z[index]            = v0.z;
+        Edge1X[index]         = edge1.x;
+        Edge1Y[index]         = edge1.y;
+        Edge1Z[index]         = edge1.z;
+        Edge2X[index]         = edge2.x;
+        Edge2Y[index]         = edge2.y;
+        Edge2Z[index]         = edge2.z;
+    }
+
+    /*
+     * Möller–Trumbore : with p = d x e2 and q = s x e1 (s = o - v0), the barycentrics are u = (s.p) / det and v = (d.q) / det,
+     * the distance t = (e2.q) / det, det being e1.p. Every backend evaluates the same expressions in the same order
+     */
+    static uint32_t IntersectScalar(const Ray& ray, const TriangleCollection& triangles, uint32_t first, uint32_t count, float max_distance, float& distance)
+    {
+        const glm::vec3& origin    = ray.Origin;
+        const glm::vec3& direction = ray.Direction;
+
+        uint32_t closest_triangle = RAY_CASTING_INVALID_PRIMITIVE;
+        float    closest_distance = max_distance;
+        for (uint32_t i = first; i < (first + count); ++i)
+        {
+            const float edge1_x = triangles.Edge1X[i], edge1_y = triangles.Edge1Y[i], edge1_z = triangles.Edge1Z[i];
+            const float edge2_x = triangles.Edge2X[i], edge2_y = triangles.Edge2Y[i], edge2_z = triangles.Edge2Z[i];
+
+            const float p_x = (direction.y * edge2_z) - (direction.z * edge2_y);
+            const float p_y = (direction.z * edge2_x) - (direction.x * edge2_z);
+            const float p_z = (direction.x * edge2_y) - (direction.y * edge2_x);
+            const float det = (edge1_x * p_x) + (edge1_y * p_y) + (edge1_z * p_z);
+            if (std::abs(det) <= RAY_CASTING_DETERMINANT_EPSILON)
+            {
+                continue;
+            }
+
+            const float inverse_det = 1.0f / det;
+            const float s_x         = origin.x - triangles.V0X[i];
+            const float s_y         = origin.y - triangles.V0Y[i];
+            const float s_z         = origin.z - triangles.V0Z[i];
+            const float u           = ((s_x * p_x) + (s_y * p_y) + (s_z * p_z)) * inverse_det;
+
+            const float q_x = (s_y * edge1_z) - (s_z * edge1_y);
+            const float q_y = (s_z * edge1_x) - (s_x * edge1_z);
+            const float q_z = (s_x * edge1_y) - (s_y * edge1_x);
+            const float v   = ((direction.x * q_x) + (direction.y * q_y) + (direction.z * q_z)) * inverse_det;
+            const float t   = ((edge2_x * q_x) + (edge2_y * q_y) + (edge2_z * q_z)) * inverse_det;
+
+            if ((u >= 0.0f) && (v >= 0.0f) && ((u + v) <= 1.0f) && (t >= 0.0f) && (t < closest_distance))
+            {
+                closest_distance = t;
+                closest_triangle = i;
+            }
+        }
+
+        distance = closest_distance;
+        return closest_triangle;
+    }
+
+#if ZENGINE_RAY_CASTING_X86
+    /*
+     * Triangles are already stored one component per array, so 4 triangles are loaded per register without any transposition.
+     * Lanes past the requested count are masked out, reading them is safe thanks to the collection padding
+     */
+    ZENGINE_TARGET_SSE4 static uint32_t IntersectSSE4(const Ray& ray, const TriangleCollection& triangles, uint32_t first, uint32_t count, float max_distance, float& distance)
+    {
+        const __m128  origin_x    = _mm_set1_ps(ray.Origin.x);
+        const __m128  origin_y    = _mm_set1_ps(ray.Origin.y);
+        const __m128  origin_z    = _mm_set1_ps(ray.Origin.z);
+        const __m128  direction_x = _mm_set1_ps(ray.Direction.x);
+        const __m128  direction_y = _mm_set1_ps(ray.Direction.y);
+        const __m128  direction_z = _mm_set1_ps(ray.Direction.z);
+        const __m128  zero        = _mm_setzero_ps();
+        const __m128  one         = _mm_set1_ps(1.0f);
+        const __m128  epsilon     = _mm_set1_ps(RAY_CASTING_DETERMINANT_EPSILON);
+        const __m128  abs_mask    = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        const __m128i lane_index  = _mm_setr_epi32(0, 1, 2, 3);
+
+        uint32_t closest_triangle = RAY_CASTING_INVALID_PRIMITIVE;
+        float    closest_distance = max_distance;
+        for (uint32_t i = first; i < (first + count); i += 4)
+        {
+            const __m128 edge1_x = _mm_loadu_ps(&triangles.Edge1X[i]);
+            const __m128 edge1_y = _mm_loadu_ps(&triangles.Edge1Y[i]);
+            const __m128 edge1_z = _mm_loadu_ps(&triangles.Edge1Z[i]);
+            const __m128 edge2_x = _mm_loadu_ps(&triangles.Edge2X[i]);
+            const __m128 edge2_y = _mm_loadu_ps(&triangles.Edge2Y[i]);
+            const __m128 edge2_z = _mm_loadu_ps(&triangles.Edge2Z[i]);
+
+            const __m128 p_x = _mm_sub_ps(_mm_mul_ps(direction_y, edge2_z), _mm_mul_ps(direction_z, edge2_y));
+            const __m128 p_y = _mm_sub_ps(_mm_mul_ps(direction_z, edge2_x), _mm_mul_ps(direction_x, edge2_z));
+            const __m128 p_z = _mm_sub_ps(_mm_mul_ps(direction_x, edge2_y), _mm_mul_ps(direction_y, edge2_x));
+            const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(edge1_x, p_x), _mm_mul_ps(edge1_y, p_y)), _mm_mul_ps(edge1_z, p_z));
+
+            const __m128 inverse_det = _mm_div_ps(one, det);
+            const __m128 s_x         = _mm_sub_ps(origin_x, _mm_loadu_ps(&triangles.V0X[i]));
+            const __m128 s_y         = _mm_sub_ps(origin_y, _mm_loadu_ps(&triangles.V0Y[i]));
+            const __m128 s_z         = _mm_sub_ps(origin_z, _mm_loadu_ps(&triangles.V0Z[i]));
+            const __m128 u           = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(s_x, p_x), _mm_mul_ps(s_y, p_y)), _mm_mul_ps(s_z, p_z)), inverse_det);
+
+            const __m128 q_x = _mm_sub_ps(_mm_mul_ps(s_y, edge1_z), _mm_mul_ps(s_z, edge1_y));
+            const __m128 q_y = _mm_sub_ps(_mm_mul_ps(s_z, edge1_x), _mm_mul_ps(s_x, edge1_z));
+            const __m128 q_z = _mm_sub_ps(_mm_mul_ps(s_x, edge1_y), _mm_mul_ps(s_y, edge1_x));
+            const __m128 v   = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(direction_x, q_x), _mm_mul_ps(direction_y, q_y)), _mm_mul_ps(direction_z, q_z)), inverse_det);
+            const __m128 t   = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(edge2_x, q_x), _mm_mul_ps(edge2_y, q_y)), _mm_mul_ps(edge2_z, q_z)), inverse_det);
+
+            __m128 hit = _mm_cmpgt_ps(_mm_and_ps(det, abs_mask), epsilon);
+            hit        = _mm_and_ps(hit, _mm_cmpge_ps(u, zero));
+            hit        = _mm_and_ps(hit, _mm_cmpge_ps(v, zero));
+            hit        = _mm_and_ps(hit, _mm_cmple_ps(_mm_add_ps(u, v), one));
+            hit        = _mm_and_ps(hit, _mm_cmpge_ps(t, zero));
+            hit        = _mm_and_ps(hit, _mm_cmplt_ps(t, _mm_set1_ps(closest_distance)));
+            hit        = _mm_and_ps(hit, _mm_castsi128_ps(_mm_cmplt_epi32(lane_index, _mm_set1_epi32((int) (first + count - i)))));
+
+            uint32_t mask = (uint32_t) _mm_movemask_ps(hit);
+            if (mask == 0)
+            {
+                continue;
+            }
+
+            alignas(16) float distances[4];
+            _mm_store_ps(distances, t);
+            for (; mask != 0; mask &= (mask - 1))
+            {
+                const uint32_t lane = (uint32_t) std::countr_zero(mask);
+                if (distances[lane] < closest_distance)
+                {
+                    closest_distance = distances[lane];
+                    closest_triangle = i + lane;
+                }
+            }
+        }
+
+        distance = closest_distance;
+        return closest_triangle;
+    }
+
+    /*
+     * Same as IntersectSSE4 with 8 triangles per register, a whole BVH leaf is tested at once
+     */
+    ZENGINE_TARGET_AVX2 static uint32_t IntersectAVX2(const Ray& ray, const TriangleCollection& triangles, uint32_t first, uint32_t count, float max_distance, float& distance)
+    {
+        const __m256  origin_x    = _mm256_set1_ps(ray.Origin.x);
+        const __m256  origin_y    = _mm256_set1_ps(ray.Origin.y);
+        const __m256  origin_z    = _mm256_set1_ps(ray.Origin.z);
+        const __m256  direction_x = _mm256_set1_ps(ray.Direction.x);
+        const __m256  direction_y = _mm256_set1_ps(ray.Direction.y);
+        const __m256  direction_z = _mm256_set1_ps(ray.Direction.z);
+        const __m256  zero        = _mm256_setzero_ps();
+        const __m256  one         = _mm256_set1_ps(1.0f);
+        const __m256  epsilon     = _mm256_set1_ps(RAY_CASTING_DETERMINANT_EPSILON);
+        const __m256  abs_mask    = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+        const __m256i lane_index  = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+        uint32_t closest_triangle = RAY_CASTING_INVALID_PRIMITIVE;
+        float    closest_distance = max_distance;
+        for (uint32_t i = first; i < (first + count); i += 8)
+        {
+            const __m256 edge1_x = _mm256_loadu_ps(&triangles.Edge1X[i]);
+            const __m256 edge1_y = _mm256_loadu_ps(&triangles.Edge1Y[i]);
+            const __m256 edge1_z = _mm256_loadu_ps(&triangles.Edge1Z[i]);
+            const __m256 edge2_x = _mm256_loadu_ps(&triangles.Edge2X[i]);
+            const __m256 edge2_y = _mm256_loadu_ps(&triangles.Edge2Y[i]);
+            const __m256 edge2_z = _mm256_loadu_ps(&triangles.Edge2Z[i]);
+
+            const __m256 p_x = _mm256_sub_ps(_mm256_mul_ps(direction_y, edge2_z), _mm256_mul_ps(direction_z, edge2_y));
+            const __m256 p_y = _mm256_sub_ps(_mm256_mul_ps(direction_z, edge2_x), _mm256_mul_ps(direction_x, edge2_z));
+            const __m256 p_z = _mm256_sub_ps(_mm256_mul_ps(direction_x, edge2_y), _mm256_mul_ps(direction_y, edge2_x));
+            const __m256 det = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(edge1_x, p_x), _mm256_mul_ps(edge1_y, p_y)), _mm256_mul_ps(edge1_z, p_z));
+
+            const __m256 inverse_det = _mm256_div_ps(one, det);
+            const __m256 s_x         = _mm256_sub_ps(origin_x, _mm256_loadu_ps(&triangles.V0X[i]));
+            const __m256 s_y         = _mm256_sub_ps(origin_y, _mm256_loadu_ps(&triangles.V0Y[i]));
+            const __m256 s_z         = _mm256_sub_ps(origin_z, _mm256_loadu_ps(&triangles.V0Z[i]));
+            const __m256 u           = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(s_x, p_x), _mm256_mul_ps(s_y, p_y)), _mm256_mul_ps(s_z, p_z)), inverse_det);
+
+            const __m256 q_x = _mm256_sub_ps(_mm256_mul_ps(s_y, edge1_z), _mm256_mul_ps(s_z, edge1_y));
+            const __m256 q_y = _mm256_sub_ps(_mm256_mul_ps(s_z, edge1_x), _mm256_mul_ps(s_x, edge1_z));
+            const __m256 q_z = _mm256_sub_ps(_mm256_mul_ps(s_x, edge1_y), _mm256_mul_ps(s_y, edge1_x));
+            const __m256 v   = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(direction_x, q_x), _mm256_mul_ps(direction_y, q_y)), _mm256_mul_ps(direction_z, q_z)), inverse_det);
+            const __m256 t   = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(edge2_x, q_x), _mm256_mul_ps(edge2_y, q_y)), _mm256_mul_ps(edge2_z, q_z)), inverse_det);
+
+            __m256 hit = _mm256_cmp_ps(_mm256_and_ps(det, abs_mask), epsilon, _CMP_GT_OQ);
+            hit        = _mm256_and_ps(hit, _mm256_cmp_ps(u, zero, _CMP_GE_OQ));
+            hit        = _mm256_and_ps(hit, _mm256_cmp_ps(v, zero, _CMP_GE_OQ));
+            hit        = _mm256_and_ps(hit, _mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_LE_OQ));
+            hit        = _mm256_and_ps(hit, _mm256_cmp_ps(t, zero, _CMP_GE_OQ));
+            hit        = _mm256_and_ps(hit, _mm256_cmp_ps(t, _mm256_set1_ps(closest_distance), _CMP_LT_OQ));
+            hit        = _mm256_and_ps(hit, _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32((int) (first + count - i)), lane_index)));
+
+            uint32_t mask = (uint32_t) _mm256_movemask_ps(hit);
+            if (mask == 0)
+            {
+                continue;
+            }
+
+            alignas(32) float distances[8];
+            _mm256_store_ps(distances, t);
+            for (; mask != 0; mask &= (mask - 1))
+            {
+                const uint32_t lane = (uint32_t) std::countr_zero(mask);
+                if (distances[lane] < closest_distance)
+                {
+                    closest_distance = distances[lane];
+                    closest_triangle = i + lane;
+                }
+            }
+        }
+
+        distance = closest_distance;
+        return closest_triangle;
+    }
+#endif
+
+    uint32_t IntersectRayTriangleBatch(const Ray& ray, const TriangleCollection& triangles, uint32_t first, uint32_t count, float max_distance, float& distance)
+    {
+        return IntersectRayTriangleBatch(GetSimdBackend(), ray, triangles, first, count, max_distance, distance);
+    }
+
+    uint32_t IntersectRayTriangleBatch(
+        SimdBackend               backend,
+        const Ray&                ray,
+        const TriangleCollection& triangles,
+        uint32_t                  first,
+        uint32_t                  count,
+        float                     max_distance,
+        float&                    distance)
+    {
+        switch (backend)
+        {
+#if ZENGINE_RAY_CASTING_X86
+            case SimdBackend::AVX2:
+                return IntersectAVX2(ray, triangles, first, count, max_distance, distance);
+            case SimdBackend::SSE4:
+                return IntersectSSE4(ray, triangles, first, count, max_distance, distance);
+#endif
+            default:
+                return IntersectScalar(ray, triangles, first, count, max_distance, distance);
+        }
+    }
+
+    void TriangleBoundingVolumeHierarchy::Build(const float* positions, uint32_t vertex_stride, const uint32_t* indices, uint32_t index_count)
+    {
+        const uint32_t triangle_count = index_count / 3;
+        auto           position       = [positions, vertex_stride](uint32_t vertex) {
+            const float* component = positions + (size_t) vertex * vertex_stride;
+            return glm::vec3(component[0], component[1], component[2]);
+        };
+
+        std::vector<AABB> triangle_bounds(triangle_count);
+        ThreadPoolHelper::ParallelFor(triangle_count, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t triangle = begin; triangle < end; ++triangle)
+            {
+                AABB& bounds = triangle_bounds[triangle];
+                bounds.Grow(position(indices[3 * triangle]));
+                bounds.Grow(position(indices[3 * triangle + 1]));
+                bounds.Grow(position(indices[3 * triangle + 2]));
+            }
+        });
+        m_hierarchy.Build(triangle_bounds.data(), triangle_count, RAY_CASTING_LEAF_TRIANGLE_COUNT);
+        /*
+         * Triangles are stored in leaf order, a leaf is then a contiguous range of the collection
+         */
+        const auto& primitive_index_collection = m_hierarchy.GetPrimitiveIndices();
+        m_triangle_collection.Resize(triangle_count);
+        ThreadPoolHelper::ParallelFor(triangle_count, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                const uint32_t triangle = primitive_index_collection[i];
+                m_triangle_collection.Set(i, position(indices[3 * triangle]), position(indices[3 * triangle + 1]), position(indices[3 * triangle + 2]));
+            }
+        });
+    }
+
+    bool TriangleBoundingVolumeHierarchy::Raycast(const Ray& ray, float max_distance, RayHit& hit) const
+    {
+        return Raycast(GetSimdBackend(), ray, max_distance, hit);
+    }
+
+    bool TriangleBoundingVolumeHierarchy::Raycast(SimdBackend backend, const Ray& ray, float max_distance, RayHit& hit) const
+    {
+        uint32_t closest_triangle = RAY_CASTING_INVALID_PRIMITIVE;
+        float    closest_distance = max_distance;
+        TraverseRay(m_hierarchy, ray, closest_distance, [&](uint32_t first, uint32_t count) {
+            float    distance = 0.0f;
+            uint32_t triangle = IntersectRayTriangleBatch(backend, ray, m_triangle_collection, first, count, closest_distance, distance);
+            if (triangle != RAY_CASTING_INVALID_PRIMITIVE)
+            {
+                closest_distance = distance;
+                closest_triangle = triangle;
+            }
+        });
+
+        if (closest_triangle == RAY_CASTING_INVALID_PRIMITIVE)
+        {
+            return false;
+        }
+
+        hit.Primitive = m_hierarchy.GetPrimitiveIndices()[closest_triangle];
+        hit.Distance  = closest_distance;
+        return true;
+    }
+
+    uint32_t TriangleBoundingVolumeHierarchy::GetTriangleCount() const
+    {
+        return m_triangle_collection.Count;
+    }
+
+    const AABB& TriangleBoundingVolumeHierarchy::GetBounds() const
+    {
+        return m_hierarchy.GetBounds();
+    }
+} // namespace ZEngine::Helpers
@@ -14,7 +14,14 @@ namespace ZEngine::Rendering::Renderers::RenderPasses
 
     void RenderPass::Dispose()
     {
-        m_pipeline->Dispose();
+        if (m_pipeline)
+        {
+            m_pipeline->Dispose();
+        }
+        if (m_compute_pipeline)
+        {
+            m_compute_pipeline->Dispose();
+        }
     }
 
     Ref<Pipelines::GraphicPipeline> RenderPass::GetPipeline() const
@@ -22,8 +29,38 @@ namespace ZEngine::Rendering::Renderers::RenderPasses
         return m_pipeline;
     }
 
+    Ref<Pipelines::ComputePipeline> RenderPass::GetComputePipeline() const
+    {
+        return m_compute_pipeline;
+    }
+
+    Ref<Shaders::Shader> RenderPass::GetShader() const
+    {
+        return m_compute_pipeline ? m_compute_pipeline->GetShader() : m_pipeline->GetShader();
+    }
+
+    VkPipelineLayout RenderPass::GetPipelineLayout() const
+    {
+        return m_compute_pipeline ? m_compute_pipeline->GetPipelineLayout() : m_pipeline->GetPipelineLayout();
+    }
+
+    VkPipelineBindPoint RenderPass::GetPipelineBindPoint() const
+    {
+        return m_compute_pipeline ? VK_PIPELINE_BIND_POINT_COMPUTE : VK_PIPELINE_BIND_POINT_GRAPHICS;
+    }
+
+    bool RenderPass::IsCompute() const
+    {
+        return static_cast<bool>(m_compute_pipeline);
+    }
+
     void RenderPass::Bake()
     {
+        if (m_compute_pipeline)
+        {
+            m_compute_pipeline->Bake();
+            return;
+        }
         m_pipeline->Bake();
     }
 
@@ -40,7 +77,7 @@ namespace ZEngine::Rendering::Renderers::RenderPasses
         }
 
         const uint32_t                    frame_count                     = Engine::GetWindow()->GetSwapchain()->GetImageCount();
-        const auto&                       shader                          = m_pipeline->GetShader();
+        const auto                        shader                          = GetShader();
         const auto&                       descriptor_set_map              = shader->GetDescriptorSetMap();
         std::vector<VkWriteDescriptorSet> write_descriptor_set_collection = {};
         for (const auto& input : m_input_collection)
@@ -369,15 +406,16 @@ namespace ZEngine::Rendering::Renderers::RenderPasses
 
     Ref<RenderPass> RenderPass::Create(const RenderPassSpecification& specification)
     {
-        Ref<RenderPass> render_pass = CreateRef<RenderPass>();
-        render_pass->m_pipeline     = specification.Pipeline;
+        Ref<RenderPass> render_pass     = CreateRef<RenderPass>();
+        render_pass->m_pipeline         = specification.Pipeline;
+        render_pass->m_compute_pipeline = specification.ComputePipeline;
         return render_pass;
     }
 
     std::pair<bool, Specifications::LayoutBindingSpecification> RenderPass::ValidateInput(std::string_view key)
     {
         bool        valid{true};
-        const auto& shader       = m_pipeline->GetShader();
+        const auto  shader       = GetShader();
         auto        binding_spec = shader->GetLayoutBindingSpecification(key);
         if ((binding_spec.Set == 0xFFFFFFFF) && (binding_spec.Binding == 0xFFFFFFFF))
         {
@@ -255,4 +255,78 @@ namespace ZEngine::Rendering::Renderers::Pipelines
         auto pipeline = CreateRef<GraphicPipeline>(std::move(spec));
         return pipeline;
     }
+
+    ComputePipeline::ComputePipeline(Specifications::ComputePipelineSpecification&& spec) : m_pipeline_specification(std::move(spec))
+    {
+        m_shader = Shaders::Shader::Create(m_pipeline_specification.ShaderSpecification);
+    }
+
+    Specifications::ComputePipelineSpecification& ComputePipeline::GetSpecification()
+    {
+        return m_pipeline_specification;
+    }
+
+    void ComputePipeline::Bake()
+    {
+        auto device = Hardwares::VulkanDevice::GetNativeDeviceHandle();
+        /*
+         * Pipeline layout
+         */
+        const auto                 descriptor_set_layout_collection = m_shader->GetDescriptorSetLayout();
+        const auto&                push_constant_collection         = m_shader->GetPushConstants();
+        VkPipelineLayoutCreateInfo pipeline_layout_create_info      = {};
+        pipeline_layout_create_info.sType                           = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipeline_layout_create_info.setLayoutCount                  = descriptor_set_layout_collection.size();
+        pipeline_layout_create_info.pSetLayouts                     = descriptor_set_layout_collection.data();
+        pipeline_layout_create_info.pushConstantRangeCount          = push_constant_collection.size();
+        pipeline_layout_create_info.pPushConstantRanges             = push_constant_collection.data();
+        pipeline_layout_create_info.flags                           = 0;
+        pipeline_layout_create_info.pNext                           = nullptr;
+        ZENGINE_VALIDATE_ASSERT(vkCreatePipelineLayout(device, &(pipeline_layout_create_info), nullptr, &m_pipeline_layout) == VK_SUCCESS, "Failed to create pipeline layout")
+        /*
+         * Compute Pipeline Creation
+         */
+        const auto&                 shader_create_info_collection = m_shader->GetStageCreateInfoCollection();
+        VkComputePipelineCreateInfo compute_pipeline_create_info  = {};
+        compute_pipeline_create_info.sType                        = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        compute_pipeline_create_info.stage                        = shader_create_info_collection.at(0);
+        compute_pipeline_create_info.layout                       = m_pipeline_layout;
+        compute_pipeline_create_info.basePipelineHandle           = VK_NULL_HANDLE;
+        compute_pipeline_create_info.basePipelineIndex            = -1;
+        compute_pipeline_create_info.flags                        = 0;
+        compute_pipeline_create_info.pNext                        = nullptr;
+        ZENGINE_VALIDATE_ASSERT(
+            vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &compute_pipeline_create_info, nullptr, &m_pipeline_handle) == VK_SUCCESS, "Failed to create Compute Pipeline")
+    }
+
+    void ComputePipeline::Dispose()
+    {
+        m_shader->Dispose();
+
+        Hardwares::VulkanDevice::EnqueueForDeletion(Rendering::DeviceResourceType::PIPELINE_LAYOUT, m_pipeline_layout);
+        Hardwares::VulkanDevice::EnqueueForDeletion(Rendering::DeviceResourceType::PIPELINE, m_pipeline_handle);
+        m_pipeline_layout = VK_NULL_HANDLE;
+        m_pipeline_handle = VK_NULL_HANDLE;
+    }
+
+    VkPipeline ComputePipeline::GetHandle() const
+    {
+        return m_pipeline_handle;
+    }
+
+    VkPipelineLayout ComputePipeline::GetPipelineLayout() const
+    {
+        return m_pipeline_layout;
+    }
+
+    Ref<Shaders::Shader> ComputePipeline::GetShader() const
+    {
+        return m_shader;
+    }
+
+    Ref<ComputePipeline> ComputePipeline::Create(Specifications::ComputePipelineSpecification& spec)
+    {
+        auto pipeline = CreateRef<ComputePipeline>(std::move(spec));
+        return pipeline;
+    }
 } // namespace ZEngine::Rendering::Renderers::Pipelines
\ No newline at end of file
@@ -1,8 +1,15 @@
 #include <pch.h>
 #include <Rendering/Renderers/Contracts/RendererDataContract.h>
 #include <Rendering/Renderers/SceneRenderer.h>
+#include <Rendering/Meshes/MeshletBuilder.h>
 #include <Rendering/Renderers/GraphicRenderer.h>
 #include <Rendering/Specifications/GraphicRendererPipelineSpecification.h>
+#include <Hardwares/VulkanDevice.h>
+#include <Helpers/ThreadPool.h>
+
+#define SCENE_CULLING_CHUNK_SIZE 1024u
+#define SCENE_GPU_CULLING_GROUP_SIZE 64u
+#define SCENE_LOD_PIXEL_ERROR 1.0f
 
 using namespace ZEngine::Rendering::Specifications;
 
@@ -13,8 +20,9 @@ namespace ZEngine::Rendering::Renderers
         const auto& renderer_info = Renderers::GraphicRenderer::GetRendererInformation();
 
         m_upload_once_per_frame_count = renderer_info.FrameCount;
-        m_last_drawn_vertices_count.resize(renderer_info.FrameCount, 0);
-        m_last_drawn_index_count.resize(renderer_info.FrameCount, 0);
+        m_last_uploaded_geometry.resize(renderer_info.FrameCount);
+        m_last_uploaded_materials.resize(renderer_info.FrameCount);
+        m_visible_draw_capacity.resize(renderer_info.FrameCount, 0);
 
         /*
          * Render Passes definition
@@ -133,6 +141,15 @@ namespace ZEngine::Rendering::Renderers
 
         m_final_color_output_pass->Dispose();
 
+        if (m_culling_pass)
+        {
+            m_culling_pass->Dispose();
+            m_SBMeshBound->Dispose();
+            m_SBMeshLod->Dispose();
+            m_SBIndirectCommand->Dispose();
+            m_SBIndirectCount->Dispose();
+        }
+
         m_SBVertex->Dispose();
         m_SBIndex->Dispose();
         m_SBDrawData->Dispose();
@@ -152,6 +169,14 @@ namespace ZEngine::Rendering::Renderers
         m_camera_position   = camera_position;
         m_camera_view       = camera_view;
         m_camera_projection = camera_projection;
+        m_camera_frustum    = Helpers::ExtractFrustum(camera_projection * camera_view);
+        /*
+         * A perspective projection maps a size s at distance d to s * Projection[1][1] * height / (2 * d) pixels. Orthographic
+         * projections don't shrink distant meshes, they keep the full meshes
+         */
+        const bool  is_perspective = (camera_projection[3][3] == 0.0f);
+        const float lod_scale      = is_perspective ? (camera_projection[1][1] * (float) m_viewport_height * 0.5f / SCENE_LOD_PIXEL_ERROR) : 0.0f;
+        m_lod_camera               = glm::vec4(glm::vec3(camera_position), lod_scale);
     }
 
     void SceneRenderer::StartScene(Buffers::CommandBuffer* const command_buffer)
@@ -164,7 +189,7 @@ namespace ZEngine::Rendering::Renderers
         this->StartScene(glm::vec4(camera_position, 1.0f), camera_view, camera_projection);
     }
 
-    void SceneRenderer::RenderScene(const Ref<Rendering::Scenes::SceneRawData>& scene_data, uint32_t current_frame_index)
+    void SceneRenderer::RenderScene(const Ref<Rendering::Scenes::SceneSnapshot>& scene_snapshot, uint32_t current_frame_index)
     {
         if (m_upload_once_per_frame_count > 0)
         {
@@ -202,108 +227,582 @@ namespace ZEngine::Rendering::Renderers
             --m_upload_once_per_frame_count;
         }
 
-        const auto& sceneNodeMeshMap = scene_data->SceneNodeMeshMap;
         /*
-         * Composing Transform Data
+         * The snapshot is immutable, so it is read without holding the scene lock
          */
-        std::vector<glm::mat4> tranform_collection = {};
-        for (const auto& sceneNodeMeshPair : sceneNodeMeshMap)
+        const auto& scene_geometry   = *(scene_snapshot->Geometry);
+        const bool  geometry_changed = (m_last_uploaded_geometry[current_frame_index] != scene_snapshot->Geometry);
+
+        if (m_culling_mode == SceneCullingMode::GPU)
         {
-            tranform_collection.push_back(scene_data->GlobalTransformCollection[sceneNodeMeshPair.first]);
+            /*
+             * Every mesh is uploaded, the culling pass recorded in EndScene() compacts the visible ones on the GPU
+             */
+            __PrepareGpuCulling(*scene_snapshot, current_frame_index, geometry_changed);
         }
-        auto& transform_storage = *m_SBTransform;
-        transform_storage[current_frame_index].SetData(tranform_collection);
+        else
+        {
+            /*
+             * Culling against the camera frustum, only visible meshes get their draw data, transform and indirect command uploaded.
+             * Orthographic views have no eye position to test the meshlet cones against, only their spheres are culled
+             */
+            CullSceneSnapshot(*scene_snapshot, m_camera_frustum, m_lod_camera, m_meshlet_cone_culling && (m_lod_camera.w > 0.0f), m_culling_state);
+
+            auto& transform_storage = *m_SBTransform;
+            auto& draw_data_storage = *m_SBDrawData;
+            transform_storage[current_frame_index].SetData(m_culling_state.TransformCollection);
+            draw_data_storage[current_frame_index].SetData(m_culling_state.DrawDataCollection);
+            m_indirect_buffer[current_frame_index]->SetData(m_culling_state.IndirectCommandCollection);
+
+            const uint32_t visible_count = (uint32_t) m_culling_state.DrawDataCollection.size();
+            if (visible_count > m_visible_draw_capacity[current_frame_index])
+            {
+                m_visible_draw_capacity[current_frame_index] = visible_count;
+                m_final_color_output_pass->MarkDirty();
+            }
+        }
+
+        /*
+         * Scenes Textures : each material snapshot publishes its own immutable texture list
+         */
+        if (m_last_uploaded_texture_collection != scene_snapshot->Materials->TextureCollection)
+        {
+            m_final_color_output_pass->SetInput("TextureArray", scene_snapshot->Materials->TextureCollection);
+            m_last_uploaded_texture_collection = scene_snapshot->Materials->TextureCollection;
 
+            m_final_color_output_pass->MarkDirty();
+        }
         /*
-         * Scenes Textures
+         * Material palette : uploaded on its own, draws only carry the palette index of their mesh
          */
-        if (m_last_uploaded_buffer_image_count != scene_data->TextureCollection->Size())
+        if (m_last_uploaded_materials[current_frame_index] != scene_snapshot->Materials)
         {
-            auto& scene_textures_collection = scene_data->TextureCollection;
-            m_final_color_output_pass->SetInput("TextureArray", scene_textures_collection);
-            m_last_uploaded_buffer_image_count = scene_textures_collection->Size();
+            auto& material_data_storage = *m_SBMaterialData;
+            material_data_storage[current_frame_index].SetData(scene_snapshot->Materials->MaterialCollection);
+            m_last_uploaded_materials[current_frame_index] = scene_snapshot->Materials;
 
             m_final_color_output_pass->MarkDirty();
         }
         /*
-         * Scene Draw data
+         * Scene Draw data : a new geometry piece means the geometry changed or another scene got activated
          */
-        if ((m_last_drawn_vertices_count[current_frame_index] == scene_data->Vertices.size()) || (m_last_drawn_index_count[current_frame_index] == scene_data->Indices.size()))
+        if (!geometry_changed)
         {
             return;
         }
 
-        std::vector<DrawData>             draw_data_collection = {};
-        std::vector<Meshes::MeshMaterial> material_collection  = {};
+        /*
+         * Uploading Geometry data : when the geometry last uploaded for this frame starts with the same blocks (e.g an asset streaming in),
+         * only the blocks that follow are written
+         */
+        const auto* last_geometry = m_last_uploaded_geometry[current_frame_index].get();
+        uint32_t    first_block   = 0;
+        if (last_geometry && (last_geometry->BufferRevision == scene_geometry.BufferRevision) && (last_geometry->BlockCollection.size() <= scene_geometry.BlockCollection.size()) &&
+            std::equal(last_geometry->BlockCollection.begin(), last_geometry->BlockCollection.end(), scene_geometry.BlockCollection.begin()))
+        {
+            first_block = (uint32_t) last_geometry->BlockCollection.size();
+        }
 
-        uint32_t data_index = 0;
-        for (const auto& sceneNodeMeshPair : sceneNodeMeshMap)
+        auto&        vertex_buffer    = (*m_SBVertex)[current_frame_index];
+        auto&        index_buffer     = (*m_SBIndex)[current_frame_index];
+        const size_t vertex_byte_size = (size_t) scene_geometry.VertexFloatCount * sizeof(float);
+        const size_t index_byte_size  = (size_t) scene_geometry.IndexCount * sizeof(uint32_t);
+        if ((vertex_buffer.GetByteSize() < vertex_byte_size) || (index_buffer.GetByteSize() < index_byte_size))
         {
             /*
-             * Composing DrawData
+             * A reallocated buffer loses its content, every block is written again. Buffers grow by half of their size so that a streaming
+             * asset doesn't reallocate them on every chunk
              */
-            DrawData& draw_data      = draw_data_collection.emplace_back(DrawData{.Index = data_index});
-            draw_data.TransformIndex = data_index;
-            draw_data.VertexOffset   = sceneNodeMeshPair.second.VertexOffset;
-            draw_data.IndexOffset    = sceneNodeMeshPair.second.IndexOffset;
-            draw_data.VertexCount    = sceneNodeMeshPair.second.VertexCount;
-            draw_data.IndexCount     = sceneNodeMeshPair.second.IndexCount;
+            vertex_buffer.Reserve(vertex_byte_size + (vertex_byte_size / 2));
+            index_buffer.Reserve(index_byte_size + (index_byte_size / 2));
+            first_block = 0;
             /*
-             * Material data
+             * Mark RenderPass dirty and should re-upadte inputs
              */
-            material_collection.push_back(scene_data->SceneNodeMaterialMap[sceneNodeMeshPair.first]);
-            draw_data.MaterialIndex = material_collection.size() - 1;
+            m_final_color_output_pass->MarkDirty();
+        }
 
-            data_index++;
+        for (uint32_t i = first_block; i < scene_geometry.BlockCollection.size(); ++i)
+        {
+            const auto& block = *(scene_geometry.BlockCollection[i]);
+            vertex_buffer.WriteData(block.Vertices.data(), (size_t) block.VertexOffset * sizeof(float), block.Vertices.size() * sizeof(float));
+            index_buffer.WriteData(block.Indices.data(), (size_t) block.IndexOffset * sizeof(uint32_t), block.Indices.size() * sizeof(uint32_t));
         }
         /*
-         * Uploading Geometry data
+         * Caching last uploaded geometry per frame
          */
-        auto& vertex_storage = *m_SBVertex;
-        auto& index_storage  = *m_SBIndex;
-        vertex_storage[current_frame_index].SetData(scene_data->Vertices);
-        index_storage[current_frame_index].SetData(scene_data->Indices);
+        m_last_uploaded_geometry[current_frame_index] = scene_snapshot->Geometry;
+    }
+
+    void SceneRenderer::__InitializeGpuCulling()
+    {
+        const auto& renderer_info = Renderers::GraphicRenderer::GetRendererInformation();
+
+        m_SBMeshBound       = CreateRef<Buffers::StorageBufferSet>(renderer_info.FrameCount);
+        m_SBMeshLod         = CreateRef<Buffers::StorageBufferSet>(renderer_info.FrameCount);
+        m_SBIndirectCommand = CreateRef<Buffers::StorageBufferSet>(renderer_info.FrameCount, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT);
+        m_SBIndirectCount   = CreateRef<Buffers::StorageBufferSet>(renderer_info.FrameCount, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT);
+        m_gpu_culling_reference_collection.resize(renderer_info.FrameCount);
+        m_gpu_culling_pending_validation.resize(renderer_info.FrameCount, 0);
+
+        Specifications::ComputePipelineSpecification culling_pipeline_spec = {};
+        culling_pipeline_spec.DebugName                                    = "Scene-Culling-Pipeline";
+        culling_pipeline_spec.ShaderSpecification                          = {.ComputeFilename = "Shaders/Cache/scene_culling_compute.spv"};
+        RenderPasses::RenderPassSpecification culling_pass_spec            = {};
+        culling_pass_spec.DebugName                                        = "Scene-Culling";
+        culling_pass_spec.ComputePipeline                                  = Pipelines::ComputePipeline::Create(culling_pipeline_spec);
+        m_culling_pass                                                     = RenderPasses::RenderPass::Create(culling_pass_spec);
+
+        m_culling_pass->SetInput("DrawDataSB", m_SBDrawData);
+        m_culling_pass->SetInput("TransformSB", m_SBTransform);
+        m_culling_pass->SetInput("MeshBoundSB", m_SBMeshBound);
+        m_culling_pass->SetInput("MeshLodSB", m_SBMeshLod);
+        m_culling_pass->SetInput("IndirectCommandSB", m_SBIndirectCommand);
+        m_culling_pass->SetInput("IndirectCountSB", m_SBIndirectCount);
+        m_culling_pass->Verify();
+        m_culling_pass->Bake();
+    }
+
+    void SceneRenderer::SetCullingMode(SceneCullingMode mode)
+    {
+        if (mode == m_culling_mode)
+        {
+            return;
+        }
+
+        if ((mode == SceneCullingMode::GPU) && !Hardwares::VulkanDevice::IsDrawIndirectCountSupported())
+        {
+            ZENGINE_CORE_ERROR("GPU culling requires vkCmdDrawIndirectCount, keeping CPU culling")
+            return;
+        }
+
+        if ((mode == SceneCullingMode::GPU) && !m_culling_pass)
+        {
+            __InitializeGpuCulling();
+        }
         /*
-         * Uploading Drawing data
+         * Both modes lay out the draw data and transforms differently, everything is uploaded again
          */
-        auto& draw_data_storage = *m_SBDrawData;
-        draw_data_storage[current_frame_index].SetData(draw_data_collection);
+        m_culling_mode = mode;
+        std::fill(m_last_uploaded_geometry.begin(), m_last_uploaded_geometry.end(), nullptr);
+        std::fill(m_visible_draw_capacity.begin(), m_visible_draw_capacity.end(), 0);
+        std::fill(m_gpu_culling_pending_validation.begin(), m_gpu_culling_pending_validation.end(), 0);
+    }
+
+    SceneCullingMode SceneRenderer::GetCullingMode() const
+    {
+        return m_culling_mode;
+    }
+
+    void SceneRenderer::SetMeshletConeCulling(bool enabled)
+    {
+        m_meshlet_cone_culling = enabled;
+    }
+
+    void SceneRenderer::__PrepareGpuCulling(const Scenes::SceneSnapshot& scene_snapshot, uint32_t current_frame_index, bool geometry_changed)
+    {
+#ifdef ENABLE_GPU_CULLING_VALIDATION
+        __ValidateGpuCulling(current_frame_index);
+#endif
+        const auto&    mesh_collection = scene_snapshot.Geometry->MeshCollection;
+        const uint32_t mesh_count      = (uint32_t) mesh_collection.size();
+
+        auto& transform_storage = *m_SBTransform;
+        transform_storage[current_frame_index].SetData(scene_snapshot.MeshTransformCollection);
+
+        std::copy(std::begin(m_camera_frustum.Planes), std::end(m_camera_frustum.Planes), std::begin(m_gpu_culling_constants.Planes));
+        m_gpu_culling_constants.LodCamera = m_lod_camera;
+        m_gpu_culling_constants.DrawCount = mesh_count;
+
+        if (geometry_changed)
+        {
+            m_mesh_draw_data_collection.resize(mesh_count);
+            m_mesh_local_bound_collection.resize(mesh_count);
+            m_mesh_lod_collection.resize(mesh_count);
+            for (uint32_t mesh_slot = 0; mesh_slot < mesh_count; ++mesh_slot)
+            {
+                const auto& mesh         = mesh_collection[mesh_slot];
+                DrawData&   draw_data    = m_mesh_draw_data_collection[mesh_slot];
+                draw_data.Index          = mesh_slot;
+                draw_data.TransformIndex = mesh_slot;
+                draw_data.MaterialIndex  = scene_snapshot.Geometry->MeshMaterialIndexCollection[mesh_slot];
+                draw_data.VertexOffset   = mesh.VertexOffset;
+                draw_data.IndexOffset    = mesh.IndexOffset;
+                draw_data.VertexCount    = mesh.VertexCount;
+                draw_data.IndexCount     = mesh.IndexCount;
+                draw_data.VertexFormat   = (uint32_t) mesh.Format;
+                draw_data.IndexFormat    = (uint32_t) mesh.IndexType;
+                draw_data.PositionOffset = mesh.LocalBounds.Min;
+                draw_data.PositionScale  = mesh.LocalBounds.Max - mesh.LocalBounds.Min;
+
+                m_mesh_local_bound_collection[mesh_slot] = mesh.LocalBounds;
+                m_mesh_lod_collection[mesh_slot]         = mesh.Lods;
+            }
+
+            auto& draw_data_storage        = *m_SBDrawData;
+            auto& mesh_bound_storage       = *m_SBMeshBound;
+            auto& mesh_lod_storage         = *m_SBMeshLod;
+            auto& indirect_command_storage = *m_SBIndirectCommand;
+            auto& indirect_count_storage   = *m_SBIndirectCount;
+            draw_data_storage[current_frame_index].SetData(m_mesh_draw_data_collection);
+            mesh_bound_storage[current_frame_index].SetData(m_mesh_local_bound_collection);
+            mesh_lod_storage[current_frame_index].SetData(m_mesh_lod_collection);
+            /*
+             * The culling pass writes the output buffers every frame, they only need to be large enough
+             */
+            indirect_command_storage[current_frame_index].SetData(nullptr, 0, mesh_count * sizeof(VkDrawIndirectCommand));
+            indirect_count_storage[current_frame_index].SetData(nullptr, 0, sizeof(uint32_t));
+
+            m_culling_pass->MarkDirty();
+        }
+
+#ifdef ENABLE_GPU_CULLING_VALIDATION
+        if (mesh_count > 0)
+        {
+            CullDrawDataReference(
+                m_camera_frustum,
+                m_mesh_draw_data_collection.data(),
+                mesh_count,
+                scene_snapshot.MeshTransformCollection.data(),
+                m_mesh_local_bound_collection.data(),
+                m_gpu_culling_reference_collection[current_frame_index],
+                m_mesh_lod_collection.data(),
+                m_lod_camera);
+            m_gpu_culling_pending_validation[current_frame_index] = 1;
+        }
+#endif
+    }
+
+    void SceneRenderer::__ValidateGpuCulling(uint32_t current_frame_index)
+    {
+        if (!m_gpu_culling_pending_validation[current_frame_index])
+        {
+            return;
+        }
         /*
-         * Uploading Material data
+         * The frame resources are reused once the GPU is done with them, so the previous culling output of this frame can be read back.
+         * Output buffers are only readable when host visible, which is always the case on software implementations such as lavapipe
          */
-        auto& material_data_storage = *m_SBMaterialData;
-        material_data_storage[current_frame_index].SetData(material_collection);
+        m_gpu_culling_pending_validation[current_frame_index] = 0;
+
+        auto&    indirect_command_storage = *m_SBIndirectCommand;
+        auto&    indirect_count_storage   = *m_SBIndirectCount;
+        uint32_t gpu_visible_count        = 0;
+        if (!indirect_count_storage[current_frame_index].ReadData(&gpu_visible_count, sizeof(uint32_t)))
+        {
+            return;
+        }
+
+        const auto& expected_command_collection = m_gpu_culling_reference_collection[current_frame_index];
+        if (gpu_visible_count != expected_command_collection.size())
+        {
+            ZENGINE_CORE_ERROR("GPU culling validation : {} visible draws, {} expected", gpu_visible_count, expected_command_collection.size())
+            return;
+        }
+
+        std::vector<VkDrawIndirectCommand> gpu_command_collection(gpu_visible_count);
+        if (!indirect_command_storage[current_frame_index].ReadData(gpu_command_collection.data(), gpu_visible_count * sizeof(VkDrawIndirectCommand)))
+        {
+            return;
+        }
+        /*
+         * Commands are appended with an atomic counter, their order changes from one run to another
+         */
+        std::sort(gpu_command_collection.begin(), gpu_command_collection.end(), [](const VkDrawIndirectCommand& lhs, const VkDrawIndirectCommand& rhs) {
+            return lhs.firstInstance < rhs.firstInstance;
+        });
+        for (uint32_t i = 0; i < gpu_visible_count; ++i)
+        {
+            const auto& gpu_command      = gpu_command_collection[i];
+            const auto& expected_command = expected_command_collection[i];
+            if ((gpu_command.firstInstance != expected_command.firstInstance) || (gpu_command.vertexCount != expected_command.vertexCount) ||
+                (gpu_command.instanceCount != expected_command.instanceCount) || (gpu_command.firstVertex != expected_command.firstVertex))
+            {
+                ZENGINE_CORE_ERROR("GPU culling validation : draw {} differs from the CPU reference (draw {})", gpu_command.firstInstance, expected_command.firstInstance)
+                return;
+            }
+        }
         /*
-         * Uploading Indirect Commands
+         * Mismatches are reported on every frame, matches only now and then so that a validation run shows it did compare frames
          */
-        std::vector<VkDrawIndirectCommand> draw_indirect_commmand = {};
-        draw_indirect_commmand.resize(draw_data_collection.size());
-        for (uint32_t i = 0; i < draw_indirect_commmand.size(); ++i)
+        if ((m_gpu_culling_validated_frame_count++ % 1000) == 0)
+        {
+            ZENGINE_CORE_INFO("GPU culling validation : {} frames match the CPU reference ({} visible draws)", m_gpu_culling_validated_frame_count, gpu_visible_count)
+        }
+    }
+
+    uint32_t SelectMeshLod(const Meshes::MeshLodSet& lods, const Helpers::AABB& world_bounds, const glm::vec4& lod_camera)
+    {
+        if ((lods.Count == 0) || (lod_camera.w <= 0.0f))
+        {
+            return 0;
+        }
+
+        const glm::vec3 center   = (world_bounds.Min + world_bounds.Max) * 0.5f;
+        const float     radius   = glm::length((world_bounds.Max - world_bounds.Min) * 0.5f);
+        const float     distance = glm::length(center - glm::vec3(lod_camera)) - radius;
+        if (distance <= 0.0f)
         {
-            draw_indirect_commmand[i] = {
-                .vertexCount   = draw_data_collection[i].IndexCount,
-                .instanceCount = 1,
-                .firstVertex   = 0,
-                .firstInstance = i,
-            };
+            return 0;
+        }
+
+        for (uint32_t lod = std::min(lods.Count, Meshes::MAX_MESH_LOD_COUNT); lod > 0; --lod)
+        {
+            if ((lods.Levels[lod - 1].Error * radius * lod_camera.w) <= distance)
+            {
+                return lod;
+            }
         }
+        return 0;
+    }
+
+    uint32_t CullDrawDataReference(
+        const Helpers::Frustum&             frustum,
+        const DrawData*                     draw_data,
+        uint32_t                            draw_count,
+        const glm::mat4*                    transforms,
+        const Helpers::AABB*                local_bounds,
+        std::vector<VkDrawIndirectCommand>& commands,
+        const Meshes::MeshLodSet*           mesh_lods,
+        const glm::vec4&                    lod_camera)
+    {
+        commands.clear();
+        for (uint32_t draw_index = 0; draw_index < draw_count; ++draw_index)
+        {
+            const DrawData&      data   = draw_data[draw_index];
+            const Helpers::AABB& bounds = local_bounds[data.Index];
+            if (bounds.IsEmpty())
+            {
+                continue;
+            }
 
-        m_indirect_buffer[current_frame_index]->SetData(draw_indirect_commmand);
+            const Helpers::AABB world_bounds = Helpers::TransformAABB(bounds, transforms[data.TransformIndex]);
+            uint8_t             visible      = 0;
+            Helpers::CullAABBBatch(Helpers::SimdBackend::SCALAR, frustum, &world_bounds, 1, &visible);
+            if (!visible)
+            {
+                continue;
+            }
 
+            const uint32_t lod = mesh_lods ? SelectMeshLod(mesh_lods[data.Index], world_bounds, lod_camera) : 0;
+            if (lod > 0)
+            {
+                const auto& level = mesh_lods[data.Index].Levels[lod - 1];
+                commands.push_back(VkDrawIndirectCommand{.vertexCount = level.IndexCount, .instanceCount = 1, .firstVertex = level.IndexOffset, .firstInstance = draw_index});
+            }
+            else
+            {
+                commands.push_back(VkDrawIndirectCommand{.vertexCount = data.IndexCount, .instanceCount = 1, .firstVertex = 0, .firstInstance = draw_index});
+            }
+        }
+        return (uint32_t) commands.size();
+    }
+
+    uint32_t CullMeshlets(
+        const Helpers::Frustum& frustum,
+        const Meshes::Meshlet*  meshlets,
+        uint32_t                meshlet_count,
+        const glm::mat4&        transform,
+        const glm::vec3&        camera_position,
+        bool                    cone_culling,
+        std::vector<uint32_t>&  visible)
+    {
         /*
-         * Caching last vertex/index count per frame
+         * Spheres move to the world space, scaled by the largest axis scale. The cone test doesn't depend on the transform, the camera is
+         * brought into the object space instead. Mirroring transforms swap the front faces, their meshlets are never back facing
          */
-        m_last_drawn_vertices_count[current_frame_index] = scene_data->Vertices.size();
-        m_last_drawn_index_count[current_frame_index]    = scene_data->Indices.size();
+        const float     radius_scale  = std::sqrt(std::max({glm::dot(transform[0], transform[0]), glm::dot(transform[1], transform[1]), glm::dot(transform[2], transform[2])}));
+        const glm::vec3 object_camera = glm::vec3(glm::inverse(transform) * glm::vec4(camera_position, 1.0f));
+        const bool      test_cones    = cone_culling && (glm::determinant(glm::mat3(transform)) > 0.0f);
+
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < meshlet_count; ++i)
+        {
+            const auto&     meshlet = meshlets[i];
+            const glm::vec3 center  = glm::vec3(transform * glm::vec4(meshlet.Center, 1.0f));
+            if (!Helpers::IsSphereVisible(frustum, center, meshlet.Radius * radius_scale) || (test_cones && Meshes::IsMeshletBackFacing(meshlet, object_camera)))
+            {
+                continue;
+            }
 
+            visible.push_back(i);
+            count++;
+        }
+        return count;
+    }
+
+    void CullSceneSnapshot(const Scenes::SceneSnapshot& scene_snapshot, const Helpers::Frustum& frustum, const glm::vec4& lod_camera, bool cone_culling, SceneCullingState& state)
+    {
+        const auto&    mesh_collection    = scene_snapshot.Geometry->MeshCollection;
+        const auto&    meshlet_collection = scene_snapshot.Geometry->MeshletCollection;
+        const auto&    bound_collection   = scene_snapshot.MeshWorldBoundCollection;
+        const uint32_t mesh_count         = (uint32_t) mesh_collection.size();
+        const uint32_t chunk_count        = (mesh_count + SCENE_CULLING_CHUNK_SIZE - 1) / SCENE_CULLING_CHUNK_SIZE;
+
+        state.MeshVisibilityCollection.resize(mesh_count);
+        state.MeshLodSelectionCollection.resize(mesh_count);
+        state.MeshCommandCountCollection.resize(mesh_count);
+        state.ChunkOffsetCollection.assign(chunk_count + 1, 0);
+        state.ChunkCommandOffsetCollection.assign(chunk_count + 1, 0);
+        state.ChunkMeshletCollection.resize(chunk_count);
+        /*
+         * Each chunk is tested against the frustum with the SIMD batch. Visible meshes drawn at full resolution then cull their meshlets,
+         * a mesh without any visible meshlet is culled too. The chunk counts its visible meshes and their commands
+         */
+        Helpers::ThreadPoolHelper::ParallelFor(chunk_count, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t chunk = begin; chunk < end; ++chunk)
+            {
+                const uint32_t first_mesh       = chunk * SCENE_CULLING_CHUNK_SIZE;
+                const uint32_t count            = std::min(SCENE_CULLING_CHUNK_SIZE, mesh_count - first_mesh);
+                auto&          visible_meshlets = state.ChunkMeshletCollection[chunk];
+                uint32_t       visible_count    = Helpers::CullAABBBatch(frustum, bound_collection.data() + first_mesh, count, state.MeshVisibilityCollection.data() + first_mesh);
+                uint32_t       command_count    = 0;
+
+                visible_meshlets.clear();
+                for (uint32_t mesh_slot = first_mesh; mesh_slot < (first_mesh + count); ++mesh_slot)
+                {
+                    const auto& mesh = mesh_collection[mesh_slot];
+                    if (!state.MeshVisibilityCollection[mesh_slot])
+                    {
+                        continue;
+                    }
+
+                    const uint32_t lod                         = SelectMeshLod(mesh.Lods, bound_collection[mesh_slot], lod_camera);
+                    state.MeshLodSelectionCollection[mesh_slot] = (uint8_t) lod;
+                    if ((mesh.MeshletCount == 0) || (lod > 0))
+                    {
+                        state.MeshCommandCountCollection[mesh_slot] = 1;
+                        command_count++;
+                        continue;
+                    }
+
+                    const uint32_t meshlet_count = CullMeshlets(
+                        frustum,
+                        meshlet_collection.data() + mesh.MeshletOffset,
+                        mesh.MeshletCount,
+                        scene_snapshot.MeshTransformCollection[mesh_slot],
+                        glm::vec3(lod_camera),
+                        cone_culling,
+                        visible_meshlets);
+
+                    state.MeshCommandCountCollection[mesh_slot] = meshlet_count;
+                    command_count += meshlet_count;
+                    if (meshlet_count == 0)
+                    {
+                        state.MeshVisibilityCollection[mesh_slot] = 0;
+                        visible_count--;
+                    }
+                }
+
+                state.ChunkOffsetCollection[chunk + 1]         = visible_count;
+                state.ChunkCommandOffsetCollection[chunk + 1] = command_count;
+            }
+        });
         /*
-         * Mark RenderPass dirty and should re-upadte inputs
+         * The prefix sums of the visible counts give where each chunk writes its visible meshes and commands, so that the compaction keeps the
+         * mesh slot order
          */
-        m_final_color_output_pass->MarkDirty();
+        for (uint32_t chunk = 0; chunk < chunk_count; ++chunk)
+        {
+            state.ChunkOffsetCollection[chunk + 1] += state.ChunkOffsetCollection[chunk];
+            state.ChunkCommandOffsetCollection[chunk + 1] += state.ChunkCommandOffsetCollection[chunk];
+        }
+
+        const uint32_t visible_count = state.ChunkOffsetCollection[chunk_count];
+        state.DrawDataCollection.resize(visible_count);
+        state.TransformCollection.resize(visible_count);
+        state.IndirectCommandCollection.resize(state.ChunkCommandOffsetCollection[chunk_count]);
+
+        Helpers::ThreadPoolHelper::ParallelFor(chunk_count, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t chunk = begin; chunk < end; ++chunk)
+            {
+                const uint32_t first_mesh     = chunk * SCENE_CULLING_CHUNK_SIZE;
+                const uint32_t last_mesh      = std::min(first_mesh + SCENE_CULLING_CHUNK_SIZE, mesh_count);
+                const auto&    chunk_meshlets = state.ChunkMeshletCollection[chunk];
+                uint32_t       draw_index     = state.ChunkOffsetCollection[chunk];
+                uint32_t       command_index  = state.ChunkCommandOffsetCollection[chunk];
+                uint32_t       chunk_meshlet  = 0;
+                for (uint32_t mesh_slot = first_mesh; mesh_slot < last_mesh; ++mesh_slot)
+                {
+                    if (!state.MeshVisibilityCollection[mesh_slot])
+                    {
+                        continue;
+                    }
+
+                    const auto& mesh         = mesh_collection[mesh_slot];
+                    DrawData&   draw_data    = state.DrawDataCollection[draw_index];
+                    draw_data.Index          = mesh_slot;
+                    draw_data.TransformIndex = draw_index;
+                    draw_data.MaterialIndex  = scene_snapshot.Geometry->MeshMaterialIndexCollection[mesh_slot];
+                    draw_data.VertexOffset   = mesh.VertexOffset;
+                    draw_data.IndexOffset    = mesh.IndexOffset;
+                    draw_data.VertexCount    = mesh.VertexCount;
+                    draw_data.IndexCount     = mesh.IndexCount;
+                    draw_data.VertexFormat   = (uint32_t) mesh.Format;
+                    draw_data.IndexFormat    = (uint32_t) mesh.IndexType;
+                    draw_data.PositionOffset = mesh.LocalBounds.Min;
+                    draw_data.PositionScale  = mesh.LocalBounds.Max - mesh.LocalBounds.Min;
+
+                    state.TransformCollection[draw_index] = scene_snapshot.MeshTransformCollection[mesh_slot];
+                    /*
+                     * LOD levels and meshlets are index ranges of the mesh indices : the draw data keeps the mesh range and each command
+                     * starts at its range, the vertex shaders read IndexOffset + gl_VertexIndex which includes firstVertex
+                     */
+                    const uint32_t lod = state.MeshLodSelectionCollection[mesh_slot];
+                    if ((mesh.MeshletCount > 0) && (lod == 0))
+                    {
+                        for (uint32_t i = 0; i < state.MeshCommandCountCollection[mesh_slot]; ++i)
+                        {
+                            const auto& meshlet                                    = meshlet_collection[mesh.MeshletOffset + chunk_meshlets[chunk_meshlet++]];
+                            state.IndirectCommandCollection[command_index++] = {
+                                .vertexCount   = meshlet.IndexCount,
+                                .instanceCount = 1,
+                                .firstVertex   = meshlet.IndexOffset,
+                                .firstInstance = draw_index,
+                            };
+                        }
+                    }
+                    else
+                    {
+                        state.IndirectCommandCollection[command_index++] = {
+                            .vertexCount   = (lod > 0) ? mesh.Lods.Levels[lod - 1].IndexCount : mesh.IndexCount,
+                            .instanceCount = 1,
+                            .firstVertex   = (lod > 0) ? mesh.Lods.Levels[lod - 1].IndexOffset : 0,
+                            .firstInstance = draw_index,
+                        };
+                    }
+                    draw_index++;
+                }
+            }
+        });
     }
 
     void SceneRenderer::EndScene(Buffers::CommandBuffer* const command_buffer, uint32_t current_frame_index)
     {
+        if ((m_culling_mode == SceneCullingMode::GPU) && (m_gpu_culling_constants.DrawCount > 0))
+        {
+            /*
+             * The count is reset before the culling pass appends the visible draws, the draw indirect stage then waits for the commands
+             */
+            auto& indirect_count_storage = *m_SBIndirectCount;
+            command_buffer->FillBuffer(indirect_count_storage[current_frame_index], 0);
+            command_buffer->PipelineMemoryBarrier(
+                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+
+            command_buffer->BeginComputePass(m_culling_pass);
+            command_buffer->BindDescriptorSets(current_frame_index);
+            command_buffer->PushConstants(
+                VK_SHADER_STAGE_COMPUTE_BIT, 0, offsetof(GpuCullingConstants, DrawCount) + sizeof(GpuCullingConstants::DrawCount), &m_gpu_culling_constants);
+            command_buffer->Dispatch((m_gpu_culling_constants.DrawCount + SCENE_GPU_CULLING_GROUP_SIZE - 1) / SCENE_GPU_CULLING_GROUP_SIZE);
+            command_buffer->EndComputePass();
+
+            command_buffer->PipelineMemoryBarrier(
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                VK_ACCESS_SHADER_WRITE_BIT,
+                VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_HOST_BIT,
+                VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_HOST_READ_BIT);
+        }
+
         command_buffer->BeginRenderPass(m_cubemap_pass);
         command_buffer->BindDescriptorSets(current_frame_index);
         command_buffer->DrawIndirect(m_cubemap_indirect_buffer[current_frame_index]);
@@ -314,16 +813,29 @@ namespace ZEngine::Rendering::Renderers
         // command_buffer->DrawIndirect(m_infinite_grid_indirect_buffer[current_frame_index]);
         // command_buffer->EndRenderPass();
 
-        // command_buffer->BeginRenderPass(m_final_color_output_pass);
-        // command_buffer->BindDescriptorSets(current_frame_index);
-        // command_buffer->DrawIndirect(m_indirect_buffer[current_frame_index]);
-        // command_buffer->EndRenderPass();
+        /*
+         * The scene is drawn over the cubemap, its framebuffer loads the frame output attachments
+         */
+        command_buffer->BeginRenderPass(m_final_color_output_pass);
+        command_buffer->BindDescriptorSets(current_frame_index);
+        if (m_culling_mode == SceneCullingMode::GPU)
+        {
+            auto& indirect_command_storage = *m_SBIndirectCommand;
+            auto& indirect_count_storage   = *m_SBIndirectCount;
+            command_buffer->DrawIndirectCount(indirect_command_storage[current_frame_index], indirect_count_storage[current_frame_index], m_gpu_culling_constants.DrawCount);
+        }
+        else
+        {
+            command_buffer->DrawIndirect(m_indirect_buffer[current_frame_index]);
+        }
+        command_buffer->EndRenderPass();
 
         command_buffer->End();
     }
 
     void SceneRenderer::SetViewportSize(uint32_t width, uint32_t height)
     {
+        m_viewport_height = height;
         m_cubemap_pass->ResizeRenderTarget(width, height);
         m_infinite_grid_pass->ResizeRenderTarget(width, height);
         m_final_color_output_pass->ResizeRenderTarget(width, height);
@@ -24,8 +24,9 @@ namespace ZEngine::Rendering::Shaders
 
     Shader::Shader(const Specifications::ShaderSpecification& spec) : m_specification(spec)
     {
-        m_shader_create_info_collection.resize(2);
-        m_shader_module_collection.resize(2);
+        const uint32_t stage_count = m_specification.ComputeFilename.empty() ? 2 : 1;
+        m_shader_create_info_collection.resize(stage_count);
+        m_shader_module_collection.resize(stage_count);
 
         CreateModule();
         CreateDescriptorSetLayouts();
@@ -47,6 +48,57 @@ namespace ZEngine::Rendering::Shaders
     {
         auto                         device = Hardwares::VulkanDevice::GetNativeDeviceHandle();
         Scope<spirv_cross::Compiler> spirv_compiler;
+        /*
+         * Compute Shader processing
+         */
+        if (!m_specification.ComputeFilename.empty())
+        {
+            m_shader_create_info_collection[0]                  = {};
+            std::vector<uint32_t>    compute_shader_binary_code = Rendering::Shaders::ShaderReader::ReadAsBinary(m_specification.ComputeFilename);
+            VkShaderModuleCreateInfo compute_shader_create_info = {};
+            compute_shader_create_info.sType                    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+            compute_shader_create_info.codeSize                 = compute_shader_binary_code.size() * sizeof(uint32_t);
+            compute_shader_create_info.pCode                    = compute_shader_binary_code.data();
+            ZENGINE_VALIDATE_ASSERT(
+                vkCreateShaderModule(device, &compute_shader_create_info, nullptr, &m_shader_module_collection[0]) == VK_SUCCESS, "Failed to create ShaderModule")
+            m_shader_create_info_collection[0].sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+            m_shader_create_info_collection[0].stage  = VK_SHADER_STAGE_COMPUTE_BIT;
+            m_shader_create_info_collection[0].module = m_shader_module_collection[0];
+            m_shader_create_info_collection[0].pName  = "main";
+            /*
+             * Source Reflection
+             */
+            spirv_compiler         = CreateScope<spirv_cross::Compiler>(compute_shader_binary_code);
+            auto compute_resources = spirv_compiler->get_shader_resources();
+            for (const auto& UB_resource : compute_resources.uniform_buffers)
+            {
+                uint32_t set     = spirv_compiler->get_decoration(UB_resource.id, spv::DecorationDescriptorSet);
+                uint32_t binding = spirv_compiler->get_decoration(UB_resource.id, spv::DecorationBinding);
+
+                m_layout_binding_specification_map[set].emplace_back(LayoutBindingSpecification{
+                    .Set = set, .Binding = binding, .Name = UB_resource.name, .DescriptorType = DescriptorType::UNIFORM_BUFFER, .Flags = ShaderStageFlags::COMPUTE});
+            }
+
+            for (const auto& SB_resource : compute_resources.storage_buffers)
+            {
+                uint32_t set     = spirv_compiler->get_decoration(SB_resource.id, spv::DecorationDescriptorSet);
+                uint32_t binding = spirv_compiler->get_decoration(SB_resource.id, spv::DecorationBinding);
+
+                m_layout_binding_specification_map[set].emplace_back(LayoutBindingSpecification{
+                    .Set = set, .Binding = binding, .Name = SB_resource.name, .DescriptorType = DescriptorType::STORAGE_BUFFER, .Flags = ShaderStageFlags::COMPUTE});
+            }
+
+            for (const auto& pushConstant_resource : compute_resources.push_constant_buffers)
+            {
+                const spirv_cross::SPIRType& type = spirv_compiler->get_type(pushConstant_resource.base_type_id);
+                if (type.basetype == spirv_cross::SPIRType::Struct)
+                {
+                    m_push_constant_specification_collection.emplace_back(PushConstantSpecification{
+                        .Name = pushConstant_resource.name, .Size = (uint32_t) spirv_compiler->get_declared_struct_size(type), .Offset = 0, .Flags = ShaderStageFlags::COMPUTE});
+                }
+            }
+            return;
+        }
         /*
          * Vertex Shader processing
          */
@@ -0,0 +1,85 @@
+#include <pch.h>
+#include <Helpers/SimdBackend.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define ZENGINE_SIMD_BACKEND_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#else
+#define ZENGINE_SIMD_BACKEND_X86 0
+#endif
+
+namespace ZEngine::Helpers
+{
+#if ZENGINE_SIMD_BACKEND_X86
+    static bool IsAVX2Supported()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int cpu_info[4] = {};
+        __cpuid(cpu_info, 1);
+        const bool has_fma     = (cpu_info[2] & (1 << 12)) != 0;
+        const bool has_osxsave = (cpu_info[2] & (1 << 27)) != 0;
+        const bool has_avx     = (cpu_info[2] & (1 << 28)) != 0;
+        if (!has_fma || !has_osxsave || !has_avx)
+        {
+            return false;
+        }
+        /* The OS must save YMM registers on context switch */
+        if ((_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+        __cpuidex(cpu_info, 7, 0);
+        return (cpu_info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+    }
+
+    static bool IsSSE4Supported()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int cpu_info[4] = {};
+        __cpuid(cpu_info, 1);
+        return (cpu_info[2] & (1 << 19)) != 0;
+#else
+        return __builtin_cpu_supports("sse4.1");
+#endif
+    }
+#endif
+
+    bool IsSimdBackendSupported(SimdBackend backend)
+    {
+        switch (backend)
+        {
+            case SimdBackend::SCALAR:
+                return true;
+#if ZENGINE_SIMD_BACKEND_X86
+            case SimdBackend::SSE4:
+                return IsSSE4Supported();
+            case SimdBackend::AVX2:
+                return IsAVX2Supported();
+#endif
+            default:
+                return false;
+        }
+    }
+
+    SimdBackend GetSimdBackend()
+    {
+        static const SimdBackend backend = [] {
+            if (IsSimdBackendSupported(SimdBackend::AVX2))
+            {
+                return SimdBackend::AVX2;
+            }
+            if (IsSimdBackendSupported(SimdBackend::SSE4))
+            {
+                return SimdBackend::SSE4;
+            }
+            return SimdBackend::SCALAR;
+        }();
+        return backend;
+    }
+} // namespace ZEngine::Helpers
@@ -0,0 +1,123 @@
+#include <pch.h>
+#include <Rendering/Meshes/VertexQuantization.h>
+#include <glm/gtc/packing.hpp>
+#include <cstring>
+
+namespace ZEngine::Rendering::Meshes
+{
+    static_assert(sizeof(QuantizedVertex) * 2 == sizeof(Renderers::Storages::IVertex), "QuantizedVertex must be half of IVertex");
+
+    static glm::vec2 SignNotZero(const glm::vec2& value)
+    {
+        return glm::vec2((value.x >= 0.0f) ? 1.0f : -1.0f, (value.y >= 0.0f) ? 1.0f : -1.0f);
+    }
+
+    /*
+     * The normal is projected on the octahedron |x| + |y| + |z| = 1, whose lower half is folded over the upper one.
+     * A null normal (mesh without normals) decodes as +Z
+     */
+    static uint32_t EncodeOctahedralNormal(const glm::vec3& normal)
+    {
+        const float manhattan_length = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+        if (manhattan_length == 0.0f)
+        {
+            return glm::packSnorm2x16(glm::vec2(0.0f));
+        }
+
+        glm::vec2 octahedral = glm::vec2(normal.x, normal.y) / manhattan_length;
+        if (normal.z < 0.0f)
+        {
+            octahedral = (1.0f - glm::abs(glm::vec2(octahedral.y, octahedral.x))) * SignNotZero(octahedral);
+        }
+        return glm::packSnorm2x16(octahedral);
+    }
+
+    static glm::vec3 DecodeOctahedralNormal(uint32_t encoded_normal)
+    {
+        const glm::vec2 octahedral = glm::unpackSnorm2x16(encoded_normal);
+        glm::vec3       normal     = glm::vec3(octahedral.x, octahedral.y, 1.0f - std::abs(octahedral.x) - std::abs(octahedral.y));
+        if (normal.z < 0.0f)
+        {
+            const glm::vec2 folded = (1.0f - glm::abs(glm::vec2(normal.y, normal.x))) * SignNotZero(glm::vec2(normal.x, normal.y));
+            normal.x               = folded.x;
+            normal.y               = folded.y;
+        }
+        return glm::normalize(normal);
+    }
+
+    uint32_t GetVertexFloatCount(VertexFormat format)
+    {
+        return (format == VertexFormat::QUANTIZED) ? (sizeof(QuantizedVertex) / sizeof(float)) : (sizeof(Renderers::Storages::IVertex) / sizeof(float));
+    }
+
+    QuantizedVertex QuantizeVertex(const Renderers::Storages::IVertex& vertex, const Helpers::AABB& bounds)
+    {
+        /*
+         * Flat axes of the bounds quantize to 0
+         */
+        const glm::vec3 extent   = bounds.Max - bounds.Min;
+        const glm::vec3 position = glm::vec3(
+            (extent.x > 0.0f) ? ((vertex.m_position.x - bounds.Min.x) / extent.x) : 0.0f,
+            (extent.y > 0.0f) ? ((vertex.m_position.y - bounds.Min.y) / extent.y) : 0.0f,
+            (extent.z > 0.0f) ? ((vertex.m_position.z - bounds.Min.z) / extent.z) : 0.0f);
+
+        QuantizedVertex quantized_vertex = {};
+        quantized_vertex.PositionXY      = glm::packUnorm2x16(glm::vec2(position.x, position.y));
+        quantized_vertex.PositionZ       = glm::packUnorm2x16(glm::vec2(position.z, 0.0f));
+        quantized_vertex.Normal          = EncodeOctahedralNormal(vertex.m_normal);
+        quantized_vertex.TextureCoord    = glm::packHalf2x16(vertex.m_texture_coord);
+        return quantized_vertex;
+    }
+
+    Renderers::Storages::IVertex DequantizeVertex(const QuantizedVertex& vertex, const Helpers::AABB& bounds)
+    {
+        const glm::vec2 position_xy = glm::unpackUnorm2x16(vertex.PositionXY);
+        const glm::vec2 position_z  = glm::unpackUnorm2x16(vertex.PositionZ);
+
+        Renderers::Storages::IVertex decoded_vertex = {};
+        decoded_vertex.m_position                   = bounds.Min + glm::vec3(position_xy.x, position_xy.y, position_z.x) * (bounds.Max - bounds.Min);
+        decoded_vertex.m_normal                     = DecodeOctahedralNormal(vertex.Normal);
+        decoded_vertex.m_texture_coord              = glm::unpackHalf2x16(vertex.TextureCoord);
+        return decoded_vertex;
+    }
+
+    void QuantizeVertices(std::vector<float>& vertices, const Helpers::AABB& bounds)
+    {
+        const uint32_t vertex_float_count = GetVertexFloatCount(VertexFormat::FLOAT);
+        const uint32_t output_float_count = GetVertexFloatCount(VertexFormat::QUANTIZED);
+        const auto     vertex_count       = (uint32_t) (vertices.size() / vertex_float_count);
+        /*
+         * The i-th output vertex never overlaps a vertex still to be read, each vertex is read before the output is written
+         */
+        for (uint32_t i = 0; i < vertex_count; ++i)
+        {
+            Renderers::Storages::IVertex vertex = {};
+            std::memcpy(&vertex, vertices.data() + (size_t) i * vertex_float_count, sizeof(vertex));
+            const QuantizedVertex quantized_vertex = QuantizeVertex(vertex, bounds);
+            std::memcpy(vertices.data() + (size_t) i * output_float_count, &quantized_vertex, sizeof(quantized_vertex));
+        }
+        vertices.resize((size_t) vertex_count * output_float_count);
+    }
+
+    std::vector<float> DecodeVertexPositions(const float* vertices, uint32_t vertex_count, VertexFormat format, const Helpers::AABB& bounds)
+    {
+        const uint32_t     vertex_float_count = GetVertexFloatCount(format);
+        std::vector<float> positions((size_t) vertex_count * 3);
+        for (uint32_t i = 0; i < vertex_count; ++i)
+        {
+            const float* vertex = vertices + (size_t) i * vertex_float_count;
+            glm::vec3    position(vertex[0], vertex[1], vertex[2]);
+            if (format == VertexFormat::QUANTIZED)
+            {
+                QuantizedVertex quantized_vertex = {};
+                std::memcpy(&quantized_vertex, vertex, sizeof(quantized_vertex));
+                position = DequantizeVertex(quantized_vertex, bounds).m_position;
+            }
+
+            positions[(size_t) i * 3]     = position.x;
+            positions[(size_t) i * 3 + 1] = position.y;
+            positions[(size_t) i * 3 + 2] = position.z;
+        }
+        return positions;
+    }
+} // namespace ZEngine::Rendering::Meshes
@@ -29,6 +29,7 @@ namespace ZEngine::Hardwares
     VkPhysicalDevice                                                                 VulkanDevice::s_physical_device                   = VK_NULL_HANDLE;
     VkPhysicalDeviceProperties                                                       VulkanDevice::s_physical_device_properties        = {};
     VkPhysicalDeviceFeatures                                                         VulkanDevice::s_physical_device_feature           = {};
+    bool                                                                             VulkanDevice::s_draw_indirect_count_supported     = false;
     VkPhysicalDeviceMemoryProperties                                                 VulkanDevice::s_physical_device_memory_properties = {};
     VkDebugUtilsMessengerEXT                                                         VulkanDevice::s_debug_messenger                   = VK_NULL_HANDLE;
     std::deque<BufferView>                                                           VulkanDevice::s_dirty_buffer_queue                = {};
@@ -176,6 +177,9 @@ namespace ZEngine::Hardwares
         std::vector<VkPhysicalDevice> physical_device_collection(gpu_device_count);
         vkEnumeratePhysicalDevices(s_vulkan_instance, &gpu_device_count, physical_device_collection.data());
 
+        /*
+         * Discrete GPUs are preferred, integrated GPUs and software implementations (e.g lavapipe) are only picked when none is available
+         */
         for (VkPhysicalDevice physical_device : physical_device_collection)
         {
             VkPhysicalDeviceProperties physical_device_properties;
@@ -183,16 +187,26 @@ namespace ZEngine::Hardwares
             vkGetPhysicalDeviceProperties(physical_device, &physical_device_properties);
             vkGetPhysicalDeviceFeatures(physical_device, &physical_device_feature);
 
-            if ((physical_device_feature.geometryShader == VK_TRUE) && (physical_device_feature.samplerAnisotropy == VK_TRUE) &&
-                (physical_device_properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU))
+            if ((physical_device_feature.geometryShader != VK_TRUE) || (physical_device_feature.samplerAnisotropy != VK_TRUE))
+            {
+                continue;
+            }
+
+            const bool is_discrete_gpu = (physical_device_properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU);
+            if ((s_physical_device == VK_NULL_HANDLE) || is_discrete_gpu)
             {
                 s_physical_device            = physical_device;
                 s_physical_device_properties = physical_device_properties;
                 s_physical_device_feature    = physical_device_feature;
-                vkGetPhysicalDeviceMemoryProperties(s_physical_device, &s_physical_device_memory_properties);
+            }
+
+            if (is_discrete_gpu)
+            {
                 break;
             }
         }
+        ZENGINE_VALIDATE_ASSERT(s_physical_device != VK_NULL_HANDLE, "Failed to find a suitable GPU")
+        vkGetPhysicalDeviceMemoryProperties(s_physical_device, &s_physical_device_memory_properties);
 
         std::vector<const char*> requested_device_enabled_layer_name_collection   = {};
         std::vector<const char*> requested_device_extension_layer_name_collection = {VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_KHR_SHADER_DRAW_PARAMETERS_EXTENSION_NAME};
@@ -267,17 +281,32 @@ namespace ZEngine::Hardwares
         s_physical_device_feature.multiDrawIndirect                      = VK_TRUE;
         s_physical_device_feature.shaderSampledImageArrayDynamicIndexing = VK_TRUE;
 
-        VkPhysicalDeviceDescriptorIndexingFeaturesEXT physical_device_descriptor_indexing_features = {};
-        physical_device_descriptor_indexing_features.sType                                         = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
-        physical_device_descriptor_indexing_features.shaderSampledImageArrayNonUniformIndexing     = VK_TRUE;
-        physical_device_descriptor_indexing_features.descriptorBindingSampledImageUpdateAfterBind  = VK_TRUE;
-        physical_device_descriptor_indexing_features.descriptorBindingUpdateUnusedWhilePending     = VK_TRUE;
-        physical_device_descriptor_indexing_features.descriptorBindingPartiallyBound               = VK_TRUE;
-        physical_device_descriptor_indexing_features.runtimeDescriptorArray                        = VK_TRUE;
+        /*
+         * vkCmdDrawIndirectCount is optional, GPU-driven culling falls back to CPU culling without it
+         */
+        VkPhysicalDeviceVulkan12Features supported_vulkan_12_features = {};
+        supported_vulkan_12_features.sType                            = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        VkPhysicalDeviceFeatures2 supported_features_2                = {};
+        supported_features_2.sType                                    = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        supported_features_2.pNext                                    = &supported_vulkan_12_features;
+        vkGetPhysicalDeviceFeatures2(s_physical_device, &supported_features_2);
+        s_draw_indirect_count_supported = (supported_vulkan_12_features.drawIndirectCount == VK_TRUE);
+
+        /*
+         * Descriptor indexing features are part of the Vulkan 1.2 features, which can't be chained along with VkPhysicalDeviceDescriptorIndexingFeatures
+         */
+        VkPhysicalDeviceVulkan12Features physical_device_vulkan_12_features             = {};
+        physical_device_vulkan_12_features.sType                                        = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        physical_device_vulkan_12_features.shaderSampledImageArrayNonUniformIndexing    = VK_TRUE;
+        physical_device_vulkan_12_features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        physical_device_vulkan_12_features.descriptorBindingUpdateUnusedWhilePending    = VK_TRUE;
+        physical_device_vulkan_12_features.descriptorBindingPartiallyBound              = VK_TRUE;
+        physical_device_vulkan_12_features.runtimeDescriptorArray                       = VK_TRUE;
+        physical_device_vulkan_12_features.drawIndirectCount                            = s_draw_indirect_count_supported ? VK_TRUE : VK_FALSE;
 
         VkPhysicalDeviceFeatures2 device_features_2 = {};
         device_features_2.sType                     = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
-        device_features_2.pNext                     = &physical_device_descriptor_indexing_features;
+        device_features_2.pNext                     = &physical_device_vulkan_12_features;
         device_features_2.features                  = s_physical_device_feature;
 
         VkDeviceCreateInfo device_create_info    = {};
@@ -893,6 +922,11 @@ namespace ZEngine::Hardwares
         return s_physical_device_memory_properties;
     }
 
+    bool VulkanDevice::IsDrawIndirectCountSupported()
+    {
+        return s_draw_indirect_count_supported;
+    }
+
     void VulkanDevice::MapAndCopyToMemory(BufferView& buffer, size_t data_size, const void* data)
     {
         void* mapped_memory;
@@ -923,13 +957,13 @@ namespace ZEngine::Hardwares
         return buffer_view;
     }
 
-    void VulkanDevice::CopyBuffer(const BufferView& source, const BufferView& destination, VkDeviceSize byte_size)
+    void VulkanDevice::CopyBuffer(const BufferView& source, const BufferView& destination, VkDeviceSize byte_size, VkDeviceSize destination_offset)
     {
         auto command_buffer = BeginInstantCommandBuffer(Rendering::QueueType::TRANSFER_QUEUE);
         {
             VkBufferCopy buffer_copy = {};
             buffer_copy.srcOffset    = 0;
-            buffer_copy.dstOffset    = 0;
+            buffer_copy.dstOffset    = destination_offset;
             buffer_copy.size         = byte_size;
 
             vkCmdCopyBuffer(command_buffer->GetHandle(), source.Handle, destination.Handle, 1, &buffer_copy);
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <glm/gtc/matrix_transform.hpp>
+#include <Helpers/BoundingVolumeHierarchy.h>
+
+using namespace ZEngine::Helpers;
+
+static std::vector<AABB> GenerateBounds(uint32_t count)
+{
+    std::mt19937                          generator(42);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> size(0.5f, 4.0f);
+
+    std::vector<AABB> bounds(count);
+    for (auto& box : bounds)
+    {
+        glm::vec3 center(position(generator), position(generator), position(generator));
+        box.Min = center - glm::vec3(size(generator));
+        box.Max = center + glm::vec3(size(generator));
+    }
+    return bounds;
+}
+
+static std::vector<uint32_t> QueryBruteForce(const std::vector<AABB>& bounds, const AABB& query)
+{
+    std::vector<uint32_t> primitives;
+    for (uint32_t i = 0; i < bounds.size(); ++i)
+    {
+        if (bounds[i].Overlaps(query))
+        {
+            primitives.push_back(i);
+        }
+    }
+    return primitives;
+}
+
+static std::vector<uint32_t> QuerySorted(const BoundingVolumeHierarchy& bvh, const std::vector<AABB>& bounds, const AABB& query)
+{
+    std::vector<uint32_t> primitives;
+    bvh.QueryOverlap(query, bounds.data(), primitives);
+    std::sort(primitives.begin(), primitives.end());
+    return primitives;
+}
+
+TEST(BoundingVolumeHierarchyTest, TransformAABBMatchesTransformedCorners)
+{
+    const AABB      box       = {.Min = glm::vec3(-1.0f, 0.0f, 2.0f), .Max = glm::vec3(3.0f, 1.0f, 4.0f)};
+    const glm::mat4 transform = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(5.0f, -2.0f, 0.0f)), glm::radians(30.0f), glm::vec3(0.0f, 1.0f, 1.0f));
+
+    AABB expected;
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        glm::vec3 point((corner & 1) ? box.Max.x : box.Min.x, (corner & 2) ? box.Max.y : box.Min.y, (corner & 4) ? box.Max.z : box.Min.z);
+        expected.Grow(glm::vec3(transform * glm::vec4(point, 1.0f)));
+    }
+
+    const AABB result = TransformAABB(box, transform);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        EXPECT_NEAR(result.Min[axis], expected.Min[axis], 1e-4f);
+        EXPECT_NEAR(result.Max[axis], expected.Max[axis], 1e-4f);
+    }
+}
+
+TEST(BoundingVolumeHierarchyTest, QueryOverlapMatchesBruteForce)
+{
+    auto bounds = GenerateBounds(10'000);
+
+    BoundingVolumeHierarchy bvh;
+    bvh.Build(bounds.data(), bounds.size());
+    EXPECT_EQ(bvh.GetPrimitiveCount(), bounds.size());
+
+    const AABB query = {.Min = glm::vec3(-60.0f), .Max = glm::vec3(80.0f)};
+    EXPECT_EQ(QuerySorted(bvh, bounds, query), QueryBruteForce(bounds, query));
+}
+
+TEST(BoundingVolumeHierarchyTest, RefitFollowsMovedPrimitives)
+{
+    auto bounds = GenerateBounds(10'000);
+
+    BoundingVolumeHierarchy incremental_bvh;
+    BoundingVolumeHierarchy full_bvh;
+    incremental_bvh.Build(bounds.data(), bounds.size());
+    full_bvh.Build(bounds.data(), bounds.size());
+
+    std::vector<uint32_t> moved_primitives;
+    for (uint32_t i = 0; i < bounds.size(); i += 13)
+    {
+        bounds[i].Min += glm::vec3(250.0f);
+        bounds[i].Max += glm::vec3(250.0f);
+        moved_primitives.push_back(i);
+    }
+    incremental_bvh.Refit(bounds.data(), moved_primitives.data(), moved_primitives.size());
+    full_bvh.Refit(bounds.data());
+
+    const AABB query = {.Min = glm::vec3(100.0f), .Max = glm::vec3(300.0f)};
+    EXPECT_EQ(QuerySorted(incremental_bvh, bounds, query), QueryBruteForce(bounds, query));
+    EXPECT_EQ(QuerySorted(full_bvh, bounds, query), QueryBruteForce(bounds, query));
+    EXPECT_EQ(incremental_bvh.GetBounds(), full_bvh.GetBounds());
+}
+
+TEST(BoundingVolumeHierarchyTest, QueryNearestMatchesBruteForce)
+{
+    auto bounds = GenerateBounds(10'000);
+
+    BoundingVolumeHierarchy bvh;
+    bvh.Build(bounds.data(), bounds.size());
+
+    std::mt19937                          generator(9);
+    std::uniform_real_distribution<float> position(-600.0f, 600.0f);
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        const glm::vec3 point(position(generator), position(generator), position(generator));
+
+        uint32_t expected          = 0xFFFFFFFF;
+        float    expected_distance = FLT_MAX;
+        for (uint32_t primitive = 0; primitive < bounds.size(); ++primitive)
+        {
+            const float distance = std::sqrt(bounds[primitive].GetDistanceSquared(point));
+            if (distance < expected_distance)
+            {
+                expected          = primitive;
+                expected_distance = distance;
+            }
+        }
+
+        uint32_t primitive = 0;
+        float    distance  = 0.0f;
+        ASSERT_TRUE(bvh.QueryNearest(point, bounds.data(), FLT_MAX, primitive, distance));
+        EXPECT_EQ(primitive, expected);
+        EXPECT_FLOAT_EQ(distance, expected_distance);
+        if (expected_distance > 0.0f)
+        {
+            EXPECT_FALSE(bvh.QueryNearest(point, bounds.data(), expected_distance * 0.5f, primitive, distance));
+        }
+    }
+}
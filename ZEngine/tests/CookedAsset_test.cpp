@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <Rendering/Scenes/CookedAsset.h>
+#include <Rendering/Meshes/VertexQuantization.h>
+
+using namespace ZEngine::Rendering::Scenes;
+
+/*
+ * Root node with one mesh holder child, a quad mesh and a textured material
+ */
+static CookedAssetData MakeCookedAsset()
+{
+    CookedAssetData asset;
+    asset.Nodes.push_back({.Parent = -1, .DepthLevel = 0, .Name = asset.AddString("root")});
+    asset.Nodes.push_back({.Parent = 0, .DepthLevel = 1, .Mesh = 0, .Name = asset.AddString("quad")});
+    asset.LocalTransforms.push_back(glm::mat4(2.0f));
+    asset.LocalTransforms.emplace_back(1.0f);
+
+    asset.Vertices = {
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, //
+        1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, //
+        1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, //
+        0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, //
+    };
+    asset.Indices = {0, 1, 2, 0, 2, 3};
+    asset.Meshes.push_back(
+        {.VertexOffset  = 0,
+         .VertexCount   = 4,
+         .IndexOffset   = 0,
+         .IndexCount    = 6,
+         .Material      = 0,
+         .LocalBounds   = {.Min = glm::vec3(0.0f), .Max = glm::vec3(1.0f, 1.0f, 0.0f)},
+         .MeshletOffset = 0,
+         .MeshletCount  = 1});
+    asset.Meshlets.push_back({.IndexOffset = 0, .IndexCount = 6, .VertexCount = 4, .Center = glm::vec3(0.5f, 0.5f, 0.0f), .Radius = 0.75f});
+
+    ZEngine::Rendering::Meshes::MeshMaterial material = {};
+    material.MetallicFactor                           = 0.5f;
+    material.AlbedoTextureMap                         = 0;
+    asset.Materials.push_back(material);
+    asset.MaterialNames.push_back(asset.AddString("painted"));
+    asset.TextureFiles.push_back(asset.AddString("textures/albedo.png"));
+    return asset;
+}
+
+static std::string GetTemporaryFilename(std::string_view name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+TEST(CookedAssetTest, RoundTripsThroughFile)
+{
+    const CookedAssetData asset    = MakeCookedAsset();
+    const CookedAssetKey  key      = {.SourceHash = 42, .SourceSize = 1024, .ImportFlags = 7};
+    const std::string     filename = GetTemporaryFilename("zengine_cooked_asset_test.zasset");
+    ASSERT_TRUE(WriteCookedAsset(filename, key, asset.GetView()));
+
+    CookedAssetFile file;
+    ASSERT_TRUE(file.Open(filename, key));
+    const CookedAssetView& view = file.GetView();
+    ASSERT_EQ(view.Nodes.size(), 2u);
+    EXPECT_EQ(view.GetString(view.Nodes[0].Name), "root");
+    EXPECT_EQ(view.GetString(view.Nodes[1].Name), "quad");
+    EXPECT_EQ(view.Nodes[1].Parent, 0);
+    EXPECT_EQ(view.Nodes[1].Mesh, 0);
+    EXPECT_EQ(view.LocalTransforms[0], glm::mat4(2.0f));
+    EXPECT_TRUE(std::equal(view.Vertices.begin(), view.Vertices.end(), asset.Vertices.begin(), asset.Vertices.end()));
+    EXPECT_TRUE(std::equal(view.Indices.begin(), view.Indices.end(), asset.Indices.begin(), asset.Indices.end()));
+    ASSERT_EQ(view.Meshes.size(), 1u);
+    EXPECT_EQ(view.Meshes[0].IndexCount, 6u);
+    EXPECT_EQ(view.Meshes[0].LocalBounds.Max, glm::vec3(1.0f, 1.0f, 0.0f));
+    ASSERT_EQ(view.Meshlets.size(), 1u);
+    EXPECT_EQ(view.Meshlets[0].IndexCount, 6u);
+    EXPECT_FLOAT_EQ(view.Meshlets[0].Radius, 0.75f);
+    ASSERT_EQ(view.Materials.size(), 1u);
+    EXPECT_FLOAT_EQ(view.Materials[0].MetallicFactor, 0.5f);
+    EXPECT_EQ(view.GetString(view.MaterialNames[0]), "painted");
+    EXPECT_EQ(view.GetString(view.TextureFiles[view.Materials[0].AlbedoTextureMap]), "textures/albedo.png");
+    /*
+     * Another source content, other import flags or another vertex format must cook the asset again
+     */
+    CookedAssetFile stale_file;
+    EXPECT_FALSE(stale_file.Open(filename, {.SourceHash = 43, .SourceSize = 1024, .ImportFlags = 7}));
+    EXPECT_FALSE(stale_file.Open(filename, {.SourceHash = 42, .SourceSize = 1024, .ImportFlags = 8}));
+    EXPECT_FALSE(stale_file.Open(filename, {.SourceHash = 42, .SourceSize = 1024, .ImportFlags = 7, .VertexFormat = 1}));
+
+    file.Close();
+    std::filesystem::remove(filename);
+}
+
+TEST(CookedAssetTest, RejectsCorruptedFiles)
+{
+    CookedAssetData      asset    = MakeCookedAsset();
+    const CookedAssetKey key      = {.SourceHash = 1, .SourceSize = 1, .ImportFlags = 1};
+    const std::string    filename = GetTemporaryFilename("zengine_cooked_asset_corrupted_test.zasset");
+    /*
+     * A mesh range past the end of the vertices
+     */
+    asset.Meshes[0].VertexCount = 5;
+    ASSERT_TRUE(WriteCookedAsset(filename, key, asset.GetView()));
+    CookedAssetFile file;
+    EXPECT_FALSE(file.Open(filename, key));
+    /*
+     * A LOD level past the end of the indices
+     */
+    asset.Meshes[0].VertexCount = 4;
+    asset.Meshes[0].Lods        = {.Count = 1, .Levels = {{.IndexOffset = 6, .IndexCount = 3}}};
+    ASSERT_TRUE(WriteCookedAsset(filename, key, asset.GetView()));
+    EXPECT_FALSE(file.Open(filename, key));
+    /*
+     * A meshlet past the end of its mesh indices
+     */
+    asset.Meshes[0].Lods         = {};
+    asset.Meshlets[0].IndexCount = 9;
+    ASSERT_TRUE(WriteCookedAsset(filename, key, asset.GetView()));
+    EXPECT_FALSE(file.Open(filename, key));
+    /*
+     * 16 bits indices take half of the words : a range of 6 indices fits in 3 words, not in 2
+     */
+    asset.Meshlets[0].IndexCount = 6;
+    asset.Meshes[0].IndexType    = ZEngine::Rendering::Meshes::IndexFormat::UINT16;
+    asset.Indices                = {0x00010000, 0x00000002, 0x00030002, 0};
+    ASSERT_TRUE(WriteCookedAsset(filename, key, asset.GetView()));
+    EXPECT_TRUE(file.Open(filename, key));
+    file.Close();
+    asset.Meshes[0].IndexOffset = 2;
+    ASSERT_TRUE(WriteCookedAsset(filename, key, asset.GetView()));
+    EXPECT_FALSE(file.Open(filename, key));
+    /*
+     * An unknown index format
+     */
+    asset.Meshes[0].IndexOffset = 0;
+    asset.Meshes[0].IndexType   = (ZEngine::Rendering::Meshes::IndexFormat) 2;
+    ASSERT_TRUE(WriteCookedAsset(filename, key, asset.GetView()));
+    EXPECT_FALSE(file.Open(filename, key));
+    /*
+     * A file cut in the middle of its sections
+     */
+    asset.Meshes[0].IndexType = ZEngine::Rendering::Meshes::IndexFormat::UINT32;
+    asset.Indices             = {0, 1, 2, 0, 2, 3};
+    ASSERT_TRUE(WriteCookedAsset(filename, key, asset.GetView()));
+    ASSERT_TRUE(file.Open(filename, key));
+    file.Close();
+    std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 8);
+    EXPECT_FALSE(file.Open(filename, key));
+
+    std::filesystem::remove(filename);
+}
+
+TEST(CookedAssetTest, ContentHashDependsOnEveryChunk)
+{
+    std::mt19937         generator(13);
+    std::vector<uint8_t> content(9 << 20);
+    for (auto& byte : content)
+    {
+        byte = (uint8_t) generator();
+    }
+
+    const uint64_t hash = ComputeContentHash(content.data(), content.size());
+    EXPECT_EQ(ComputeContentHash(content.data(), content.size()), hash);
+    EXPECT_NE(ComputeContentHash(content.data(), content.size() - 1), hash);
+
+    content[content.size() - 1] ^= 1;
+    EXPECT_NE(ComputeContentHash(content.data(), content.size()), hash);
+    content[content.size() - 1] ^= 1;
+    content[5 << 20] ^= 1;
+    EXPECT_NE(ComputeContentHash(content.data(), content.size()), hash);
+    EXPECT_NE(ComputeContentHash(content.data(), 17), ComputeContentHash(content.data() + 1, 17));
+}
+
+TEST(CookedAssetTest, PacksMeshGeometryAtPrefixSumRanges)
+{
+    /*
+     * Meshes of both vertex formats and of varying sizes, some without indices or meshlets. Each value tells its mesh apart
+     */
+    const uint32_t                            mesh_count = 64;
+    std::vector<std::vector<float>>           vertex_collection(mesh_count);
+    std::vector<std::vector<uint32_t>>        index_collection(mesh_count);
+    std::vector<std::vector<ZEngine::Rendering::Meshes::Meshlet>> meshlet_collection(mesh_count);
+    std::vector<CookedMeshGeometry>           geometry_collection(mesh_count);
+    CookedAssetData                           asset;
+    asset.Meshes.resize(mesh_count);
+    for (uint32_t i = 0; i < mesh_count; ++i)
+    {
+        auto& mesh       = asset.Meshes[i];
+        mesh.Format      = (i % 2) ? ZEngine::Rendering::Meshes::VertexFormat::QUANTIZED : ZEngine::Rendering::Meshes::VertexFormat::FLOAT;
+        mesh.IndexCount  = 3 * i;
+        mesh.Material    = i;
+        const auto count = (i % 5) + 1;
+        vertex_collection[i].assign(count * ZEngine::Rendering::Meshes::GetVertexFloatCount(mesh.Format), (float) i);
+        index_collection[i].assign(i % 7, i);
+        meshlet_collection[i].assign(i % 3, {.IndexOffset = i});
+        geometry_collection[i] = {.Vertices = vertex_collection[i], .Indices = index_collection[i], .Meshlets = meshlet_collection[i]};
+    }
+
+    PackCookedAssetMeshes(geometry_collection, asset);
+
+    uint32_t vertex_offset  = 0;
+    uint32_t index_offset   = 0;
+    uint32_t meshlet_offset = 0;
+    for (uint32_t i = 0; i < mesh_count; ++i)
+    {
+        const auto& mesh = asset.Meshes[i];
+        EXPECT_EQ(mesh.VertexOffset, vertex_offset);
+        EXPECT_EQ(mesh.VertexCount, (i % 5) + 1);
+        EXPECT_EQ(mesh.IndexOffset, index_offset);
+        EXPECT_EQ(mesh.MeshletOffset, meshlet_offset);
+        EXPECT_EQ(mesh.MeshletCount, meshlet_collection[i].size());
+        EXPECT_EQ(mesh.IndexCount, 3 * i);
+        EXPECT_EQ(mesh.Material, i);
+
+        EXPECT_TRUE(std::equal(vertex_collection[i].begin(), vertex_collection[i].end(), asset.Vertices.begin() + mesh.VertexOffset));
+        EXPECT_TRUE(std::equal(index_collection[i].begin(), index_collection[i].end(), asset.Indices.begin() + mesh.IndexOffset));
+        for (uint32_t meshlet = 0; meshlet < mesh.MeshletCount; ++meshlet)
+        {
+            EXPECT_EQ(asset.Meshlets[mesh.MeshletOffset + meshlet].IndexOffset, i);
+        }
+
+        vertex_offset += (uint32_t) vertex_collection[i].size();
+        index_offset += (uint32_t) index_collection[i].size();
+        meshlet_offset += mesh.MeshletCount;
+    }
+    EXPECT_EQ(asset.Vertices.size(), vertex_offset);
+    EXPECT_EQ(asset.Indices.size(), index_offset);
+    EXPECT_EQ(asset.Meshlets.size(), meshlet_offset);
+}
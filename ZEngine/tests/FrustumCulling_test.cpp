@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <random>
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/gtc/matrix_transform.hpp>
+#include <Helpers/FrustumCulling.h>
+
+using namespace ZEngine::Helpers;
+
+/*
+ * Camera at the origin looking down -Z, 90 degrees field of view, depth range [0.1, 100]
+ */
+static Frustum GetCameraFrustum()
+{
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+    return ExtractFrustum(projection * view);
+}
+
+static AABB MakeBox(const glm::vec3& center, float half_size)
+{
+    return {.Min = center - glm::vec3(half_size), .Max = center + glm::vec3(half_size)};
+}
+
+TEST(FrustumCullingTest, CullsBoxesOutsideOfTheFrustum)
+{
+    const Frustum frustum = GetCameraFrustum();
+
+    const AABB bounds[] = {
+        MakeBox(glm::vec3(0.0f, 0.0f, -10.0f), 1.0f),   // in front
+        MakeBox(glm::vec3(0.0f, 0.0f, 10.0f), 1.0f),    // behind
+        MakeBox(glm::vec3(-30.0f, 0.0f, -10.0f), 1.0f), // left of the frustum
+        MakeBox(glm::vec3(0.0f, 0.0f, -200.0f), 1.0f),  // beyond the far plane
+        MakeBox(glm::vec3(10.5f, 0.0f, -10.0f), 1.0f),  // crossing the right plane
+    };
+    uint8_t visibility[5] = {};
+
+    EXPECT_EQ(CullAABBBatch(SimdBackend::SCALAR, frustum, bounds, 5, visibility), 2u);
+    EXPECT_EQ(visibility[0], 1);
+    EXPECT_EQ(visibility[1], 0);
+    EXPECT_EQ(visibility[2], 0);
+    EXPECT_EQ(visibility[3], 0);
+    EXPECT_EQ(visibility[4], 1);
+}
+
+TEST(FrustumCullingTest, SimdBackendsMatchScalar)
+{
+    const Frustum frustum = GetCameraFrustum();
+
+    std::mt19937                          generator(42);
+    std::uniform_real_distribution<float> position(-150.0f, 150.0f);
+    std::uniform_real_distribution<float> size(0.1f, 5.0f);
+
+    /*
+     * The count is not a multiple of the SIMD width so that the scalar tail is exercised too
+     */
+    std::vector<AABB> bounds(10'003);
+    for (auto& box : bounds)
+    {
+        box = MakeBox(glm::vec3(position(generator), position(generator), position(generator)), size(generator));
+    }
+
+    std::vector<uint8_t> expected(bounds.size());
+    const uint32_t       expected_count = CullAABBBatch(SimdBackend::SCALAR, frustum, bounds.data(), bounds.size(), expected.data());
+
+    for (auto backend : {SimdBackend::SSE4, SimdBackend::AVX2})
+    {
+        if (!IsSimdBackendSupported(backend))
+        {
+            continue;
+        }
+
+        std::vector<uint8_t> visibility(bounds.size());
+        EXPECT_EQ(CullAABBBatch(backend, frustum, bounds.data(), bounds.size(), visibility.data()), expected_count);
+        EXPECT_EQ(visibility, expected);
+    }
+}
+
+TEST(FrustumCullingTest, CullsSpheresOutsideOfTheFrustum)
+{
+    const Frustum frustum = GetCameraFrustum();
+
+    EXPECT_TRUE(IsSphereVisible(frustum, glm::vec3(0.0f, 0.0f, -10.0f), 1.0f));
+    EXPECT_FALSE(IsSphereVisible(frustum, glm::vec3(0.0f, 0.0f, 10.0f), 1.0f));
+    EXPECT_FALSE(IsSphereVisible(frustum, glm::vec3(0.0f, 0.0f, -200.0f), 1.0f));
+    EXPECT_TRUE(IsSphereVisible(frustum, glm::vec3(10.5f, 0.0f, -10.0f), 1.0f));
+    EXPECT_FALSE(IsSphereVisible(frustum, glm::vec3(12.0f, 0.0f, -10.0f), 1.0f));
+}
@@ -0,0 +1,605 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <Rendering/Scenes/GraphicScene.h>
+#include <Rendering/Components/NameComponent.h>
+#include <Rendering/Components/UUIComponent.h>
+
+using namespace ZEngine::Rendering::Scenes;
+
+class GraphicSceneTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GraphicScene::Initialize();
+    }
+
+    static glm::vec3 GetGlobalTranslation(int32_t node)
+    {
+        return glm::vec3(GraphicScene::GetSceneNodeGlobalTransform(node)[3]);
+    }
+
+    /*
+     * Scene holding `cube_count` instances of a [-1, 1] cube mesh named cube_<i>, lined up along x every 3 units under a root node
+     */
+    static ZEngine::Ref<Scene> CreateCubeRowScene(uint32_t cube_count)
+    {
+        CookedAssetData asset;
+        for (uint32_t corner = 0; corner < 8; ++corner)
+        {
+            const glm::vec3 p((corner & 1) ? 1.0f : -1.0f, (corner & 2) ? 1.0f : -1.0f, (corner & 4) ? 1.0f : -1.0f);
+            asset.Vertices.insert(asset.Vertices.end(), {p.x, p.y, p.z, p.x, p.y, p.z, 0.0f, 0.0f});
+        }
+        asset.Indices = {0, 1, 3, 0, 3, 2, 4, 5, 7, 4, 7, 6, 0, 2, 6, 0, 6, 4, 1, 3, 7, 1, 7, 5, 0, 1, 5, 0, 5, 4, 2, 3, 7, 2, 7, 6};
+        asset.Meshes.push_back(
+            {.VertexOffset = 0, .VertexCount = 8, .IndexOffset = 0, .IndexCount = 36, .Material = 0, .LocalBounds = {.Min = glm::vec3(-1.0f), .Max = glm::vec3(1.0f)}});
+        asset.Materials.push_back({});
+        asset.MaterialNames.push_back(asset.AddString("cube"));
+
+        asset.Nodes.push_back({.Parent = -1, .DepthLevel = 0, .Name = asset.AddString("cube_row")});
+        asset.LocalTransforms.emplace_back(1.0f);
+        for (uint32_t i = 0; i < cube_count; ++i)
+        {
+            asset.Nodes.push_back({.Parent = 0, .DepthLevel = 1, .Mesh = 0, .Name = asset.AddString("cube_" + std::to_string(i))});
+            asset.LocalTransforms.push_back(glm::translate(glm::mat4(1.0f), glm::vec3(3.0f * i, 0.0f, 0.0f)));
+        }
+
+        auto scene = ZEngine::CreateRef<Scene>();
+        scene->Initialize();
+        scene->ImportCookedAsset(asset.GetView());
+        scene->ComputeAllTransforms();
+        return scene;
+    }
+};
+
+TEST_F(GraphicSceneTest, ComputeAllTransformsPropagatesToWholeSubtree)
+{
+    const glm::mat4 unit_translation = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+
+    int32_t root        = GraphicScene::AddNodeAsync(-1, 0).get();
+    int32_t child       = GraphicScene::AddNodeAsync(root, 1).get();
+    int32_t sibling     = GraphicScene::AddNodeAsync(root, 1).get();
+    int32_t grand_child = GraphicScene::AddNodeAsync(child, 2).get();
+    int32_t leaf        = GraphicScene::AddNodeAsync(grand_child, 3).get();
+
+    for (int32_t node : {root, child, sibling, grand_child, leaf})
+    {
+        GraphicScene::SetSceneNodeLocalTransform(node, unit_translation);
+    }
+    GraphicScene::ComputeAllTransforms();
+
+    EXPECT_EQ(GetGlobalTranslation(root), glm::vec3(1.0f, 0.0f, 0.0f));
+    EXPECT_EQ(GetGlobalTranslation(sibling), glm::vec3(2.0f, 0.0f, 0.0f));
+    EXPECT_EQ(GetGlobalTranslation(leaf), glm::vec3(4.0f, 0.0f, 0.0f));
+
+    /*
+     * Moving the root must update every descendant, not only its direct children
+     */
+    GraphicScene::SetSceneNodeLocalTransform(root, glm::translate(glm::mat4(1.0f), glm::vec3(10.0f, 0.0f, 0.0f)));
+    GraphicScene::ComputeAllTransforms();
+
+    EXPECT_EQ(GetGlobalTranslation(child), glm::vec3(11.0f, 0.0f, 0.0f));
+    EXPECT_EQ(GetGlobalTranslation(grand_child), glm::vec3(12.0f, 0.0f, 0.0f));
+    EXPECT_EQ(GetGlobalTranslation(leaf), glm::vec3(13.0f, 0.0f, 0.0f));
+}
+
+TEST_F(GraphicSceneTest, ComputeAllTransformsOnlyTouchesDirtySubtree)
+{
+    int32_t root   = GraphicScene::AddNodeAsync(-1, 0).get();
+    int32_t first  = GraphicScene::AddNodeAsync(root, 1).get();
+    int32_t second = GraphicScene::AddNodeAsync(root, 1).get();
+    GraphicScene::ComputeAllTransforms();
+
+    /*
+     * Changing a local transform without marking the node leaves the global transform untouched
+     */
+    GraphicScene::GetRawData()->LocalTransformCollection[second] = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 5.0f, 0.0f));
+    GraphicScene::SetSceneNodeLocalTransform(first, glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 3.0f, 0.0f)));
+    GraphicScene::ComputeAllTransforms();
+
+    EXPECT_EQ(GetGlobalTranslation(first), glm::vec3(0.0f, 3.0f, 0.0f));
+    EXPECT_EQ(GetGlobalTranslation(second), glm::vec3(0.0f, 0.0f, 0.0f));
+}
+
+TEST_F(GraphicSceneTest, ReorderSceneNodesBreadthFirstKeepsNodeData)
+{
+    /*
+     * Depth-first creation : root -> first -> first_child, then root -> second
+     */
+    int32_t root        = GraphicScene::AddNodeAsync(-1, 0).get();
+    int32_t first       = GraphicScene::AddNodeAsync(root, 1).get();
+    int32_t first_child = GraphicScene::AddNodeAsync(first, 2).get();
+    int32_t second      = GraphicScene::AddNodeAsync(root, 1).get();
+
+    GraphicScene::SetSceneNodeNameAsync(first_child, "first_child").get();
+    GraphicScene::SetSceneNodeLocalTransform(second, glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, 7.0f)));
+    auto first_child_entity = GraphicScene::GetSceneNodeEntityWrapper(first_child);
+
+    auto node_remap = GraphicScene::ReorderSceneNodesBreadthFirst();
+
+    const auto& hierarchy_collection = GraphicScene::GetRawData()->NodeHierarchyCollection;
+    for (int32_t node = 0; node < hierarchy_collection.size(); ++node)
+    {
+        EXPECT_LT(hierarchy_collection[node].Parent, node);
+    }
+
+    EXPECT_LT(node_remap[second], node_remap[first_child]);
+    EXPECT_EQ(GraphicScene::GetSceneNodeParent(node_remap[first_child]), node_remap[first]);
+    EXPECT_EQ(GraphicScene::GetSceneNodeName(node_remap[first_child]), "first_child");
+    /*
+     * Renaming the entity renames the node it moved to
+     */
+    EXPECT_TRUE(GraphicScene::RenameEntityAsync(first_child_entity, "renamed_first_child").get());
+    EXPECT_EQ(GraphicScene::GetSceneNodeName(node_remap[first_child]), "renamed_first_child");
+
+    GraphicScene::ComputeAllTransforms();
+    EXPECT_EQ(GetGlobalTranslation(node_remap[second]), glm::vec3(0.0f, 0.0f, 7.0f));
+}
+
+TEST_F(GraphicSceneTest, AddNodesAsyncAppendsChildrenInOrder)
+{
+    int32_t root  = GraphicScene::AddNodeAsync(-1, 0).get();
+    int32_t first = GraphicScene::AddNodeAsync(root, 1).get();
+    int32_t bulk  = GraphicScene::AddNodesAsync(root, 1, 3).get();
+
+    const auto& hierarchy = GraphicScene::GetSceneNodeHierarchy(root);
+    EXPECT_EQ(hierarchy.ChildCount, 4);
+    EXPECT_EQ(hierarchy.FirstChild, first);
+    EXPECT_EQ(hierarchy.LastChild, bulk + 2);
+
+    auto sibling_collection = GraphicScene::GetSceneNodeSiblingCollection(first);
+    EXPECT_EQ(sibling_collection, (std::vector<int32_t>{bulk, bulk + 1, bulk + 2}));
+}
+
+TEST_F(GraphicSceneTest, RemoveNodeAsyncReusesSlotsUntilCompaction)
+{
+    int32_t root          = GraphicScene::AddNodeAsync(-1, 0).get();
+    int32_t first         = GraphicScene::AddNodeAsync(root, 1).get();
+    int32_t removed       = GraphicScene::AddNodeAsync(root, 1).get();
+    int32_t removed_child = GraphicScene::AddNodeAsync(removed, 2).get();
+    int32_t last          = GraphicScene::AddNodeAsync(root, 1).get();
+
+    EXPECT_TRUE(GraphicScene::RemoveNodeAsync(removed).get());
+    EXPECT_FALSE(GraphicScene::RemoveNodeAsync(removed_child).get());
+
+    const auto& hierarchy = GraphicScene::GetSceneNodeHierarchy(root);
+    EXPECT_EQ(hierarchy.ChildCount, 2);
+    EXPECT_EQ(GraphicScene::GetSceneNodeSiblingCollection(first), (std::vector<int32_t>{last}));
+    /*
+     * The next added node lands in one of the released slots
+     */
+    int32_t reused = GraphicScene::AddNodeAsync(last, 2).get();
+    EXPECT_TRUE((reused == removed) || (reused == removed_child));
+    EXPECT_EQ(GraphicScene::GetSceneNodeParent(reused), last);
+
+    GraphicScene::SetSceneNodeLocalTransform(last, glm::translate(glm::mat4(1.0f), glm::vec3(2.0f, 0.0f, 0.0f)));
+
+    auto node_remap = GraphicScene::CompactScene();
+    EXPECT_EQ(node_remap[(reused == removed) ? removed_child : removed], -1);
+    EXPECT_EQ(GraphicScene::GetSceneNodeParent(node_remap[reused]), node_remap[last]);
+    EXPECT_TRUE(GraphicScene::GetRawData()->FreeSceneNodeCollection.empty());
+
+    GraphicScene::ComputeAllTransforms();
+    EXPECT_EQ(GetGlobalTranslation(node_remap[reused]), glm::vec3(2.0f, 0.0f, 0.0f));
+}
+
+TEST_F(GraphicSceneTest, AcquiredSnapshotIsNotAffectedByLaterChanges)
+{
+    int32_t root = GraphicScene::AddNodeAsync(-1, 0).get();
+    GraphicScene::SetSceneNodeNameAsync(root, "snapshot_root").get();
+
+    EXPECT_TRUE(GraphicScene::TryPublishSnapshot());
+    auto snapshot = GraphicScene::AcquireSnapshot();
+    EXPECT_EQ(snapshot.get(), GraphicScene::GetSnapshot().get());
+    EXPECT_EQ(snapshot->Hierarchy->SceneNodeNameCollection[root], "snapshot_root");
+
+    const uint32_t node_count = snapshot->Hierarchy->NodeHierarchyCollection.size();
+    GraphicScene::AddNodeAsync(root, 1).get();
+    GraphicScene::SetSceneNodeNameAsync(root, "renamed_root").get();
+    /*
+     * Nothing is swapped in until the next publication reaches the frame boundary
+     */
+    EXPECT_EQ(GraphicScene::AcquireSnapshot().get(), snapshot.get());
+
+    EXPECT_TRUE(GraphicScene::TryPublishSnapshot());
+    auto next_snapshot = GraphicScene::AcquireSnapshot();
+    EXPECT_NE(next_snapshot.get(), snapshot.get());
+    EXPECT_EQ(next_snapshot->Geometry.get(), snapshot->Geometry.get());
+    EXPECT_EQ(next_snapshot->Hierarchy->SceneNodeNameCollection[root], "renamed_root");
+
+    EXPECT_EQ(snapshot->Hierarchy->NodeHierarchyCollection.size(), node_count);
+    EXPECT_EQ(snapshot->Hierarchy->SceneNodeNameCollection[root], "snapshot_root");
+}
+
+TEST_F(GraphicSceneTest, PendingSceneIsActivatedAtFrameBoundary)
+{
+    auto previous_scene = GraphicScene::GetActiveScene();
+    EXPECT_TRUE(previous_scene->TryPublishSnapshot());
+    /*
+     * Plays the renderer, holding the snapshot of the scene being replaced
+     */
+    auto previous_snapshot = previous_scene->AcquireSnapshot();
+
+    auto next_scene = ZEngine::CreateRef<Scene>();
+    next_scene->Initialize();
+    int32_t root = next_scene->AddNodeAsync(-1, 0).get();
+    next_scene->SetSceneNodeNameAsync(root, "next_scene_root").get();
+    EXPECT_TRUE(next_scene->TryPublishSnapshot());
+
+    /*
+     * Scenes don't share node storage
+     */
+    EXPECT_EQ(next_scene->GetRootSceneNodes().size(), 1u);
+    EXPECT_NE(previous_scene->GetRawData().get(), next_scene->GetRawData().get());
+
+    GraphicScene::SetPendingScene(next_scene);
+    EXPECT_EQ(GraphicScene::GetActiveScene().get(), previous_scene.get());
+
+    EXPECT_TRUE(GraphicScene::ActivatePendingScene());
+    EXPECT_FALSE(GraphicScene::ActivatePendingScene());
+    EXPECT_EQ(GraphicScene::GetActiveScene().get(), next_scene.get());
+    EXPECT_EQ(GraphicScene::AcquireSnapshot()->Hierarchy->SceneNodeNameCollection[root], "next_scene_root");
+    /*
+     * The replaced scene is kept until the snapshot is released, then deinitialized at the next frame boundary
+     */
+    const int previous_scene_reference_count = previous_scene->RefCount();
+    EXPECT_FALSE(GraphicScene::ActivatePendingScene());
+    EXPECT_EQ(previous_scene->RefCount(), previous_scene_reference_count);
+
+    previous_snapshot = nullptr;
+    EXPECT_FALSE(GraphicScene::ActivatePendingScene());
+    EXPECT_EQ(previous_scene->RefCount(), previous_scene_reference_count - 1);
+}
+
+TEST_F(GraphicSceneTest, EntityIndicesFollowCreateRenameAndRemove)
+{
+    using namespace ZEngine::Rendering::Components;
+
+    const auto uuid = uuids::uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+    auto first  = GraphicScene::CreateEntityAsync(uuid, "indexed_entity").get();
+    auto second = GraphicScene::CreateEntityAsync("indexed_entity").get();
+
+    EXPECT_EQ(GraphicScene::GetEntitiesAsync("indexed_entity").get().size(), 2u);
+    EXPECT_TRUE(GraphicScene::GetEntityAsync(uuid).get() == first);
+    EXPECT_EQ(first.GetComponent<UUIComponent>().Identifier, uuid);
+
+    EXPECT_TRUE(GraphicScene::RenameEntityAsync(second, "renamed_entity").get());
+    EXPECT_EQ(second.GetComponent<NameComponent>().Name, "renamed_entity");
+    EXPECT_TRUE(GraphicScene::GetEntityAsync("renamed_entity").get() == second);
+    ASSERT_EQ(GraphicScene::GetEntitiesAsync("indexed_entity").get().size(), 1u);
+    EXPECT_TRUE(GraphicScene::GetEntityAsync("indexed_entity").get() == first);
+
+    const int32_t first_node = GraphicScene::GetRawData()->EntityNodeIndex.at(first);
+    EXPECT_TRUE(GraphicScene::RemoveEntityAsync(first).get());
+    EXPECT_TRUE(GraphicScene::GetEntitiesAsync("indexed_entity").get().empty());
+    EXPECT_EQ(GraphicScene::GetRawData()->EntityUUIDIndex.count(uuid), 0u);
+    /*
+     * The scene node of the entity is released with it
+     */
+    EXPECT_EQ(GraphicScene::GetSceneNodeHierarchy(first_node).DepthLevel, -1);
+    EXPECT_FALSE(GraphicScene::IsSceneNodeAlive(first_node));
+    /*
+     * A stale identifier, e.g an editor selection, doesn't write into the released slot
+     */
+    GraphicScene::SetSceneNodeLocalTransform(first_node, glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 0.0f, 0.0f)));
+    EXPECT_EQ(GraphicScene::GetSceneNodeLocalTransform(first_node), glm::mat4(1.0f));
+    EXPECT_EQ(GraphicScene::GetRawData()->EntityNodeIndex.count(first), 0u);
+    EXPECT_FALSE(GraphicScene::RemoveNodeAsync(first_node).get());
+}
+
+TEST_F(GraphicSceneTest, ImportCookedAssetKeepsExistingNodeIdentifiers)
+{
+    auto scene = ZEngine::CreateRef<Scene>();
+    scene->Initialize();
+    /*
+     * Depth-first creation, which a breadth-first renumbering of the whole scene would reorder
+     */
+    int32_t root        = scene->AddNodeAsync(-1, 0).get();
+    int32_t first       = scene->AddNodeAsync(root, 1).get();
+    int32_t first_child = scene->AddNodeAsync(first, 2).get();
+    int32_t second      = scene->AddNodeAsync(root, 1).get();
+    scene->SetSceneNodeNameAsync(first_child, "existing_node").get();
+    const auto entity = scene->GetSceneNodeEntityWrapper(first_child);
+
+    CookedAssetData asset;
+    asset.Nodes = {
+        {.Parent = -1, .DepthLevel = 0, .Name = asset.AddString("asset_root")},
+        {.Parent = 0, .DepthLevel = 1, .Name = asset.AddString("asset_first")},
+        {.Parent = 1, .DepthLevel = 2, .Name = asset.AddString("asset_first_child")},
+        {.Parent = 0, .DepthLevel = 1, .Name = asset.AddString("asset_second")}};
+    asset.LocalTransforms.assign(asset.Nodes.size(), glm::mat4(1.0f));
+    scene->ImportCookedAsset(asset.GetView());
+
+    EXPECT_EQ(scene->GetSceneNodeName(first_child), "existing_node");
+    EXPECT_TRUE(scene->GetSceneNodeEntityWrapper(first_child) == entity);
+    EXPECT_EQ(scene->GetSceneNodeParent(first_child), first);
+    EXPECT_EQ(scene->GetSceneNodeParent(second), root);
+    /*
+     * Asset nodes take the slots after the existing ones, renumbered breadth-first
+     */
+    const auto& name_collection = scene->GetRawData()->SceneNodeNameCollection;
+    EXPECT_EQ(name_collection[second + 1], "asset_root");
+    EXPECT_EQ(name_collection[second + 2], "asset_first");
+    EXPECT_EQ(name_collection[second + 3], "asset_second");
+    EXPECT_EQ(name_collection[second + 4], "asset_first_child");
+    EXPECT_EQ(scene->GetSceneNodeParent(second + 4), second + 2);
+}
+
+TEST_F(GraphicSceneTest, BatchedRaycastMatchesSingleRaycasts)
+{
+    const uint32_t cube_count = 64;
+    for (uint32_t worker_count : {1u, 4u})
+    {
+        SCOPED_TRACE(worker_count);
+        auto scene = CreateCubeRowScene(cube_count);
+        scene->SetSpatialQueryWorkerCount(worker_count);
+        /*
+         * Rays facing each cube hit its front face 9 units away, rays between two cubes miss
+         */
+        std::vector<ZEngine::Helpers::Ray> rays;
+        for (uint32_t i = 0; i < cube_count; ++i)
+        {
+            rays.push_back({.Origin = glm::vec3((3.0f * i) + 0.25f, 0.5f, 10.0f), .Direction = glm::vec3(0.0f, 0.0f, -1.0f)});
+            rays.push_back({.Origin = glm::vec3((3.0f * i) + 1.5f, 0.0f, 10.0f), .Direction = glm::vec3(0.0f, 0.0f, -1.0f)});
+        }
+        /*
+         * No triangle hierarchy exists before the first raycast : the batch flags them, builds them and casts its rays again
+         */
+        const auto& hierarchy_collection = scene->GetRawData()->MeshTriangleHierarchyCollection;
+        ASSERT_EQ(hierarchy_collection.size(), cube_count);
+        EXPECT_TRUE(std::none_of(hierarchy_collection.begin(), hierarchy_collection.end(), [](const auto& hierarchy) { return !!hierarchy; }));
+
+        std::vector<SceneRaycastHit> hits(rays.size());
+        scene->RaycastSceneNodes(rays.data(), (uint32_t) rays.size(), hits.data());
+
+        for (const auto& hierarchy : hierarchy_collection)
+        {
+            EXPECT_EQ(hierarchy.get(), hierarchy_collection[0].get());
+        }
+        ASSERT_TRUE(hierarchy_collection[0]);
+
+        for (uint32_t i = 0; i < rays.size(); ++i)
+        {
+            const auto& hit = hits[i];
+            if ((i % 2) == 0)
+            {
+                ASSERT_NE(hit.SceneNode, -1);
+                EXPECT_EQ(scene->GetSceneNodeName(hit.SceneNode), "cube_" + std::to_string(i / 2));
+                EXPECT_FLOAT_EQ(hit.Distance, 9.0f);
+            }
+            else
+            {
+                EXPECT_EQ(hit.SceneNode, -1);
+            }
+            /*
+             * Single raycasts find every hierarchy built and take a single pass
+             */
+            const auto single_hit = scene->RaycastSceneNodes(rays[i]);
+            EXPECT_EQ(single_hit.SceneNode, hit.SceneNode);
+            EXPECT_EQ(single_hit.Triangle, hit.Triangle);
+            EXPECT_FLOAT_EQ(single_hit.Distance, hit.Distance);
+        }
+    }
+}
+
+TEST_F(GraphicSceneTest, BatchedOverlapQueriesMatchSingleQueries)
+{
+    const uint32_t cube_count = 64;
+    for (uint32_t worker_count : {1u, 4u})
+    {
+        SCOPED_TRACE(worker_count);
+        auto scene = CreateCubeRowScene(cube_count);
+        scene->SetSpatialQueryWorkerCount(worker_count);
+        /*
+         * For each cube : bounds inside it, bounds spanning the gap to the next cube and bounds above the row
+         */
+        std::vector<ZEngine::Helpers::AABB> bounds;
+        for (uint32_t i = 0; i < cube_count; ++i)
+        {
+            const float x = 3.0f * i;
+            bounds.push_back({.Min = glm::vec3(x - 0.5f, -0.5f, -0.5f), .Max = glm::vec3(x + 0.5f, 0.5f, 0.5f)});
+            bounds.push_back({.Min = glm::vec3(x + 0.5f, -0.5f, -0.5f), .Max = glm::vec3(x + 2.5f, 0.5f, 0.5f)});
+            bounds.push_back({.Min = glm::vec3(x - 0.5f, 5.0f, -0.5f), .Max = glm::vec3(x + 0.5f, 6.0f, 0.5f)});
+        }
+
+        const auto result = scene->QuerySceneNodesInBounds(bounds.data(), (uint32_t) bounds.size());
+        ASSERT_EQ(result.QueryOffsets.size(), bounds.size() + 1);
+        EXPECT_EQ(result.QueryOffsets.front(), 0u);
+        EXPECT_EQ(result.QueryOffsets.back(), result.SceneNodes.size());
+
+        for (uint32_t i = 0; i < bounds.size(); ++i)
+        {
+            ASSERT_LE(result.QueryOffsets[i], result.QueryOffsets[i + 1]);
+            std::vector<int32_t> scene_nodes(result.SceneNodes.begin() + result.QueryOffsets[i], result.SceneNodes.begin() + result.QueryOffsets[i + 1]);
+            std::vector<int32_t> single_scene_nodes = scene->QuerySceneNodesInBounds(bounds[i]);
+            std::sort(scene_nodes.begin(), scene_nodes.end());
+            std::sort(single_scene_nodes.begin(), single_scene_nodes.end());
+            EXPECT_EQ(scene_nodes, single_scene_nodes);
+
+            const uint32_t cube              = i / 3;
+            const size_t   expected_overlaps = ((i % 3) == 0) ? 1 : ((i % 3) == 1) ? ((cube + 1) < cube_count ? 2 : 1) : 0;
+            EXPECT_EQ(scene_nodes.size(), expected_overlaps);
+        }
+    }
+}
+
+TEST_F(GraphicSceneTest, BatchedNearestQueriesMatchSingleQueries)
+{
+    const uint32_t cube_count   = 64;
+    const float    max_distance = 10.0f;
+    for (uint32_t worker_count : {1u, 4u})
+    {
+        SCOPED_TRACE(worker_count);
+        auto scene = CreateCubeRowScene(cube_count);
+        scene->SetSpatialQueryWorkerCount(worker_count);
+        /*
+         * Points one unit in front of each cube, and points further than the maximum distance above the row
+         */
+        std::vector<glm::vec3> points;
+        for (uint32_t i = 0; i < cube_count; ++i)
+        {
+            points.emplace_back(3.0f * i, 0.0f, 2.0f);
+            points.emplace_back(3.0f * i, 50.0f, 0.0f);
+        }
+
+        std::vector<SceneNearestHit> hits(points.size());
+        scene->QueryNearestSceneNodes(points.data(), (uint32_t) points.size(), max_distance, hits.data());
+
+        for (uint32_t i = 0; i < points.size(); ++i)
+        {
+            const auto& hit = hits[i];
+            if ((i % 2) == 0)
+            {
+                ASSERT_NE(hit.SceneNode, -1);
+                EXPECT_EQ(scene->GetSceneNodeName(hit.SceneNode), "cube_" + std::to_string(i / 2));
+                EXPECT_FLOAT_EQ(hit.Distance, 1.0f);
+            }
+            else
+            {
+                EXPECT_EQ(hit.SceneNode, -1);
+            }
+
+            SceneNearestHit single_hit = {};
+            scene->QueryNearestSceneNodes(&points[i], 1, max_distance, &single_hit);
+            EXPECT_EQ(single_hit.SceneNode, hit.SceneNode);
+            EXPECT_FLOAT_EQ(single_hit.Distance, hit.Distance);
+        }
+    }
+}
+
+TEST_F(GraphicSceneTest, ImportedMeshInstancesShareOneGeometryRange)
+{
+    auto        scene    = CreateCubeRowScene(3);
+    const auto& raw_data = *scene->GetRawData();
+    /*
+     * The scene holds a single copy of the cube geometry, which every instance references
+     */
+    ASSERT_EQ(raw_data.MeshCollection.size(), 3u);
+    EXPECT_EQ(raw_data.Vertices.size(), 8u * 8u);
+    EXPECT_EQ(raw_data.Indices.size(), 36u);
+    for (const auto& mesh : raw_data.MeshCollection)
+    {
+        EXPECT_EQ(mesh.VertexOffset, raw_data.MeshCollection[0].VertexOffset);
+        EXPECT_EQ(mesh.VertexCount, 8u);
+        EXPECT_EQ(mesh.IndexOffset, raw_data.MeshCollection[0].IndexOffset);
+        EXPECT_EQ(mesh.IndexCount, 36u);
+        EXPECT_EQ(mesh.TotalByteSize, (8u * 8u * sizeof(float)) + (36u * sizeof(uint32_t)));
+    }
+}
+
+TEST_F(GraphicSceneTest, ChunkedImportMatchesSingleChunkImport)
+{
+    /*
+     * Root -> 8 groups -> 4 mesh nodes each. Meshes are referenced first by the children of the first group, in order, so that small
+     * chunks append the geometry mesh after mesh
+     */
+    CookedAssetData asset;
+    for (uint32_t mesh = 0; mesh < 4; ++mesh)
+    {
+        const uint32_t vertex_count = 3 * (mesh + 1);
+        asset.Meshes.push_back(
+            {.VertexOffset = (uint32_t) asset.Vertices.size(),
+             .VertexCount  = vertex_count,
+             .IndexOffset  = (uint32_t) asset.Indices.size(),
+             .IndexCount   = vertex_count,
+             .Material     = mesh % 2,
+             .LocalBounds  = {.Min = glm::vec3(-1.0f), .Max = glm::vec3(1.0f)}});
+        for (uint32_t i = 0; i < (vertex_count * 8); ++i)
+        {
+            asset.Vertices.push_back((float) ((mesh * 100) + i));
+        }
+        for (uint32_t i = 0; i < vertex_count; ++i)
+        {
+            asset.Indices.push_back(vertex_count - 1 - i);
+        }
+    }
+    for (uint32_t material = 0; material < 2; ++material)
+    {
+        ZEngine::Rendering::Meshes::MeshMaterial cooked_material = {};
+        cooked_material.MetallicFactor                           = 0.25f * (material + 1);
+        asset.Materials.push_back(cooked_material);
+        asset.MaterialNames.push_back(asset.AddString("material_" + std::to_string(material)));
+    }
+
+    asset.Nodes.push_back({.Parent = -1, .DepthLevel = 0, .Name = asset.AddString("root")});
+    asset.LocalTransforms.emplace_back(1.0f);
+    for (int32_t group = 0; group < 8; ++group)
+    {
+        const auto group_node = (int32_t) asset.Nodes.size();
+        asset.Nodes.push_back({.Parent = 0, .DepthLevel = 1, .Name = asset.AddString("group_" + std::to_string(group))});
+        asset.LocalTransforms.push_back(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, (float) group, 0.0f)));
+        for (int32_t child = 0; child < 4; ++child)
+        {
+            asset.Nodes.push_back({.Parent = group_node, .DepthLevel = 2, .Mesh = (group + child) % 4, .Name = asset.AddString("mesh_node_" + std::to_string(child))});
+            asset.LocalTransforms.push_back(glm::translate(glm::mat4(1.0f), glm::vec3((float) child, 0.0f, 0.0f)));
+        }
+    }
+
+    auto import_scene = [&](uint32_t chunk_node_count) {
+        auto scene = ZEngine::CreateRef<Scene>();
+        scene->Initialize();
+        scene->SetImportChunkNodeCount(chunk_node_count);
+        scene->ImportCookedAsset(asset.GetView());
+        scene->ComputeAllTransforms();
+        scene->PublishSnapshot();
+        scene->AcquireSnapshot();
+        return scene;
+    };
+    /*
+     * A first chunk of one node splits the import in six published chunks, the other import takes a single chunk
+     */
+    auto chunked_scene = import_scene(1);
+    auto single_scene  = import_scene(1024);
+
+    const auto& chunked = *chunked_scene->GetRawData();
+    const auto& single  = *single_scene->GetRawData();
+    ASSERT_EQ(chunked.NodeHierarchyCollection.size(), asset.Nodes.size());
+    ASSERT_EQ(chunked.NodeHierarchyCollection.size(), single.NodeHierarchyCollection.size());
+    for (uint32_t node = 0; node < chunked.NodeHierarchyCollection.size(); ++node)
+    {
+        SCOPED_TRACE(node);
+        const auto& chunked_hierarchy = chunked.NodeHierarchyCollection[node];
+        const auto& single_hierarchy  = single.NodeHierarchyCollection[node];
+        EXPECT_EQ(chunked_hierarchy.Parent, single_hierarchy.Parent);
+        EXPECT_EQ(chunked_hierarchy.FirstChild, single_hierarchy.FirstChild);
+        EXPECT_EQ(chunked_hierarchy.LastChild, single_hierarchy.LastChild);
+        EXPECT_EQ(chunked_hierarchy.RightSibling, single_hierarchy.RightSibling);
+        EXPECT_EQ(chunked_hierarchy.DepthLevel, single_hierarchy.DepthLevel);
+        EXPECT_EQ(chunked_hierarchy.ChildCount, single_hierarchy.ChildCount);
+        EXPECT_EQ(chunked.SceneNodeNameCollection[node], single.SceneNodeNameCollection[node]);
+        EXPECT_TRUE(chunked.LocalTransformCollection[node] == single.LocalTransformCollection[node]);
+        EXPECT_TRUE(chunked.GlobalTransformCollection[node] == single.GlobalTransformCollection[node]);
+        EXPECT_EQ(chunked.SceneNodeMeshIndexCollection[node], single.SceneNodeMeshIndexCollection[node]);
+    }
+
+    EXPECT_EQ(chunked.Vertices, single.Vertices);
+    EXPECT_EQ(chunked.Indices, single.Indices);
+    EXPECT_EQ(chunked.Vertices.size(), asset.Vertices.size());
+    EXPECT_EQ(chunked.MeshMaterialIndexCollection, single.MeshMaterialIndexCollection);
+    ASSERT_EQ(chunked.MeshCollection.size(), single.MeshCollection.size());
+    for (uint32_t mesh_slot = 0; mesh_slot < chunked.MeshCollection.size(); ++mesh_slot)
+    {
+        SCOPED_TRACE(mesh_slot);
+        const auto& chunked_mesh = chunked.MeshCollection[mesh_slot];
+        const auto& single_mesh  = single.MeshCollection[mesh_slot];
+        EXPECT_EQ(chunked_mesh.VertexOffset, single_mesh.VertexOffset);
+        EXPECT_EQ(chunked_mesh.VertexCount, single_mesh.VertexCount);
+        EXPECT_EQ(chunked_mesh.IndexOffset, single_mesh.IndexOffset);
+        EXPECT_EQ(chunked_mesh.IndexCount, single_mesh.IndexCount);
+        EXPECT_EQ(chunked_mesh.TotalByteSize, single_mesh.TotalByteSize);
+        EXPECT_EQ(chunked.MaterialCollection[chunked.MeshMaterialIndexCollection[mesh_slot]].MetallicFactor,
+                  single.MaterialCollection[single.MeshMaterialIndexCollection[mesh_slot]].MetallicFactor);
+    }
+    /*
+     * The last published snapshot describes the same scene
+     */
+    const auto chunked_snapshot = chunked_scene->GetSnapshot();
+    const auto single_snapshot  = single_scene->GetSnapshot();
+    EXPECT_EQ(chunked_snapshot->Hierarchy->SceneNodeNameCollection, single_snapshot->Hierarchy->SceneNodeNameCollection);
+    EXPECT_EQ(chunked_snapshot->Hierarchy->RootSceneNodeCollection, single_snapshot->Hierarchy->RootSceneNodeCollection);
+    EXPECT_EQ(chunked_snapshot->Geometry->VertexFloatCount, single_snapshot->Geometry->VertexFloatCount);
+    EXPECT_EQ(chunked_snapshot->Geometry->IndexCount, single_snapshot->Geometry->IndexCount);
+    EXPECT_EQ(chunked_snapshot->Geometry->MeshMaterialIndexCollection, single_snapshot->Geometry->MeshMaterialIndexCollection);
+    EXPECT_EQ(chunked_snapshot->MeshTransformCollection.size(), single_snapshot->MeshTransformCollection.size());
+}
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <Rendering/Meshes/IndexPacking.h>
+
+using namespace ZEngine::Rendering::Meshes;
+
+TEST(IndexPackingTest, PacksTwoIndicesPerWord)
+{
+    std::mt19937                            generator(3);
+    std::uniform_int_distribution<uint32_t> index(0, MAX_UINT16_INDEX_VERTEX_COUNT - 1);
+    for (uint32_t index_count : {0u, 1u, 3u, 6u, 1001u})
+    {
+        std::vector<uint32_t> indices(index_count);
+        for (auto& value : indices)
+        {
+            value = index(generator);
+        }
+
+        std::vector<uint32_t> words = indices;
+        PackIndices(words);
+        ASSERT_EQ(words.size(), GetIndexWordCount(index_count, IndexFormat::UINT16));
+        EXPECT_EQ(DecodeIndices(words.data(), index_count, IndexFormat::UINT16), indices);
+        for (uint32_t i = 0; i < index_count; ++i)
+        {
+            EXPECT_EQ(ReadIndex(words.data(), i, IndexFormat::UINT16), indices[i]);
+        }
+    }
+}
+
+TEST(IndexPackingTest, SelectsFormatFromVertexCount)
+{
+    EXPECT_EQ(SelectIndexFormat(3), IndexFormat::UINT16);
+    EXPECT_EQ(SelectIndexFormat(MAX_UINT16_INDEX_VERTEX_COUNT), IndexFormat::UINT16);
+    EXPECT_EQ(SelectIndexFormat(MAX_UINT16_INDEX_VERTEX_COUNT + 1), IndexFormat::UINT32);
+    EXPECT_EQ(GetIndexWordCount(7, IndexFormat::UINT32), 7u);
+    EXPECT_EQ(GetIndexWordCount(7, IndexFormat::UINT16), 4u);
+
+    const std::vector<uint32_t> indices = {70000, 1, 2};
+    EXPECT_EQ(DecodeIndices(indices.data(), 3, IndexFormat::UINT32), indices);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <Helpers/MatrixBatch.h>
+
+using namespace ZEngine::Helpers;
+
+/*
+ * FMA contraction in the AVX2 path changes the rounding, so results are compared with a relative tolerance
+ */
+constexpr float MatrixTolerance = 1e-5f;
+
+static std::vector<glm::mat4> GenerateMatrices(uint32_t count)
+{
+    std::mt19937                          generator(42);
+    std::uniform_real_distribution<float> distribution(-4.0f, 4.0f);
+
+    std::vector<glm::mat4> matrices(count);
+    for (auto& matrix : matrices)
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            for (int row = 0; row < 4; ++row)
+            {
+                matrix[column][row] = distribution(generator);
+            }
+        }
+    }
+    return matrices;
+}
+
+static void ExpectMatrixNear(const glm::mat4& expected, const glm::mat4& actual)
+{
+    for (int column = 0; column < 4; ++column)
+    {
+        for (int row = 0; row < 4; ++row)
+        {
+            float tolerance = MatrixTolerance * std::max(1.0f, std::abs(expected[column][row]));
+            EXPECT_NEAR(expected[column][row], actual[column][row], tolerance);
+        }
+    }
+}
+
+TEST(MatrixBatchTest, MatchesGlmOnEveryBackend)
+{
+    /*
+     * Nodes [0, 64) are parents and already hold their global transforms, nodes [64, 1088) are their children
+     */
+    const uint32_t parent_count = 64;
+    const uint32_t child_count  = 1024;
+    const auto     local        = GenerateMatrices(parent_count + child_count);
+    const auto     parents      = GenerateMatrices(parent_count);
+
+    std::vector<int32_t>  parent_indices(child_count);
+    std::vector<uint32_t> node_indices(child_count);
+    for (uint32_t i = 0; i < child_count; ++i)
+    {
+        parent_indices[i] = i % parent_count;
+        node_indices[i]   = parent_count + i;
+    }
+
+    for (auto backend : {SimdBackend::SCALAR, SimdBackend::SSE4, SimdBackend::AVX2})
+    {
+        if (!IsSimdBackendSupported(backend))
+        {
+            continue;
+        }
+
+        std::vector<glm::mat4> global(parent_count + child_count, glm::mat4(0.0f));
+        std::copy(parents.begin(), parents.end(), global.begin());
+
+        MultiplyHierarchyTransformBatch(backend, parent_indices.data(), node_indices.data(), local.data(), global.data(), child_count);
+
+        for (uint32_t i = 0; i < child_count; ++i)
+        {
+            ExpectMatrixNear(parents[parent_indices[i]] * local[node_indices[i]], global[node_indices[i]]);
+        }
+    }
+}
+
+TEST(MatrixBatchTest, RootNodeCopiesLocalTransform)
+{
+    const auto local = GenerateMatrices(2);
+
+    for (auto backend : {SimdBackend::SCALAR, SimdBackend::SSE4, SimdBackend::AVX2})
+    {
+        if (!IsSimdBackendSupported(backend))
+        {
+            continue;
+        }
+
+        std::vector<glm::mat4> global(2, glm::mat4(0.0f));
+        const int32_t          parent_indices[] = {-1, -1};
+        const uint32_t         node_indices[]   = {0, 1};
+
+        MultiplyHierarchyTransformBatch(backend, parent_indices, node_indices, local.data(), global.data(), 2);
+
+        EXPECT_EQ(local[0], global[0]);
+        EXPECT_EQ(local[1], global[1]);
+    }
+}
+
+TEST(MatrixBatchTest, ScalarBackendIsAlwaysSupported)
+{
+    EXPECT_TRUE(IsSimdBackendSupported(SimdBackend::SCALAR));
+    EXPECT_TRUE(IsSimdBackendSupported(GetSimdBackend()));
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <Rendering/Meshes/MeshOptimizer.h>
+
+using namespace ZEngine::Rendering::Meshes;
+
+/*
+ * Flat grid of grid_size x grid_size quads with the 8 floats stride of the scene vertices, triangles in random order
+ */
+static void GenerateShuffledGrid(uint32_t grid_size, std::vector<float>& vertices, std::vector<uint32_t>& indices)
+{
+    const uint32_t row_size = grid_size + 1;
+    for (uint32_t z = 0; z < row_size; ++z)
+    {
+        for (uint32_t x = 0; x < row_size; ++x)
+        {
+            vertices.insert(vertices.end(), {(float) x, 0.0f, (float) z, 0.0f, 1.0f, 0.0f, (float) x, (float) z});
+        }
+    }
+
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (uint32_t z = 0; z < grid_size; ++z)
+    {
+        for (uint32_t x = 0; x < grid_size; ++x)
+        {
+            const uint32_t corner = (z * row_size) + x;
+            triangles.push_back({corner, corner + row_size, corner + 1});
+            triangles.push_back({corner + 1, corner + row_size, corner + row_size + 1});
+        }
+    }
+
+    std::mt19937 generator(5);
+    std::shuffle(triangles.begin(), triangles.end(), generator);
+    for (const auto& triangle : triangles)
+    {
+        indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+}
+
+/*
+ * Triangles as sorted rotations of their first vertex, so that reordered index buffers can be compared
+ */
+static std::vector<std::array<uint32_t, 3>> GetSortedTriangles(const std::vector<uint32_t>& indices)
+{
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (size_t i = 0; i < indices.size(); i += 3)
+    {
+        std::array<uint32_t, 3> triangle = {indices[i], indices[i + 1], indices[i + 2]};
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+TEST(MeshOptimizerTest, VertexCacheOptimizationReducesACMR)
+{
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateShuffledGrid(64, vertices, indices);
+    const uint32_t vertex_count = (uint32_t) (vertices.size() / 8);
+    const auto     triangles    = GetSortedTriangles(indices);
+
+    const VertexCacheStatistics before = AnalyzeVertexCache(indices, vertex_count);
+    OptimizeVertexCache(indices, vertex_count);
+    const VertexCacheStatistics after = AnalyzeVertexCache(indices, vertex_count);
+
+    EXPECT_EQ(GetSortedTriangles(indices), triangles);
+    EXPECT_EQ(after.TriangleCount, before.TriangleCount);
+    EXPECT_EQ(after.VertexCount, vertex_count);
+    EXPECT_GT(before.GetACMR(), 2.0f);
+    EXPECT_LT(after.GetACMR(), 0.8f);
+    EXPECT_LT(after.GetATVR(), 1.5f);
+}
+
+TEST(MeshOptimizerTest, OverdrawOptimizationKeepsTrianglesAndCacheEfficiency)
+{
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateShuffledGrid(64, vertices, indices);
+    const uint32_t vertex_count = (uint32_t) (vertices.size() / 8);
+    const auto     triangles    = GetSortedTriangles(indices);
+
+    OptimizeVertexCache(indices, vertex_count);
+    const float cache_acmr = AnalyzeVertexCache(indices, vertex_count).GetACMR();
+    OptimizeOverdraw(indices, vertices.data(), vertex_count, 8, 1.05f);
+
+    EXPECT_EQ(GetSortedTriangles(indices), triangles);
+    EXPECT_LT(AnalyzeVertexCache(indices, vertex_count).GetACMR(), cache_acmr * 1.2f);
+}
+
+TEST(MeshOptimizerTest, VertexFetchOptimizationFollowsFirstUse)
+{
+    std::vector<float> vertices = {
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, //
+        1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, //
+        9.0f, 9.0f, 9.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, //
+        1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, //
+        0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, //
+    };
+    std::vector<uint32_t> indices = {4, 0, 3, 3, 0, 1};
+
+    ASSERT_EQ(OptimizeVertexFetch(indices, vertices, 8), 4u);
+    EXPECT_EQ(indices, (std::vector<uint32_t>{0, 1, 2, 2, 1, 3}));
+    ASSERT_EQ(vertices.size(), 32u);
+    EXPECT_FLOAT_EQ(vertices[1], 1.0f);
+    EXPECT_FLOAT_EQ(vertices[8 * 2], 1.0f);
+    EXPECT_FLOAT_EQ(vertices[8 * 2 + 1], 1.0f);
+    EXPECT_FLOAT_EQ(vertices[8 * 3], 1.0f);
+    EXPECT_FLOAT_EQ(vertices[8 * 3 + 1], 0.0f);
+}
+
+TEST(MeshOptimizerTest, VertexFetchOptimizationReducesOverfetch)
+{
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateShuffledGrid(64, vertices, indices);
+    /*
+     * Vertices in random order, as the optimized triangle order would leave them
+     */
+    const uint32_t        vertex_count = (uint32_t) (vertices.size() / 8);
+    std::vector<uint32_t> permutation(vertex_count);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), std::mt19937(9));
+    for (auto& index : indices)
+    {
+        index = permutation[index];
+    }
+
+    OptimizeVertexCache(indices, vertex_count);
+    const VertexFetchStatistics before = AnalyzeVertexFetch(indices, vertex_count, 32);
+    OptimizeVertexFetch(indices, vertices, 8);
+    const VertexFetchStatistics after = AnalyzeVertexFetch(indices, vertex_count, 32);
+
+    EXPECT_EQ(after.VertexByteCount, before.VertexByteCount);
+    EXPECT_LT(after.GetOverfetch(), before.GetOverfetch());
+    EXPECT_LT(after.GetOverfetch(), 1.75f);
+}
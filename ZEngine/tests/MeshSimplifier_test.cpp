@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <Rendering/Meshes/MeshSimplifier.h>
+
+using namespace ZEngine::Rendering::Meshes;
+
+/*
+ * Height field of grid_size x grid_size quads over [0, grid_size] with the 8 floats stride of the scene vertices
+ */
+static void GenerateHeightField(uint32_t grid_size, float amplitude, std::vector<float>& vertices, std::vector<uint32_t>& indices)
+{
+    const uint32_t row_size = grid_size + 1;
+    for (uint32_t z = 0; z < row_size; ++z)
+    {
+        for (uint32_t x = 0; x < row_size; ++x)
+        {
+            const float height = amplitude * std::sin(x * 0.4f) * std::cos(z * 0.3f);
+            vertices.insert(vertices.end(), {(float) x, height, (float) z, 0.0f, 1.0f, 0.0f, (float) x, (float) z});
+        }
+    }
+
+    for (uint32_t z = 0; z < grid_size; ++z)
+    {
+        for (uint32_t x = 0; x < grid_size; ++x)
+        {
+            const uint32_t corner = (z * row_size) + x;
+            indices.insert(indices.end(), {corner, corner + row_size, corner + 1, corner + 1, corner + row_size, corner + row_size + 1});
+        }
+    }
+}
+
+static bool IsBorderVertex(uint32_t index, uint32_t grid_size)
+{
+    const uint32_t x = index % (grid_size + 1);
+    const uint32_t z = index / (grid_size + 1);
+    return (x == 0) || (z == 0) || (x == grid_size) || (z == grid_size);
+}
+
+TEST(MeshSimplifierTest, FlatGridReachesTargetAndKeepsBorders)
+{
+    const uint32_t        grid_size = 32;
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateHeightField(grid_size, 0.0f, vertices, indices);
+    const auto vertex_count = (uint32_t) (vertices.size() / 8);
+
+    float                       error      = 1.0f;
+    const std::vector<uint32_t> simplified = SimplifyMesh(indices, vertices.data(), vertex_count, 8, indices.size() / 4, 0.01f, &error);
+
+    ASSERT_EQ(simplified.size() % 3, 0u);
+    EXPECT_LE(simplified.size(), indices.size() / 4);
+    EXPECT_FLOAT_EQ(error, 0.0f);
+
+    std::set<uint32_t> used(simplified.begin(), simplified.end());
+    for (uint32_t index = 0; index < vertex_count; ++index)
+    {
+        if (IsBorderVertex(index, grid_size))
+        {
+            EXPECT_TRUE(used.contains(index)) << "border vertex " << index;
+        }
+    }
+    /*
+     * The grid stays facing up : no triangle was folded over
+     */
+    for (size_t i = 0; i < simplified.size(); i += 3)
+    {
+        const float* p0 = vertices.data() + (size_t) simplified[i] * 8;
+        const float* p1 = vertices.data() + (size_t) simplified[i + 1] * 8;
+        const float* p2 = vertices.data() + (size_t) simplified[i + 2] * 8;
+        const float  ny = ((p1[2] - p0[2]) * (p2[0] - p0[0])) - ((p1[0] - p0[0]) * (p2[2] - p0[2]));
+        EXPECT_GT(ny, 0.0f);
+    }
+}
+
+TEST(MeshSimplifierTest, ErrorLimitStopsCollapses)
+{
+    const uint32_t        grid_size = 32;
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateHeightField(grid_size, 2.0f, vertices, indices);
+    const auto vertex_count = (uint32_t) (vertices.size() / 8);
+
+    float                       strict_error = 0.0f;
+    const std::vector<uint32_t> strict       = SimplifyMesh(indices, vertices.data(), vertex_count, 8, 0, 0.001f, &strict_error);
+
+    float                       loose_error = 0.0f;
+    const std::vector<uint32_t> loose       = SimplifyMesh(indices, vertices.data(), vertex_count, 8, 0, 0.05f, &loose_error);
+
+    EXPECT_LE(strict_error, 0.001f);
+    EXPECT_LE(loose_error, 0.05f);
+    EXPECT_LT(loose.size(), strict.size());
+    EXPECT_LT(loose.size(), indices.size() / 2);
+    EXPECT_TRUE(std::all_of(loose.begin(), loose.end(), [&](uint32_t index) { return index < vertex_count; }));
+}
+
+TEST(MeshSimplifierTest, TargetAboveIndexCountKeepsMesh)
+{
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateHeightField(4, 1.0f, vertices, indices);
+
+    EXPECT_EQ(SimplifyMesh(indices, vertices.data(), (uint32_t) (vertices.size() / 8), 8, indices.size(), 1.0f), indices);
+}
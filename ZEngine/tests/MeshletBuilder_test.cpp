@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <Rendering/Meshes/MeshletBuilder.h>
+#include <Rendering/Meshes/MeshOptimizer.h>
+
+using namespace ZEngine::Rendering::Meshes;
+
+/*
+ * Flat grid of grid_size x grid_size quads facing +Y with the 8 floats stride of the scene vertices
+ */
+static void GenerateGrid(uint32_t grid_size, std::vector<float>& vertices, std::vector<uint32_t>& indices)
+{
+    const uint32_t row_size = grid_size + 1;
+    for (uint32_t z = 0; z < row_size; ++z)
+    {
+        for (uint32_t x = 0; x < row_size; ++x)
+        {
+            vertices.insert(vertices.end(), {(float) x, 0.0f, (float) z, 0.0f, 1.0f, 0.0f, (float) x, (float) z});
+        }
+    }
+
+    for (uint32_t z = 0; z < grid_size; ++z)
+    {
+        for (uint32_t x = 0; x < grid_size; ++x)
+        {
+            const uint32_t corner = (z * row_size) + x;
+            indices.insert(indices.end(), {corner, corner + row_size, corner + 1, corner + 1, corner + row_size, corner + row_size + 1});
+        }
+    }
+}
+
+TEST(MeshletBuilderTest, MeshletsCoverTheIndicesWithinLimits)
+{
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateGrid(64, vertices, indices);
+    const auto vertex_count = (uint32_t) (vertices.size() / 8);
+    OptimizeVertexCache(indices, vertex_count);
+
+    const std::vector<Meshlet> meshlets = BuildMeshlets(indices.data(), (uint32_t) indices.size(), vertices.data(), vertex_count, 8);
+    ASSERT_FALSE(meshlets.empty());
+    EXPECT_LT(meshlets.size(), (indices.size() / 3 / MESHLET_MAX_TRIANGLE_COUNT) * 2);
+
+    uint32_t index_offset = 0;
+    for (const auto& meshlet : meshlets)
+    {
+        EXPECT_EQ(meshlet.IndexOffset, index_offset);
+        EXPECT_LE(meshlet.IndexCount / 3, MESHLET_MAX_TRIANGLE_COUNT);
+        EXPECT_LE(meshlet.VertexCount, MESHLET_MAX_VERTEX_COUNT);
+
+        const std::set<uint32_t> unique_vertices(indices.begin() + meshlet.IndexOffset, indices.begin() + meshlet.IndexOffset + meshlet.IndexCount);
+        EXPECT_EQ(meshlet.VertexCount, unique_vertices.size());
+        for (uint32_t index : unique_vertices)
+        {
+            const glm::vec3 position(vertices[index * 8], vertices[(index * 8) + 1], vertices[(index * 8) + 2]);
+            EXPECT_LE(glm::length(position - meshlet.Center), meshlet.Radius * 1.0001f);
+        }
+        index_offset += meshlet.IndexCount;
+    }
+    EXPECT_EQ(index_offset, indices.size());
+}
+
+TEST(MeshletBuilderTest, FlatMeshletsFaceAwayFromBelow)
+{
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateGrid(4, vertices, indices);
+
+    const std::vector<Meshlet> meshlets = BuildMeshlets(indices.data(), (uint32_t) indices.size(), vertices.data(), (uint32_t) (vertices.size() / 8), 8);
+    ASSERT_EQ(meshlets.size(), 1u);
+    EXPECT_NEAR(meshlets[0].ConeAxis.y, 1.0f, 1e-5f);
+    EXPECT_NEAR(meshlets[0].ConeCutoff, 0.0f, 1e-3f);
+
+    EXPECT_TRUE(IsMeshletBackFacing(meshlets[0], glm::vec3(2.0f, -10.0f, 2.0f)));
+    EXPECT_FALSE(IsMeshletBackFacing(meshlets[0], glm::vec3(2.0f, 10.0f, 2.0f)));
+    /*
+     * Below the grid plane but close to it, the bounding sphere keeps the meshlet
+     */
+    EXPECT_FALSE(IsMeshletBackFacing(meshlets[0], glm::vec3(2.0f, -1.0f, 2.0f)));
+}
+
+TEST(MeshletBuilderTest, ClosedMeshletIsNeverBackFacing)
+{
+    /*
+     * Cube : normals spread in every direction
+     */
+    std::vector<float> vertices;
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        vertices.insert(vertices.end(), {(float) (i & 1), (float) ((i >> 1) & 1), (float) ((i >> 2) & 1), 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+    }
+    const std::vector<uint32_t> indices = {0, 2, 1, 1, 2, 3, 4, 5, 6, 5, 7, 6, 0, 1, 4, 1, 5, 4, 2, 6, 3, 3, 6, 7, 0, 4, 2, 2, 4, 6, 1, 3, 5, 3, 7, 5};
+
+    const std::vector<Meshlet> meshlets = BuildMeshlets(indices.data(), (uint32_t) indices.size(), vertices.data(), 8, 8);
+    ASSERT_EQ(meshlets.size(), 1u);
+    EXPECT_FLOAT_EQ(meshlets[0].ConeCutoff, 1.0f);
+    for (const auto& position : {glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f, -10.0f, 0.0f), glm::vec3(0.5f, 0.5f, 30.0f)})
+    {
+        EXPECT_FALSE(IsMeshletBackFacing(meshlets[0], position));
+    }
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <random>
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/gtc/matrix_transform.hpp>
+#include <Helpers/RayCasting.h>
+
+using namespace ZEngine::Helpers;
+
+/*
+ * Small triangles scattered in a cube, vertices stored with the 8 floats stride of the scene vertices
+ */
+static void GenerateTriangleSoup(uint32_t triangle_count, std::vector<float>& vertices, std::vector<uint32_t>& indices)
+{
+    std::mt19937                          generator(11);
+    std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+
+    vertices.clear();
+    indices.clear();
+    for (uint32_t triangle = 0; triangle < triangle_count; ++triangle)
+    {
+        const glm::vec3 center(position(generator), position(generator), position(generator));
+        for (uint32_t vertex = 0; vertex < 3; ++vertex)
+        {
+            vertices.insert(vertices.end(), {center.x + offset(generator), center.y + offset(generator), center.z + offset(generator), 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+            indices.push_back((3 * triangle) + vertex);
+        }
+    }
+}
+
+static Ray GenerateRay(std::mt19937& generator)
+{
+    std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> slope(-0.3f, 0.3f);
+    return {.Origin = glm::vec3(position(generator), position(generator), 40.0f), .Direction = glm::normalize(glm::vec3(slope(generator), slope(generator), -1.0f))};
+}
+
+TEST(RayCastingTest, HitsClosestTriangle)
+{
+    TriangleCollection triangles;
+    triangles.Resize(3);
+    triangles.Set(0, glm::vec3(-1.0f, -1.0f, -10.0f), glm::vec3(1.0f, -1.0f, -10.0f), glm::vec3(0.0f, 1.0f, -10.0f));
+    triangles.Set(1, glm::vec3(-1.0f, -1.0f, -5.0f), glm::vec3(1.0f, -1.0f, -5.0f), glm::vec3(0.0f, 1.0f, -5.0f));
+    triangles.Set(2, glm::vec3(4.0f, -1.0f, -2.0f), glm::vec3(6.0f, -1.0f, -2.0f), glm::vec3(5.0f, 1.0f, -2.0f));
+
+    const Ray ray = {.Origin = glm::vec3(0.0f), .Direction = glm::vec3(0.0f, 0.0f, -1.0f)};
+    for (auto backend : {SimdBackend::SCALAR, SimdBackend::SSE4, SimdBackend::AVX2})
+    {
+        if (!IsSimdBackendSupported(backend))
+        {
+            continue;
+        }
+
+        float distance = 0.0f;
+        EXPECT_EQ(IntersectRayTriangleBatch(backend, ray, triangles, 0, 3, FLT_MAX, distance), 1u);
+        EXPECT_FLOAT_EQ(distance, 5.0f);
+        EXPECT_EQ(IntersectRayTriangleBatch(backend, ray, triangles, 0, 3, 4.0f, distance), 0xFFFFFFFF);
+        EXPECT_EQ(IntersectRayTriangleBatch(backend, ray, triangles, 2, 1, FLT_MAX, distance), 0xFFFFFFFF);
+    }
+}
+
+TEST(RayCastingTest, HierarchyMatchesBruteForce)
+{
+    std::vector<float>    vertices;
+    std::vector<uint32_t> indices;
+    GenerateTriangleSoup(20'000, vertices, indices);
+
+    TriangleBoundingVolumeHierarchy hierarchy;
+    hierarchy.Build(vertices.data(), 8, indices.data(), indices.size());
+    ASSERT_EQ(hierarchy.GetTriangleCount(), 20'000u);
+    /*
+     * Brute force reference over the triangles in their original order
+     */
+    TriangleCollection triangles;
+    triangles.Resize(20'000);
+    for (uint32_t triangle = 0; triangle < 20'000; ++triangle)
+    {
+        auto position = [&vertices](uint32_t vertex) { return glm::vec3(vertices[8 * vertex], vertices[8 * vertex + 1], vertices[8 * vertex + 2]); };
+        triangles.Set(triangle, position(indices[3 * triangle]), position(indices[3 * triangle + 1]), position(indices[3 * triangle + 2]));
+    }
+
+    std::mt19937 generator(5);
+    uint32_t     hit_count = 0;
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        const Ray ray               = GenerateRay(generator);
+        float     expected_distance = 0.0f;
+        uint32_t  expected          = IntersectRayTriangleBatch(SimdBackend::SCALAR, ray, triangles, 0, triangles.Count, FLT_MAX, expected_distance);
+
+        for (auto backend : {SimdBackend::SCALAR, SimdBackend::SSE4, SimdBackend::AVX2})
+        {
+            if (!IsSimdBackendSupported(backend))
+            {
+                continue;
+            }
+
+            RayHit hit = {};
+            ASSERT_EQ(hierarchy.Raycast(backend, ray, FLT_MAX, hit), expected != 0xFFFFFFFF);
+            if (hit.IsValid())
+            {
+                EXPECT_EQ(hit.Primitive, expected);
+                EXPECT_FLOAT_EQ(hit.Distance, expected_distance);
+            }
+        }
+        hit_count += (expected != 0xFFFFFFFF) ? 1 : 0;
+    }
+    EXPECT_GT(hit_count, 0u);
+}
+
+TEST(RayCastingTest, UnprojectsViewportPositions)
+{
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f, 0.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 2.0f, 0.1f, 100.0f);
+    const glm::vec2 size(800.0f, 400.0f);
+
+    const Ray center = UnprojectViewportPosition(glm::vec2(400.0f, 200.0f), size, view, projection);
+    EXPECT_NEAR(center.Origin.z, 4.9f, 1e-4f);
+    EXPECT_NEAR(center.Direction.x, 0.0f, 1e-5f);
+    EXPECT_NEAR(center.Direction.y, 0.0f, 1e-5f);
+    EXPECT_NEAR(center.Direction.z, -1.0f, 1e-5f);
+    /*
+     * The top of the viewport is the camera up direction
+     */
+    const Ray top = UnprojectViewportPosition(glm::vec2(400.0f, 0.0f), size, view, projection);
+    EXPECT_NEAR(top.Direction.y, std::sqrt(0.5f), 1e-4f);
+    EXPECT_NEAR(top.Direction.z, -std::sqrt(0.5f), 1e-4f);
+
+    const Ray right = UnprojectViewportPosition(glm::vec2(800.0f, 200.0f), size, view, projection);
+    EXPECT_GT(right.Direction.x, 0.0f);
+}
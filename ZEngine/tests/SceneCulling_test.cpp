@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+#include <random>
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/gtc/matrix_transform.hpp>
+#include <Rendering/Renderers/SceneRenderer.h>
+#include <Rendering/Meshes/IndexPacking.h>
+#include <Rendering/Meshes/VertexQuantization.h>
+
+using namespace ZEngine::Helpers;
+using namespace ZEngine::Rendering::Renderers;
+
+/*
+ * Camera at the origin looking down -Z, 90 degrees field of view, depth range [0.1, 100]
+ */
+static Frustum GetCameraFrustum()
+{
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+    return ExtractFrustum(projection * view);
+}
+
+static DrawData MakeDrawData(uint32_t mesh_slot, uint32_t index_count)
+{
+    return {.Index = mesh_slot, .TransformIndex = mesh_slot, .MaterialIndex = mesh_slot, .VertexOffset = 0, .IndexOffset = 0, .VertexCount = 0, .IndexCount = index_count};
+}
+
+TEST(SceneCullingTest, ReferenceEmitsVisibleDraws)
+{
+    const Frustum frustum = GetCameraFrustum();
+
+    const AABB      unit_box     = {.Min = glm::vec3(-1.0f), .Max = glm::vec3(1.0f)};
+    const AABB      bounds[]     = {unit_box, unit_box, AABB{}, unit_box};
+    const glm::mat4 transforms[] = {
+        glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -10.0f)), // in front
+        glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, 10.0f)),  // behind
+        glm::mat4(1.0f),                                                // empty bounds
+        glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(12.0f, 0.0f, -10.0f)), glm::vec3(3.0f)), // crossing the right plane once scaled
+    };
+
+    const DrawData draw_data[] = {MakeDrawData(0, 36), MakeDrawData(1, 36), MakeDrawData(2, 36), MakeDrawData(3, 72)};
+
+    std::vector<VkDrawIndirectCommand> commands;
+    ASSERT_EQ(CullDrawDataReference(frustum, draw_data, 4, transforms, bounds, commands), 2u);
+    EXPECT_EQ(commands[0].firstInstance, 0u);
+    EXPECT_EQ(commands[0].vertexCount, 36u);
+    EXPECT_EQ(commands[0].instanceCount, 1u);
+    EXPECT_EQ(commands[1].firstInstance, 3u);
+    EXPECT_EQ(commands[1].vertexCount, 72u);
+}
+
+TEST(SceneCullingTest, ReferenceMatchesWorldBoundsCulling)
+{
+    const Frustum frustum = GetCameraFrustum();
+
+    std::mt19937                          generator(7);
+    std::uniform_real_distribution<float> position(-120.0f, 120.0f);
+    std::uniform_real_distribution<float> size(0.1f, 4.0f);
+    std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+
+    const uint32_t         draw_count = 4'099;
+    std::vector<AABB>      local_bounds(draw_count);
+    std::vector<glm::mat4> transforms(draw_count);
+    std::vector<DrawData>  draw_data(draw_count);
+    for (uint32_t i = 0; i < draw_count; ++i)
+    {
+        const glm::vec3 extent = glm::vec3(size(generator), size(generator), size(generator));
+        local_bounds[i]        = {.Min = -extent, .Max = extent};
+        transforms[i]          = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(position(generator), position(generator), position(generator))), angle(generator), glm::vec3(0.0f, 1.0f, 0.0f));
+        draw_data[i]           = MakeDrawData(i, i + 3);
+    }
+    /*
+     * The GPU pass tests the same world bounds the CPU path computes for the snapshot, both must agree on every draw
+     */
+    std::vector<AABB> world_bounds(draw_count);
+    for (uint32_t i = 0; i < draw_count; ++i)
+    {
+        world_bounds[i] = TransformAABB(local_bounds[i], transforms[i]);
+    }
+    std::vector<uint8_t> visibility(draw_count);
+    const uint32_t       expected_count = CullAABBBatch(SimdBackend::SCALAR, frustum, world_bounds.data(), draw_count, visibility.data());
+
+    std::vector<VkDrawIndirectCommand> commands;
+    ASSERT_EQ(CullDrawDataReference(frustum, draw_data.data(), draw_count, transforms.data(), local_bounds.data(), commands), expected_count);
+
+    uint32_t command_index = 0;
+    for (uint32_t i = 0; i < draw_count; ++i)
+    {
+        if (!visibility[i])
+        {
+            continue;
+        }
+        EXPECT_EQ(commands[command_index].firstInstance, i);
+        EXPECT_EQ(commands[command_index].vertexCount, draw_data[i].IndexCount);
+        command_index++;
+    }
+}
+
+TEST(SceneCullingTest, MeshLodFollowsProjectedError)
+{
+    ZEngine::Rendering::Meshes::MeshLodSet lods = {};
+    lods.Count                                  = 2;
+    lods.Levels[0]                              = {.IndexOffset = 36, .IndexCount = 18, .Error = 0.01f};
+    lods.Levels[1]                              = {.IndexOffset = 54, .IndexCount = 9, .Error = 0.1f};
+    /*
+     * Radius of sqrt(3), 100 pixels per unit at distance 1 : level 1 needs a distance of 1.73, level 2 of 17.3
+     */
+    const glm::vec4 lod_camera = glm::vec4(0.0f, 0.0f, 0.0f, 100.0f);
+    const auto      bounds_at  = [](float distance) { return AABB{.Min = glm::vec3(-1.0f, -1.0f, -distance - 1.0f), .Max = glm::vec3(1.0f, 1.0f, -distance + 1.0f)}; };
+
+    EXPECT_EQ(SelectMeshLod(lods, bounds_at(0.5f), lod_camera), 0u);
+    EXPECT_EQ(SelectMeshLod(lods, bounds_at(5.0f), lod_camera), 1u);
+    EXPECT_EQ(SelectMeshLod(lods, bounds_at(50.0f), lod_camera), 2u);
+    EXPECT_EQ(SelectMeshLod(lods, bounds_at(50.0f), glm::vec4(0.0f)), 0u);
+    EXPECT_EQ(SelectMeshLod({}, bounds_at(50.0f), lod_camera), 0u);
+
+    const Frustum   frustum      = GetCameraFrustum();
+    const AABB      unit_box     = {.Min = glm::vec3(-1.0f), .Max = glm::vec3(1.0f)};
+    const AABB      bounds[]     = {unit_box, unit_box};
+    const glm::mat4 transforms[] = {
+        glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -5.0f)),
+        glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -50.0f)),
+    };
+    const DrawData                               draw_data[] = {MakeDrawData(0, 36), MakeDrawData(1, 36)};
+    const ZEngine::Rendering::Meshes::MeshLodSet mesh_lods[] = {lods, lods};
+
+    std::vector<VkDrawIndirectCommand> commands;
+    ASSERT_EQ(CullDrawDataReference(frustum, draw_data, 2, transforms, bounds, commands, mesh_lods, lod_camera), 2u);
+    EXPECT_EQ(commands[0].firstVertex, 36u);
+    EXPECT_EQ(commands[0].vertexCount, 18u);
+    EXPECT_EQ(commands[1].firstVertex, 54u);
+    EXPECT_EQ(commands[1].vertexCount, 9u);
+}
+
+TEST(SceneCullingTest, MeshletsAreCulledByFrustumAndCone)
+{
+    /*
+     * Ten units in front of the camera : a meshlet facing it, the same one facing away and one far on the right of the frustum
+     */
+    const ZEngine::Rendering::Meshes::Meshlet meshlets[] = {
+        {.IndexCount = 3, .Center = glm::vec3(0.0f), .Radius = 1.0f, .ConeAxis = glm::vec3(0.0f, 0.0f, 1.0f), .ConeCutoff = 0.1f},
+        {.IndexCount = 3, .Center = glm::vec3(0.0f), .Radius = 1.0f, .ConeAxis = glm::vec3(0.0f, 0.0f, -1.0f), .ConeCutoff = 0.1f},
+        {.IndexCount = 3, .Center = glm::vec3(50.0f, 0.0f, 0.0f), .Radius = 1.0f, .ConeAxis = glm::vec3(0.0f, 0.0f, 1.0f), .ConeCutoff = 0.1f},
+    };
+    const Frustum   frustum   = GetCameraFrustum();
+    const glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -10.0f));
+
+    std::vector<uint32_t> visible;
+    ASSERT_EQ(CullMeshlets(frustum, meshlets, 3, transform, glm::vec3(0.0f), true, visible), 1u);
+    EXPECT_EQ(visible, std::vector<uint32_t>({0}));
+
+    visible.clear();
+    ASSERT_EQ(CullMeshlets(frustum, meshlets, 3, transform, glm::vec3(0.0f), false, visible), 2u);
+    EXPECT_EQ(visible, std::vector<uint32_t>({0, 1}));
+    /*
+     * A mirroring transform swaps the front faces, cones are not tested
+     */
+    visible.clear();
+    const glm::mat4 mirrored = glm::scale(transform, glm::vec3(1.0f, 1.0f, -1.0f));
+    ASSERT_EQ(CullMeshlets(frustum, meshlets, 3, mirrored, glm::vec3(0.0f), true, visible), 2u);
+}
+
+TEST(SceneCullingTest, CulledDrawsFetchTheMeshTriangles)
+{
+    using namespace ZEngine::Rendering::Meshes;
+    using namespace ZEngine::Rendering::Scenes;
+    /*
+     * Unit cube with the 8 floats stride of the scene vertices
+     */
+    const AABB            cube_bounds = {.Min = glm::vec3(-1.0f), .Max = glm::vec3(1.0f)};
+    std::vector<float>    cube_vertices;
+    std::vector<uint32_t> cube_indices = {0, 1, 3, 0, 3, 2, 4, 5, 7, 4, 7, 6, 0, 2, 6, 0, 6, 4, 1, 3, 7, 1, 7, 5, 0, 1, 5, 0, 5, 4, 2, 3, 7, 2, 7, 6};
+    for (uint32_t corner = 0; corner < 8; ++corner)
+    {
+        const glm::vec3 p((corner & 1) ? 1.0f : -1.0f, (corner & 2) ? 1.0f : -1.0f, (corner & 4) ? 1.0f : -1.0f);
+        cube_vertices.insert(cube_vertices.end(), {p.x, p.y, p.z, p.x, p.y, p.z, 0.0f, 0.0f});
+    }
+    std::vector<float>    quantized_vertices = cube_vertices;
+    std::vector<uint32_t> packed_indices     = cube_indices;
+    QuantizeVertices(quantized_vertices, cube_bounds);
+    PackIndices(packed_indices);
+    /*
+     * Scene vertex and index streams, as uploaded : float vertices then quantized ones, 32 bits indices then packed 16 bits ones
+     */
+    std::vector<float> vertices = cube_vertices;
+    vertices.insert(vertices.end(), quantized_vertices.begin(), quantized_vertices.end());
+    std::vector<uint32_t> indices = cube_indices;
+    indices.insert(indices.end(), packed_indices.begin(), packed_indices.end());
+
+    const MeshVNext float_mesh     = {.VertexCount = 8, .IndexCount = 36, .VertexOffset = 0, .IndexOffset = 0, .LocalBounds = cube_bounds};
+    const MeshVNext quantized_mesh = {
+        .VertexCount = 8, .IndexCount = 36, .VertexOffset = 64, .IndexOffset = 36, .Format = VertexFormat::QUANTIZED, .IndexType = IndexFormat::UINT16, .LocalBounds = cube_bounds};
+    const MeshVNext meshlet_mesh = {
+        .VertexCount   = 8,
+        .IndexCount    = 36,
+        .VertexOffset  = 0,
+        .IndexOffset   = 36,
+        .MeshletOffset = 0,
+        .MeshletCount  = 2,
+        .IndexType     = IndexFormat::UINT16,
+        .LocalBounds   = cube_bounds};
+    /*
+     * Slot 0 in front of the camera, slot 1 behind it, slot 2 quantized with 16 bits indices, slot 3 split in two meshlets
+     */
+    auto geometry                         = ZEngine::CreateRef<SceneGeometrySnapshot>();
+    geometry->MeshCollection              = {float_mesh, float_mesh, quantized_mesh, meshlet_mesh};
+    geometry->MeshMaterialIndexCollection = {0, 1, 2, 3};
+    geometry->MeshletCollection           = {{.IndexOffset = 0, .IndexCount = 18, .Radius = 2.0f}, {.IndexOffset = 18, .IndexCount = 18, .Radius = 2.0f}};
+
+    SceneSnapshot snapshot;
+    snapshot.Geometry                = geometry;
+    snapshot.MeshTransformCollection = {
+        glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -10.0f)),
+        glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, 10.0f)),
+        glm::translate(glm::mat4(1.0f), glm::vec3(4.0f, 0.0f, -10.0f)),
+        glm::translate(glm::mat4(1.0f), glm::vec3(-4.0f, 0.0f, -10.0f)),
+    };
+    for (const auto& transform : snapshot.MeshTransformCollection)
+    {
+        snapshot.MeshWorldBoundCollection.push_back(TransformAABB(cube_bounds, transform));
+    }
+
+    SceneCullingState state;
+    CullSceneSnapshot(snapshot, GetCameraFrustum(), glm::vec4(0.0f), false, state);
+    ASSERT_EQ(state.DrawDataCollection.size(), 3u);
+    ASSERT_EQ(state.IndirectCommandCollection.size(), 4u);
+    /*
+     * Each command goes through FetchIndex() and FetchVertex() as final_color.vert does : the world positions drawn for a mesh slot are
+     * its triangles, in index order
+     */
+    std::vector<std::vector<glm::vec3>> drawn_positions(geometry->MeshCollection.size());
+    for (const auto& command : state.IndirectCommandCollection)
+    {
+        ASSERT_LT(command.firstInstance, state.DrawDataCollection.size());
+        const DrawData& draw_data = state.DrawDataCollection[command.firstInstance];
+        EXPECT_EQ(draw_data.TransformIndex, command.firstInstance);
+        EXPECT_EQ(draw_data.MaterialIndex, draw_data.Index);
+
+        const auto      format      = (VertexFormat) draw_data.VertexFormat;
+        const AABB      draw_bounds = {.Min = draw_data.PositionOffset, .Max = draw_data.PositionOffset + draw_data.PositionScale};
+        const glm::mat4 transform   = state.TransformCollection[draw_data.TransformIndex];
+        for (uint32_t vertex_index = command.firstVertex; vertex_index < (command.firstVertex + command.vertexCount); ++vertex_index)
+        {
+            const uint32_t index    = ReadIndex(indices.data() + draw_data.IndexOffset, vertex_index, (IndexFormat) draw_data.IndexFormat);
+            const auto     position = DecodeVertexPositions(vertices.data() + draw_data.VertexOffset + (index * GetVertexFloatCount(format)), 1, format, draw_bounds);
+            drawn_positions[draw_data.Index].push_back(glm::vec3(transform * glm::vec4(position[0], position[1], position[2], 1.0f)));
+        }
+    }
+
+    EXPECT_TRUE(drawn_positions[1].empty());
+    for (uint32_t mesh_slot : {0u, 2u, 3u})
+    {
+        SCOPED_TRACE(mesh_slot);
+        ASSERT_EQ(drawn_positions[mesh_slot].size(), cube_indices.size());
+        for (uint32_t i = 0; i < cube_indices.size(); ++i)
+        {
+            const float*    corner   = cube_vertices.data() + (cube_indices[i] * 8);
+            const glm::vec3 expected = glm::vec3(snapshot.MeshTransformCollection[mesh_slot] * glm::vec4(corner[0], corner[1], corner[2], 1.0f));
+            EXPECT_NEAR(drawn_positions[mesh_slot][i].x, expected.x, 1e-3f);
+            EXPECT_NEAR(drawn_positions[mesh_slot][i].y, expected.y, 1e-3f);
+            EXPECT_NEAR(drawn_positions[mesh_slot][i].z, expected.z, 1e-3f);
+        }
+    }
+}
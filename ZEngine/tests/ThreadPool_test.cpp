@@ -52,3 +52,27 @@ TEST_F(ThreadPoolTest, MultipleTasksExecution) {
  
     EXPECT_EQ(counter, numberOfTasks);
 }
+
+TEST_F(ThreadPoolTest, ParallelForCoversEveryIndexOnce) {
+    const uint32_t                count = 10'000;
+    std::vector<std::atomic<int>> visits(count);
+
+    for (uint32_t worker_count : {1u, 2u, 3u, 8u}) {
+        for (auto& visit : visits) {
+            visit = 0;
+        }
+
+        ThreadPoolHelper::ParallelFor(
+            count,
+            [&visits](uint32_t begin, uint32_t end) {
+                for (uint32_t i = begin; i < end; ++i) {
+                    visits[i]++;
+                }
+            },
+            worker_count);
+
+        for (const auto& visit : visits) {
+            EXPECT_EQ(visit, 1);
+        }
+    }
+}
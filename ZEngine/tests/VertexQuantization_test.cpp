@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <Rendering/Meshes/VertexQuantization.h>
+
+using namespace ZEngine::Helpers;
+using namespace ZEngine::Rendering::Meshes;
+using ZEngine::Rendering::Renderers::Storages::IVertex;
+
+static IVertex MakeVertex(std::mt19937& generator, const AABB& bounds)
+{
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_real_distribution<float> signed_unit(-1.0f, 1.0f);
+
+    IVertex vertex         = {};
+    vertex.m_position      = bounds.Min + glm::vec3(unit(generator), unit(generator), unit(generator)) * (bounds.Max - bounds.Min);
+    vertex.m_normal        = glm::normalize(glm::vec3(signed_unit(generator), signed_unit(generator), signed_unit(generator)) + glm::vec3(0.0f, 0.0f, 1e-3f));
+    vertex.m_texture_coord = glm::vec2(unit(generator) * 4.0f, unit(generator));
+    return vertex;
+}
+
+TEST(VertexQuantizationTest, RoundTripsWithinPrecision)
+{
+    std::mt19937 generator(7);
+    const AABB   bounds = {.Min = glm::vec3(-10.0f, 0.0f, 5.0f), .Max = glm::vec3(10.0f, 2.0f, 45.0f)};
+    for (int i = 0; i < 1000; ++i)
+    {
+        const IVertex vertex  = MakeVertex(generator, bounds);
+        const IVertex decoded = DequantizeVertex(QuantizeVertex(vertex, bounds), bounds);
+        /*
+         * Half of a 16 bits step of each axis extent
+         */
+        EXPECT_NEAR(decoded.m_position.x, vertex.m_position.x, 20.0f / 65535.0f);
+        EXPECT_NEAR(decoded.m_position.y, vertex.m_position.y, 2.0f / 65535.0f);
+        EXPECT_NEAR(decoded.m_position.z, vertex.m_position.z, 40.0f / 65535.0f);
+        EXPECT_GT(glm::dot(decoded.m_normal, vertex.m_normal), 0.99999f);
+        EXPECT_NEAR(decoded.m_texture_coord.x, vertex.m_texture_coord.x, 4.0f / 1024.0f);
+        EXPECT_NEAR(decoded.m_texture_coord.y, vertex.m_texture_coord.y, 1.0f / 1024.0f);
+    }
+}
+
+TEST(VertexQuantizationTest, HandlesFlatBoundsAndNullNormals)
+{
+    const AABB bounds = {.Min = glm::vec3(0.0f, 3.0f, 0.0f), .Max = glm::vec3(1.0f, 3.0f, 1.0f)};
+
+    IVertex vertex    = {};
+    vertex.m_position = glm::vec3(0.25f, 3.0f, 1.0f);
+
+    const IVertex decoded_vertex = DequantizeVertex(QuantizeVertex(vertex, bounds), bounds);
+    EXPECT_FLOAT_EQ(decoded_vertex.m_position.y, 3.0f);
+    EXPECT_FLOAT_EQ(decoded_vertex.m_position.z, 1.0f);
+    EXPECT_EQ(decoded_vertex.m_normal, glm::vec3(0.0f, 0.0f, 1.0f));
+
+    vertex.m_normal              = glm::vec3(0.0f, 0.0f, -1.0f);
+    const IVertex decoded_normal = DequantizeVertex(QuantizeVertex(vertex, bounds), bounds);
+    EXPECT_NEAR(decoded_normal.m_normal.z, -1.0f, 1e-6f);
+}
+
+TEST(VertexQuantizationTest, QuantizesStreamInPlace)
+{
+    std::mt19937         generator(11);
+    const AABB           bounds = {.Min = glm::vec3(-1.0f), .Max = glm::vec3(1.0f)};
+    std::vector<IVertex> vertices(37);
+    for (auto& vertex : vertices)
+    {
+        vertex = MakeVertex(generator, bounds);
+    }
+
+    const uint32_t     vertex_float_count = GetVertexFloatCount(VertexFormat::FLOAT);
+    std::vector<float> stream(vertices.size() * vertex_float_count);
+    std::memcpy(stream.data(), vertices.data(), stream.size() * sizeof(float));
+    QuantizeVertices(stream, bounds);
+    ASSERT_EQ(stream.size(), vertices.size() * GetVertexFloatCount(VertexFormat::QUANTIZED));
+
+    const std::vector<float> positions = DecodeVertexPositions(stream.data(), (uint32_t) vertices.size(), VertexFormat::QUANTIZED, bounds);
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        QuantizedVertex quantized_vertex = {};
+        std::memcpy(&quantized_vertex, stream.data() + i * GetVertexFloatCount(VertexFormat::QUANTIZED), sizeof(quantized_vertex));
+        const QuantizedVertex expected_vertex = QuantizeVertex(vertices[i], bounds);
+        EXPECT_EQ(quantized_vertex.PositionXY, expected_vertex.PositionXY);
+        EXPECT_EQ(quantized_vertex.Normal, expected_vertex.Normal);
+        EXPECT_EQ(quantized_vertex.TextureCoord, expected_vertex.TextureCoord);
+        EXPECT_NEAR(positions[i * 3], vertices[i].m_position.x, 2.0f / 65535.0f);
+        EXPECT_NEAR(positions[i * 3 + 2], vertices[i].m_position.z, 2.0f / 65535.0f);
+    }
+}